@@ -25,5 +25,119 @@ class Tests: XCTestCase {
             // Put the code you want to measure the time of here.
         }
     }
+
+    func testSequentialAppendFollowsTheTail() {
+        let layer = CALayer()
+        let timeline = TimelineAnimation()
+        for _ in 0..<10_000 {
+            timeline.add(animation: .fadeIn(timingFunction: .linear),
+                         forLayer: layer,
+                         withDuration: 0.1)
+        }
+        XCTAssertEqual(timeline.endTime, 1_000.0, accuracy: 1e-6)
+        
+        // a delay moves the tail with the rest
+        timeline.delay(0.5)
+        timeline.add(animation: .fadeIn(timingFunction: .linear),
+                     forLayer: layer,
+                     withDuration: 0.1)
+        XCTAssertEqual(timeline.beginTime, 0.5, accuracy: 1e-6)
+        XCTAssertEqual(timeline.endTime, 1_000.6, accuracy: 1e-6)
+        XCTAssertEqual(timeline.duration, 1_000.1, accuracy: 1e-6)
+    }
+    
+    func testPerformanceOfSequentialAppend() {
+        let layer = CALayer()
+        self.measure() {
+            let timeline = TimelineAnimation()
+            for _ in 0..<10_000 {
+                timeline.add(animation: .fadeIn(timingFunction: .linear),
+                             forLayer: layer,
+                             withDuration: 0.1)
+            }
+        }
+    }
+    
+    func testTimesAreWholeMillisecondsAlsoBeforeZero() {
+        let layer = CALayer()
+        let timeline = TimelineAnimation()
+        for _ in 0..<3 {
+            timeline.add(animation: .fadeIn(timingFunction: .linear),
+                         forLayer: layer,
+                         withDuration: 0.1)
+        }
+        XCTAssertEqual(timeline.endTime, 0.3)
+        
+        // as -playFromProgress: moves it
+        timeline.beginTime = -0.1504
+        XCTAssertEqual(timeline.beginTime, -0.15)
+        XCTAssertEqual(timeline.endTime, 0.15)
+        XCTAssertEqual(timeline.duration, 0.3, accuracy: 1e-9)
+    }
+    
+    func testBatchUpdatesReportEveryConflictAndAddNothing() {
+        let layer = CALayer()
+        let timeline = TimelineAnimation()
+        timeline.insert(animation: .fadeIn(timingFunction: .linear),
+                        forLayer: layer,
+                        atTime: 0.0,
+                        withDuration: 0.5)
+        do {
+            try timeline.performBatchUpdates {
+                // overlaps the one already in
+                timeline.insert(animation: .fadeIn(timingFunction: .linear),
+                                forLayer: layer,
+                                atTime: 0.25,
+                                withDuration: 0.5)
+                timeline.insert(animation: .fadeIn(timingFunction: .linear),
+                                forLayer: layer,
+                                atTime: 1.0,
+                                withDuration: 0.5)
+                // the same as the one before
+                timeline.insert(animation: .fadeIn(timingFunction: .linear),
+                                forLayer: layer,
+                                atTime: 1.0,
+                                withDuration: 0.5)
+            }
+            XCTFail("The conflicts were not reported")
+        }
+        catch let error as NSError {
+            XCTAssertEqual(error.code, TimelineAnimationsErrorDomainCode.conflictingAnimations.rawValue)
+            XCTAssertEqual((error.userInfo[TimelineAnimationConflictsKey] as? [NSError])?.count, 2)
+        }
+        XCTAssertEqual(timeline.endTime, 0.5)
+        
+        XCTAssertNoThrow(try timeline.performBatchUpdates {
+            timeline.insert(animation: .fadeIn(timingFunction: .linear),
+                            forLayer: layer,
+                            atTime: 0.5,
+                            withDuration: 0.5)
+        })
+        XCTAssertEqual(timeline.endTime, 1.0)
+    }
+    
+    func testBatchUpdatesPutBackTheBlocksOfTheTimelinesMerged() {
+        let layer = CALayer()
+        let timeline = TimelineAnimation()
+        timeline.insert(animation: .fadeIn(timingFunction: .linear),
+                        forLayer: layer,
+                        atTime: 0.0,
+                        withDuration: 0.5)
+        let other = TimelineAnimation()
+        // overlaps the one of `timeline`
+        other.insert(animation: .fadeIn(timingFunction: .linear),
+                     forLayer: layer,
+                     atTime: 0.25,
+                     withDuration: 0.5)
+        other.onStart = {}
+        other.completion = { _ in }
+        
+        XCTAssertThrowsError(try timeline.performBatchUpdates {
+            timeline.merge(other)
+        })
+        XCTAssertNil(timeline.onStart)
+        XCTAssertNil(timeline.completion)
+        XCTAssertEqual(timeline.endTime, 0.5)
+    }
     
 }
@@ -58,7 +58,7 @@ typedef NS_ENUM(NSUInteger, AudioAssociationType) {
     self = [super init];
     if (self) {
         self.type = type;
-        self.time = Round(time);
+        self.time = TimelineTimeFromTicks(TimelineTicksFromTime(time));
     }
     return self;
 }
@@ -161,10 +161,10 @@ typedef NS_ENUM(NSUInteger, AudioAssociationType) {
             time = timeline.beginTime + TimelineAnimationMillisecond;
             break;
         case AudioAssociationTypeOnMid:
-            time = (RelativeTime)Round((timeline.duration * 0.5));
+            time = TimelineTimeFromTicks(TimelineTicksFromTime(timeline.duration * 0.5));
             break;
         case AudioAssociationTypeOnCompletion:
-            time = Round(timeline.endTimeWithNoRepeating - TimelineAnimationOneFrame);
+            time = TimelineTimeFromTicks(TimelineTicksFromTime(timeline.endTimeWithNoRepeating - TimelineAnimationOneFrame));
             break;
         case AudioAssociationTypeAtTime:
             time = self.time;
@@ -9,18 +9,40 @@
 
 #import "CAKeyframeAnimation+Reverse.h"
 #import "CAPropertyAnimation+Reverse.h"
+#import "CAKeyframeAnimation+SpecialEasing.h"
+#import "TimelineAnimationReversedArray.h"
+
+/// The timing function that runs `function` backwards: its control points
+/// (x1, y1, x2, y2) mirrored around the center to (1-x2, 1-y2, 1-x1, 1-y1).
+static CAMediaTimingFunction *__reversedTimingFunction(CAMediaTimingFunction *function) {
+    float first[2];
+    float second[2];
+    [function getControlPointAtIndex:1 values:first];
+    [function getControlPointAtIndex:2 values:second];
+    return [CAMediaTimingFunction functionWithControlPoints:1.0f - second[0] :1.0f - second[1]
+                                                           :1.0f - first[0] :1.0f - first[1]];
+}
 
 @implementation CAKeyframeAnimation (Reverse)
 - (instancetype)reversedAnimation {
     CAKeyframeAnimation *reverse = [self copy];
-    reverse.values               = self.values.reverseObjectEnumerator.allObjects;
-    
-    NSMutableArray<NSNumber *> *reversedKeytimes = [NSMutableArray arrayWithCapacity:self.keyTimes.count];
-    NSArray<NSNumber *> *timeskey = self.keyTimes.reverseObjectEnumerator.allObjects.mutableCopy;
-    for (NSNumber *keytime in timeskey) {
-        [reversedKeytimes addObject:@(1.0 - keytime.doubleValue)];
+    // deferred values cannot be reversed without them
+    [reverse materializeValues];
+    // views of the arrays of the animation, rather than reversed copies
+    if (reverse.values != nil) {
+        reverse.values           = [TimelineAnimationReversedArray arrayByReversingArray:reverse.values];
+    }
+    if (reverse.keyTimes != nil) {
+        reverse.keyTimes         = [TimelineAnimationReversedArray arrayByReversingKeyTimes:reverse.keyTimes];
+    }
+    // one per segment, so few enough to mirror here
+    if (reverse.timingFunctions != nil) {
+        NSMutableArray<CAMediaTimingFunction *> *const timingFunctions = [[NSMutableArray alloc] initWithCapacity:reverse.timingFunctions.count];
+        for (CAMediaTimingFunction *function in reverse.timingFunctions.reverseObjectEnumerator) {
+            [timingFunctions addObject:__reversedTimingFunction(function)];
+        }
+        reverse.timingFunctions  = [timingFunctions copy];
     }
-    reverse.keyTimes             = reversedKeytimes.copy;
     return reverse;
 }
 @end
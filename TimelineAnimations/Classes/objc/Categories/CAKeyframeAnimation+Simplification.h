@@ -0,0 +1,39 @@
+/*!
+ *  @file CAKeyframeAnimation+Simplification.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+@import QuartzCore;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ *  @public
+ *  @category CAKeyframeAnimation_Simplification
+ *  @brief Removes the keyframes that the others interpolate closely enough.
+ *  @details See TimelineAnimationKeyframeSimplification.h.
+ *  @related CAKeyframeAnimation
+ */
+@interface CAKeyframeAnimation (Simplification)
+
+/// A copy of the animation without the keyframes that the kept ones linearly
+/// interpolate within `tolerance`, in the units of the values, at every time.
+/// The kept values are the original objects, and the first and last are always
+/// kept; `keyTimes` are set accordingly.
+///
+/// The values can be numbers, or values of CGPoint, CGSize, CGRect,
+/// CGAffineTransform or CATransform3D, transforms being compared component by
+/// component. Animations along a `path`, with per keyframe `timingFunctions`,
+/// a calculation mode other than linear, or other values are copied unchanged.
+///
+/// @param removedKeyframeCount set to how many keyframes were removed, if not NULL.
+- (instancetype)simplifiedAnimationWithTolerance:(CGFloat)tolerance
+                            removedKeyframeCount:(nullable NSUInteger *)removedKeyframeCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,120 @@
+/*!
+ *  @file CAKeyframeAnimation+Simplification.m
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#import "CAKeyframeAnimation+Simplification.h"
+#import "CAKeyframeAnimation+SpecialEasing.h"
+#import "TimelineAnimationKeyframeSimplification.h"
+#import "PrivateTypes.h"
+#include <string.h>
+
+/// The number of components of `value`, all of the values having to be of the
+/// same kind, 0 if they cannot be simplified.
+static size_t __components(id value) {
+    if ([value isKindOfClass:[NSNumber class]]) {
+        return 1;
+    }
+    guard ([value isKindOfClass:[NSValue class]]) else { return 0; }
+    const char *const type = [(NSValue *)value objCType];
+    if (strcmp(type, @encode(CGPoint)) == 0 || strcmp(type, @encode(CGSize)) == 0) {
+        return 2;
+    }
+    if (strcmp(type, @encode(CGRect)) == 0) {
+        return 4;
+    }
+    if (strcmp(type, @encode(CGAffineTransform)) == 0) {
+        return 6;
+    }
+    if (strcmp(type, @encode(CATransform3D)) == 0) {
+        return 16;
+    }
+    return 0;
+}
+
+/// Writes the components of `value` in `components`.
+static void __valueComponents(id value, size_t count, CGFloat *components) {
+    if (count == 1) {
+        components[0] = (CGFloat)[(NSNumber *)value doubleValue];
+        return;
+    }
+    // the structures above are made of count CGFloats
+    [(NSValue *)value getValue:components];
+}
+
+@implementation CAKeyframeAnimation (Simplification)
+
+- (instancetype)simplifiedAnimationWithTolerance:(CGFloat)tolerance
+                            removedKeyframeCount:(NSUInteger *)removedKeyframeCount {
+    NSParameterAssert(tolerance >= 0);
+
+    CAKeyframeAnimation *const simplified = [self copy];
+    [simplified materializeValues];
+    if (removedKeyframeCount != NULL) {
+        *removedKeyframeCount = 0;
+    }
+
+    NSArray *const values = simplified.values;
+    NSArray<NSNumber *> *const keyTimes = simplified.keyTimes;
+    const size_t keyframeCount = (size_t)values.count;
+    guard (keyframeCount > 2) else { return simplified; }
+    guard (simplified.path == NULL) else { return simplified; }
+    guard (simplified.timingFunctions.count == 0) else { return simplified; }
+    guard (simplified.calculationMode == nil || [simplified.calculationMode isEqualToString:kCAAnimationLinear]) else { return simplified; }
+    guard (keyTimes == nil || keyTimes.count == values.count) else { return simplified; }
+
+    const size_t dimensions = __components(values.firstObject);
+    guard (dimensions != 0) else { return simplified; }
+
+    double *const planes = (double *)malloc(sizeof(double) * (dimensions + 1) * keyframeCount);
+    size_t *const indices = (size_t *)malloc(sizeof(size_t) * keyframeCount);
+    guard (planes != NULL && indices != NULL) else {
+        free(indices);
+        free(planes);
+        return simplified;
+    }
+    double *const times = (keyTimes != nil) ? planes + dimensions * keyframeCount : NULL;
+
+    CGFloat components[16];
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+        id const value = values[frame];
+        guard (__components(value) == dimensions) else {
+            free(indices);
+            free(planes);
+            return simplified;
+        }
+        __valueComponents(value, dimensions, components);
+        for (size_t component = 0; component < dimensions; ++component) {
+            planes[component * keyframeCount + frame] = (double)components[component];
+        }
+        if (times != NULL) {
+            times[frame] = keyTimes[frame].doubleValue;
+        }
+    }
+
+    const size_t keptCount = TimelineAnimationKeyframeSimplify(times, planes, keyframeCount, dimensions,
+                                                               (double)tolerance, indices);
+    if (keptCount != 0 && keptCount < keyframeCount) {
+        NSMutableArray *const keptValues = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keptCount];
+        NSMutableArray<NSNumber *> *const keptTimes = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keptCount];
+        for (size_t k = 0; k < keptCount; ++k) {
+            const size_t frame = indices[k];
+            [keptValues addObject:values[frame]];
+            [keptTimes addObject:(keyTimes != nil) ? keyTimes[frame] : @((double)frame / (double)(keyframeCount - 1))];
+        }
+        simplified.values = [keptValues copy];
+        simplified.keyTimes = [keptTimes copy];
+        if (removedKeyframeCount != NULL) {
+            *removedKeyframeCount = (NSUInteger)(keyframeCount - keptCount);
+        }
+    }
+    free(indices);
+    free(planes);
+    return simplified;
+}
+
+@end
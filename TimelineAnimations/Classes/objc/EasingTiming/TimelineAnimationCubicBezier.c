@@ -0,0 +1,222 @@
+/*!
+ *  @file TimelineAnimationCubicBezier.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include "TimelineAnimationCubicBezier.h"
+
+// Newton-Raphson converges in 2-4 iterations from a good guess, more means
+// the slope is too flat and bisection takes over
+#define TA_NEWTON_ITERATIONS 8
+#define TA_NEWTON_MIN_SLOPE 1e-6
+#define TA_BISECTION_ITERATIONS 64
+
+#define TA_BEZIER(x1, y1, x2, y2) { (float)(x1), (float)(y1), (float)(x2), (float)(y2) }
+#define TA_NOT_BEZIER { NAN, NAN, NAN, NAN }
+
+// Same order and values as +[EasingTimingHandler functionWithType:]
+const TimelineAnimationCubicBezierControlPoints TimelineAnimationCubicBezierControlPointsTable[TimelineAnimationCubicBezierControlPointsCount] = {
+    TA_BEZIER(0.25, 0.1, 0.25, 1),      // Default, kCAMediaTimingFunctionDefault
+    TA_BEZIER(0, 0, 1, 1),              // Linear, kCAMediaTimingFunctionLinear
+    TA_BEZIER(0.42, 0, 1, 1),           // EaseIn, kCAMediaTimingFunctionEaseIn
+    TA_BEZIER(0, 0, 0.58, 1),           // EaseOut, kCAMediaTimingFunctionEaseOut
+    TA_BEZIER(0.42, 0, 0.58, 1),        // EaseInOut, kCAMediaTimingFunctionEaseInEaseOut
+
+    TA_BEZIER(0.45, 0, 0.745, 0.715),   // SineIn
+    TA_BEZIER(0.39, 0.575, 0.565, 1),   // SineOut
+    TA_BEZIER(0.445, 0.05, 0.55, 0.95), // SineInOut
+
+    TA_BEZIER(0.55, 0.085, 0.68, 0.53), // QuadIn
+    TA_BEZIER(0.25, 0.46, 0.45, 0.94),  // QuadOut
+    TA_BEZIER(0.455, 0.03, 0.515, 0.955), // QuadInOut
+
+    TA_BEZIER(0.55, 0.055, 0.675, 0.19), // CubicIn
+    TA_BEZIER(0.215, 0.61, 0.355, 1),   // CubicOut
+    TA_BEZIER(0.645, 0.045, 0.355, 1),  // CubicInOut
+
+    TA_BEZIER(0.895, 0.03, 0.685, 0.22), // QuartIn
+    TA_BEZIER(0.165, 0.84, 0.44, 1),    // QuartOut
+    TA_BEZIER(0.77, 0, 0.175, 1),       // QuartInOut
+
+    TA_BEZIER(0.755, 0.05, 0.855, 0.06), // QuintIn
+    TA_BEZIER(0.23, 1, 0.32, 1),        // QuintOut
+    TA_BEZIER(0.86, 0, 0.07, 1),        // QuintInOut
+
+    TA_BEZIER(0.95, 0.05, 0.795, 0.035), // ExpoIn
+    TA_BEZIER(0.19, 1, 0.22, 1),        // ExpoOut
+    TA_BEZIER(1, 0, 0, 1),              // ExpoInOut
+
+    TA_BEZIER(0.6, 0.04, 0.98, 0.335),  // CircIn
+    TA_BEZIER(0.075, 0.82, 0.165, 1),   // CircOut
+    TA_BEZIER(0.785, 0.135, 0.15, 0.86), // CircInOut
+
+    TA_BEZIER(0.6, -0.28, 0.735, 0.045), // BackIn
+    TA_BEZIER(0.175, 0.885, 0.32, 1.275), // BackOut
+    TA_BEZIER(0.68, -0.55, 0.265, 1.55), // BackInOut
+
+    TA_NOT_BEZIER,                      // ElasticIn
+    TA_NOT_BEZIER,                      // ElasticOut
+    TA_NOT_BEZIER,                      // ElasticInOut
+    TA_NOT_BEZIER,                      // BounceIn
+    TA_NOT_BEZIER,                      // BounceOut
+    TA_NOT_BEZIER,                      // BounceInOut
+};
+
+int TimelineAnimationCubicBezierControlPointsFor(unsigned long timingFunction,
+                                                 TimelineAnimationCubicBezierControlPoints *points)
+{
+    if (timingFunction >= TimelineAnimationCubicBezierControlPointsCount) {
+        return 0;
+    }
+    const TimelineAnimationCubicBezierControlPoints entry = TimelineAnimationCubicBezierControlPointsTable[timingFunction];
+    if (isnan(entry.x1)) {
+        return 0;
+    }
+    *points = entry;
+    return 1;
+}
+
+// MARK: - Solver
+
+static inline double TimelineAnimationCubicBezierX(const TimelineAnimationCubicBezier *bezier, double t)
+{
+    return ((bezier->ax * t + bezier->bx) * t + bezier->cx) * t;
+}
+
+static inline double TimelineAnimationCubicBezierY(const TimelineAnimationCubicBezier *bezier, double t)
+{
+    return ((bezier->ay * t + bezier->by) * t + bezier->cy) * t;
+}
+
+static inline double TimelineAnimationCubicBezierSlopeX(const TimelineAnimationCubicBezier *bezier, double t)
+{
+    return (3.0 * bezier->ax * t + 2.0 * bezier->bx) * t + bezier->cx;
+}
+
+void TimelineAnimationCubicBezierInit(TimelineAnimationCubicBezier *bezier,
+                                      TimelineAnimationCubicBezierControlPoints points,
+                                      int useSampleTable)
+{
+    // the polynomial coefficients, the end points are (0, 0) and (1, 1)
+    bezier->cx = 3.0 * (double)points.x1;
+    bezier->bx = 3.0 * ((double)points.x2 - (double)points.x1) - bezier->cx;
+    bezier->ax = 1.0 - bezier->cx - bezier->bx;
+
+    bezier->cy = 3.0 * (double)points.y1;
+    bezier->by = 3.0 * ((double)points.y2 - (double)points.y1) - bezier->cy;
+    bezier->ay = 1.0 - bezier->cy - bezier->by;
+
+    bezier->hasSamples = useSampleTable;
+    if (useSampleTable) {
+        for (int i = 0; i <= TimelineAnimationCubicBezierSampleIntervals; ++i) {
+            bezier->samples[i] = TimelineAnimationCubicBezierX(bezier, (double)i / TimelineAnimationCubicBezierSampleIntervals);
+        }
+    }
+}
+
+// Returns the parameter of the curve whose x is `x`
+static inline double TimelineAnimationCubicBezierSolveX(const TimelineAnimationCubicBezier *bezier,
+                                                        double x,
+                                                        double guess,
+                                                        double epsilon)
+{
+    double low = 0.0;
+    double high = 1.0;
+    double t = guess;
+
+    if (bezier->hasSamples) {
+        // the x of the control points is within [0, 1], so the samples are
+        // increasing and bracket the solution
+        int i = 1;
+        while (i < TimelineAnimationCubicBezierSampleIntervals && bezier->samples[i] <= x) {
+            ++i;
+        }
+        const double x0 = bezier->samples[i - 1];
+        const double x1 = bezier->samples[i];
+        low = (double)(i - 1) / TimelineAnimationCubicBezierSampleIntervals;
+        high = (double)i / TimelineAnimationCubicBezierSampleIntervals;
+        if (guess < low || guess > high) {
+            t = (x1 > x0) ? low + (x - x0) / (x1 - x0) * (high - low) : low;
+        }
+    }
+
+    for (int i = 0; i < TA_NEWTON_ITERATIONS; ++i) {
+        const double error = TimelineAnimationCubicBezierX(bezier, t) - x;
+        if (fabs(error) < epsilon) {
+            return t;
+        }
+        const double slope = TimelineAnimationCubicBezierSlopeX(bezier, t);
+        if (fabs(slope) < TA_NEWTON_MIN_SLOPE) {
+            break;
+        }
+        t -= error / slope;
+        if (!(t >= low && t <= high)) {
+            break;
+        }
+    }
+
+    t = 0.5 * (low + high);
+    for (int i = 0; i < TA_BISECTION_ITERATIONS; ++i) {
+        const double value = TimelineAnimationCubicBezierX(bezier, t);
+        if (fabs(value - x) < epsilon) {
+            return t;
+        }
+        if (x > value) {
+            low = t;
+        }
+        else {
+            high = t;
+        }
+        t = 0.5 * (low + high);
+    }
+    return t;
+}
+
+static inline double TimelineAnimationCubicBezierSolveFrom(const TimelineAnimationCubicBezier *bezier,
+                                                           double x,
+                                                           double guess,
+                                                           double epsilon,
+                                                           double *parameter)
+{
+    if (!(x > 0.0)) {
+        *parameter = 0.0;
+        return 0.0;
+    }
+    if (x >= 1.0) {
+        *parameter = 1.0;
+        return 1.0;
+    }
+    const double t = TimelineAnimationCubicBezierSolveX(bezier, x, guess, epsilon);
+    *parameter = t;
+    return TimelineAnimationCubicBezierY(bezier, t);
+}
+
+double TimelineAnimationCubicBezierSolve(const TimelineAnimationCubicBezier *bezier,
+                                         double x,
+                                         double epsilon)
+{
+    double t;
+    // x is a fair first guess, the curve is close to the diagonal in x
+    return TimelineAnimationCubicBezierSolveFrom(bezier, x, x, epsilon, &t);
+}
+
+void TimelineAnimationCubicBezierSolveBatch(const TimelineAnimationCubicBezier *bezier,
+                                            const double *in,
+                                            double *out,
+                                            size_t n,
+                                            double epsilon)
+{
+    double previousX = -1.0;
+    double previousT = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        const double x = in[i];
+        const double guess = (x >= previousX) ? previousT : x;
+        out[i] = TimelineAnimationCubicBezierSolveFrom(bezier, x, guess, epsilon, &previousT);
+        previousX = x;
+    }
+}
@@ -0,0 +1,84 @@
+/*!
+ *  @file TimelineAnimationCubicBezier.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_CUBIC_BEZIER_H
+#define TIMELINE_ANIMATIONS_CUBIC_BEZIER_H
+
+#include <stddef.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    /// The default precision of the solver, in progress units.
+    #define TimelineAnimationCubicBezierDefaultEpsilon 1e-7
+
+    /// The number of intervals of the optional sample table.
+    #define TimelineAnimationCubicBezierSampleIntervals 16
+
+    /// The control points of a timing curve going from (0, 0) to (1, 1), like
+    /// `-[CAMediaTimingFunction functionWithControlPoints::::]`. They are
+    /// `float` as Core Animation stores them.
+    typedef struct {
+        float x1, y1, x2, y2;
+    } TimelineAnimationCubicBezierControlPoints;
+
+    /// The number of entries of TimelineAnimationCubicBezierControlPointsTable,
+    /// one per ECustomTimingFunction value.
+    #define TimelineAnimationCubicBezierControlPointsCount 35
+
+    /// The control points of every ECustomTimingFunction, indexed by its raw
+    /// value. The first five are the ones of the named Core Animation
+    /// functions. The Elastic and Bounce entries are NaN, they are not Bézier
+    /// curves.
+    extern const TimelineAnimationCubicBezierControlPoints TimelineAnimationCubicBezierControlPointsTable[TimelineAnimationCubicBezierControlPointsCount];
+
+    /// Copies the control points of the ECustomTimingFunction `timingFunction`
+    /// in `points`. Returns 0 if it is not a Bézier curve.
+    int TimelineAnimationCubicBezierControlPointsFor(unsigned long timingFunction,
+                                                     TimelineAnimationCubicBezierControlPoints *points);
+
+    /// A timing curve ready to be solved. Initialise it with
+    /// TimelineAnimationCubicBezierInit(), it can then be used from any
+    /// thread.
+    typedef struct {
+        double ax, bx, cx;
+        double ay, by, cy;
+        int hasSamples;
+        /// The x of the curve at evenly spaced values of its parameter.
+        double samples[TimelineAnimationCubicBezierSampleIntervals + 1];
+    } TimelineAnimationCubicBezier;
+
+    /// Prepares `bezier` for `points`. With `useSampleTable` the x of the
+    /// curve is tabulated, which gives the solver a closer first guess at the
+    /// cost of 17 evaluations up front.
+    void TimelineAnimationCubicBezierInit(TimelineAnimationCubicBezier *bezier,
+                                          TimelineAnimationCubicBezierControlPoints points,
+                                          int useSampleTable);
+
+    /// Returns the progress of the curve at time `x`. The curve is solved
+    /// until its x is within `epsilon` of `x`, which is clamped to [0, 1].
+    double TimelineAnimationCubicBezierSolve(const TimelineAnimationCubicBezier *bezier,
+                                             double x,
+                                             double epsilon);
+
+    /// Solves the curve for `n` times. `in` and `out` may be the same buffer.
+    /// Increasing times, as when sampling keyframes, start from the previous
+    /// solution and converge faster.
+    void TimelineAnimationCubicBezierSolveBatch(const TimelineAnimationCubicBezier *bezier,
+                                                const double *in,
+                                                double *out,
+                                                size_t n,
+                                                double epsilon);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
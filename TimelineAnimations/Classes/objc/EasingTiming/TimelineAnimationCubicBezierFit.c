@@ -0,0 +1,472 @@
+/*!
+ *  @file TimelineAnimationCubicBezierFit.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include "TimelineAnimationCubicBezierFit.h"
+
+// The times the squared error is minimised at
+#define TA_FIT_SAMPLES 64
+
+// The times the error of a fit is measured at
+#define TA_FIT_ERROR_SAMPLES 1024
+
+// The x of the control points is searched on a grid first, then refined
+#define TA_FIT_GRID 10
+#define TA_FIT_REFINE_ITERATIONS 200
+
+// Segment ends are searched by bisection down to this width
+#define TA_FIT_SPLIT_ITERATIONS 24
+
+typedef struct {
+    TimelineAnimationSpecialTimingFunction function;
+    double start, end;
+    double y0, y3;
+    double times[TA_FIT_SAMPLES];
+    double values[TA_FIT_SAMPLES];
+} TimelineAnimationCubicBezierFitProblem;
+
+// MARK: - Curve
+
+// The parameter of a Bézier curve going from 0 to 1 in x with inner control
+// points at u1 and u2, at which it is at x
+static double TimelineAnimationCubicBezierFitParameter(double u1, double u2, double x)
+{
+    // x(t) = ((a t + b) t + c) t
+    const double c = 3.0 * u1;
+    const double b = 3.0 * (u2 - u1) - c;
+    const double a = 1.0 - c - b;
+    double low = 0.0;
+    double high = 1.0;
+    double t = x;
+    for (int i = 0; i < 32; ++i) {
+        const double value = ((a * t + b) * t + c) * t - x;
+        if (fabs(value) < 1e-14) {
+            return t;
+        }
+        if (value < 0.0) {
+            low = t;
+        }
+        else {
+            high = t;
+        }
+        const double slope = (3.0 * a * t + 2.0 * b) * t + c;
+        const double next = t - value / slope;
+        // Newton while it stays in the bracket, bisection otherwise
+        t = (slope > 1e-12 && next > low && next < high) ? next : 0.5 * (low + high);
+    }
+    return t;
+}
+
+double TimelineAnimationCubicBezierSegmentEvaluate(const TimelineAnimationCubicBezierSegment *segment, double x)
+{
+    const double width = segment->x3 - segment->x0;
+    if (!(width > 0.0)) {
+        return segment->y0;
+    }
+    const double u1 = (segment->x1 - segment->x0) / width;
+    const double u2 = (segment->x2 - segment->x0) / width;
+    double s = (x - segment->x0) / width;
+    s = (s < 0.0) ? 0.0 : (s > 1.0) ? 1.0 : s;
+    const double t = TimelineAnimationCubicBezierFitParameter(u1, u2, s);
+    const double u = 1.0 - t;
+    return u * u * u * segment->y0 + 3.0 * u * u * t * segment->y1 + 3.0 * u * t * t * segment->y2 + t * t * t * segment->y3;
+}
+
+// MARK: - Fitting
+
+// The least squares y of the control points for x control points at u1 and u2.
+// Returns the squared error over the samples.
+static double TimelineAnimationCubicBezierFitSolve(const TimelineAnimationCubicBezierFitProblem *problem,
+                                                   double u1,
+                                                   double u2,
+                                                   double *y1,
+                                                   double *y2)
+{
+    double b11 = 0.0, b12 = 0.0, b22 = 0.0, r1 = 0.0, r2 = 0.0;
+    double t[TA_FIT_SAMPLES];
+    for (int i = 0; i < TA_FIT_SAMPLES; ++i) {
+        t[i] = TimelineAnimationCubicBezierFitParameter(u1, u2, problem->times[i]);
+        const double u = 1.0 - t[i];
+        const double basis1 = 3.0 * u * u * t[i];
+        const double basis2 = 3.0 * u * t[i] * t[i];
+        const double rest = problem->values[i] - (u * u * u * problem->y0 + t[i] * t[i] * t[i] * problem->y3);
+        b11 += basis1 * basis1;
+        b12 += basis1 * basis2;
+        b22 += basis2 * basis2;
+        r1 += basis1 * rest;
+        r2 += basis2 * rest;
+    }
+    const double determinant = b11 * b22 - b12 * b12;
+    if (fabs(determinant) < 1e-300) {
+        *y1 = problem->y0 + (problem->y3 - problem->y0) / 3.0;
+        *y2 = problem->y0 + 2.0 * (problem->y3 - problem->y0) / 3.0;
+    }
+    else {
+        *y1 = (r1 * b22 - r2 * b12) / determinant;
+        *y2 = (r2 * b11 - r1 * b12) / determinant;
+    }
+
+    double squared = 0.0;
+    for (int i = 0; i < TA_FIT_SAMPLES; ++i) {
+        const double u = 1.0 - t[i];
+        const double value = u * u * u * problem->y0 + 3.0 * u * u * t[i] * *y1 + 3.0 * u * t[i] * t[i] * *y2
+            + t[i] * t[i] * t[i] * problem->y3;
+        squared += (value - problem->values[i]) * (value - problem->values[i]);
+    }
+    return squared;
+}
+
+static inline double TimelineAnimationCubicBezierFitClamp(double u)
+{
+    return (u < 0.0) ? 0.0 : (u > 1.0) ? 1.0 : u;
+}
+
+static double TimelineAnimationCubicBezierFitCost(const TimelineAnimationCubicBezierFitProblem *problem, const double u[2])
+{
+    double y1, y2;
+    return TimelineAnimationCubicBezierFitSolve(problem, u[0], u[1], &y1, &y2);
+}
+
+// Nelder-Mead over the x of the control points, kept within [0, 1]
+static void TimelineAnimationCubicBezierFitRefine(const TimelineAnimationCubicBezierFitProblem *problem, double best[2])
+{
+    double simplex[3][2] = {
+        { best[0], best[1] },
+        { TimelineAnimationCubicBezierFitClamp(best[0] + 0.05), best[1] },
+        { best[0], TimelineAnimationCubicBezierFitClamp(best[1] + 0.05) },
+    };
+    double cost[3];
+    for (int i = 0; i < 3; ++i) {
+        cost[i] = TimelineAnimationCubicBezierFitCost(problem, simplex[i]);
+    }
+
+    for (int iteration = 0; iteration < TA_FIT_REFINE_ITERATIONS; ++iteration) {
+        // order the vertices, best first
+        for (int i = 0; i < 2; ++i) {
+            for (int j = i + 1; j < 3; ++j) {
+                if (cost[j] < cost[i]) {
+                    const double c = cost[i]; cost[i] = cost[j]; cost[j] = c;
+                    const double u0 = simplex[i][0]; simplex[i][0] = simplex[j][0]; simplex[j][0] = u0;
+                    const double u1 = simplex[i][1]; simplex[i][1] = simplex[j][1]; simplex[j][1] = u1;
+                }
+            }
+        }
+        if (fabs(simplex[2][0] - simplex[0][0]) + fabs(simplex[2][1] - simplex[0][1]) < 1e-10) {
+            break;
+        }
+
+        const double centroid[2] = {
+            0.5 * (simplex[0][0] + simplex[1][0]),
+            0.5 * (simplex[0][1] + simplex[1][1]),
+        };
+        double reflected[2];
+        for (int k = 0; k < 2; ++k) {
+            reflected[k] = TimelineAnimationCubicBezierFitClamp(2.0 * centroid[k] - simplex[2][k]);
+        }
+        const double reflectedCost = TimelineAnimationCubicBezierFitCost(problem, reflected);
+
+        if (reflectedCost < cost[0]) {
+            double expanded[2];
+            for (int k = 0; k < 2; ++k) {
+                expanded[k] = TimelineAnimationCubicBezierFitClamp(3.0 * centroid[k] - 2.0 * simplex[2][k]);
+            }
+            const double expandedCost = TimelineAnimationCubicBezierFitCost(problem, expanded);
+            const int expand = (expandedCost < reflectedCost);
+            simplex[2][0] = expand ? expanded[0] : reflected[0];
+            simplex[2][1] = expand ? expanded[1] : reflected[1];
+            cost[2] = expand ? expandedCost : reflectedCost;
+        }
+        else if (reflectedCost < cost[1]) {
+            simplex[2][0] = reflected[0];
+            simplex[2][1] = reflected[1];
+            cost[2] = reflectedCost;
+        }
+        else {
+            double contracted[2];
+            for (int k = 0; k < 2; ++k) {
+                contracted[k] = 0.5 * (centroid[k] + simplex[2][k]);
+            }
+            const double contractedCost = TimelineAnimationCubicBezierFitCost(problem, contracted);
+            if (contractedCost < cost[2]) {
+                simplex[2][0] = contracted[0];
+                simplex[2][1] = contracted[1];
+                cost[2] = contractedCost;
+            }
+            else {
+                // shrink towards the best vertex
+                for (int i = 1; i < 3; ++i) {
+                    simplex[i][0] = 0.5 * (simplex[0][0] + simplex[i][0]);
+                    simplex[i][1] = 0.5 * (simplex[0][1] + simplex[i][1]);
+                    cost[i] = TimelineAnimationCubicBezierFitCost(problem, simplex[i]);
+                }
+            }
+        }
+    }
+
+    const int first = (cost[0] <= cost[1] && cost[0] <= cost[2]) ? 0 : (cost[1] <= cost[2]) ? 1 : 2;
+    best[0] = simplex[first][0];
+    best[1] = simplex[first][1];
+}
+
+static void TimelineAnimationCubicBezierFitMeasure(TimelineAnimationSpecialTimingFunction function,
+                                                   const TimelineAnimationCubicBezierSegment *segment,
+                                                   TimelineAnimationCubicBezierFitError *error)
+{
+    double maximum = 0.0;
+    double squared = 0.0;
+    for (int i = 0; i <= TA_FIT_ERROR_SAMPLES; ++i) {
+        const double x = segment->x0 + (segment->x3 - segment->x0) * i / TA_FIT_ERROR_SAMPLES;
+        const double difference = fabs(TimelineAnimationCubicBezierSegmentEvaluate(segment, x) - function(x));
+        maximum = (difference > maximum) ? difference : maximum;
+        squared += difference * difference;
+    }
+    error->maximumError = maximum;
+    error->rmsError = sqrt(squared / (TA_FIT_ERROR_SAMPLES + 1));
+}
+
+int TimelineAnimationCubicBezierFitSegment(TimelineAnimationSpecialTimingFunction function,
+                                           double start,
+                                           double end,
+                                           TimelineAnimationCubicBezierSegment *segment,
+                                           TimelineAnimationCubicBezierFitError *error)
+{
+    if (!(end > start)) {
+        return 0;
+    }
+    TimelineAnimationCubicBezierFitProblem problem;
+    problem.function = function;
+    problem.start = start;
+    problem.end = end;
+    problem.y0 = function(start);
+    problem.y3 = function(end);
+    for (int i = 0; i < TA_FIT_SAMPLES; ++i) {
+        const double s = (i + 0.5) / TA_FIT_SAMPLES;
+        problem.times[i] = s;
+        problem.values[i] = function(start + (end - start) * s);
+    }
+
+    double best[2] = { 1.0 / 3.0, 2.0 / 3.0 };
+    double bestCost = TimelineAnimationCubicBezierFitCost(&problem, best);
+    for (int i = 0; i <= TA_FIT_GRID; ++i) {
+        for (int j = 0; j <= TA_FIT_GRID; ++j) {
+            const double u[2] = { (double)i / TA_FIT_GRID, (double)j / TA_FIT_GRID };
+            const double cost = TimelineAnimationCubicBezierFitCost(&problem, u);
+            if (cost < bestCost) {
+                bestCost = cost;
+                best[0] = u[0];
+                best[1] = u[1];
+            }
+        }
+    }
+    TimelineAnimationCubicBezierFitRefine(&problem, best);
+
+    double y1, y2;
+    TimelineAnimationCubicBezierFitSolve(&problem, best[0], best[1], &y1, &y2);
+    segment->x0 = start;
+    segment->y0 = problem.y0;
+    segment->x1 = start + (end - start) * best[0];
+    segment->y1 = y1;
+    segment->x2 = start + (end - start) * best[1];
+    segment->y2 = y2;
+    segment->x3 = end;
+    segment->y3 = problem.y3;
+
+    if (error != NULL) {
+        TimelineAnimationCubicBezierFitMeasure(function, segment, error);
+    }
+    return 1;
+}
+
+typedef struct {
+    TimelineAnimationCubicBezierSegment *segments;
+    size_t capacity;
+    size_t count;
+    double maximum;
+    double squared;
+} TimelineAnimationCubicBezierFitResult;
+
+// Splits [start, end] in as few segments as it finds within `tolerance`,
+// appending them to `result`. Returns 0 if they do not fit.
+static int TimelineAnimationCubicBezierFitInterval(TimelineAnimationSpecialTimingFunction function,
+                                                   double start,
+                                                   double end,
+                                                   double tolerance,
+                                                   TimelineAnimationCubicBezierFitResult *result)
+{
+    while (start < end) {
+        if (result->count == result->capacity) {
+            return 0;
+        }
+        TimelineAnimationCubicBezierSegment segment;
+        TimelineAnimationCubicBezierFitError segmentError;
+        TimelineAnimationCubicBezierFitSegment(function, start, end, &segment, &segmentError);
+
+        if (segmentError.maximumError > tolerance) {
+            // the furthest end that stays within the tolerance
+            double good = start;
+            double bad = end;
+            TimelineAnimationCubicBezierSegment candidate;
+            TimelineAnimationCubicBezierFitError candidateError;
+            for (int i = 0; i < TA_FIT_SPLIT_ITERATIONS; ++i) {
+                const double middle = 0.5 * (good + bad);
+                TimelineAnimationCubicBezierFitSegment(function, start, middle, &candidate, &candidateError);
+                if (candidateError.maximumError <= tolerance) {
+                    good = middle;
+                    segment = candidate;
+                    segmentError = candidateError;
+                }
+                else {
+                    bad = middle;
+                }
+            }
+            if (!(good > start)) {
+                return 0;
+            }
+        }
+
+        result->segments[result->count++] = segment;
+        result->maximum = (segmentError.maximumError > result->maximum) ? segmentError.maximumError : result->maximum;
+        result->squared += segmentError.rmsError * segmentError.rmsError * (segment.x3 - segment.x0);
+        start = segment.x3;
+    }
+    return 1;
+}
+
+static void TimelineAnimationCubicBezierFitReport(const TimelineAnimationCubicBezierFitResult *result,
+                                                  TimelineAnimationCubicBezierFitError *error)
+{
+    if (error != NULL) {
+        error->maximumError = result->maximum;
+        error->rmsError = sqrt(result->squared);
+    }
+}
+
+size_t TimelineAnimationCubicBezierFitSegments(TimelineAnimationSpecialTimingFunction function,
+                                               double tolerance,
+                                               TimelineAnimationCubicBezierSegment *segments,
+                                               size_t capacity,
+                                               TimelineAnimationCubicBezierFitError *error)
+{
+    TimelineAnimationCubicBezierFitResult result = { segments, capacity, 0, 0.0, 0.0 };
+    if (!TimelineAnimationCubicBezierFitInterval(function, 0.0, 1.0, tolerance, &result)) {
+        return 0;
+    }
+    TimelineAnimationCubicBezierFitReport(&result, error);
+    return result.count;
+}
+
+// MARK: - Extrema
+
+// The curve is sampled this many times to find where its slope changes sign
+#define TA_FIT_EXTREMA_GRID 4096
+
+// Golden section iterations locating an extremum within two grid steps
+#define TA_FIT_EXTREMA_ITERATIONS 64
+
+// Where `function` is largest (`sign` 1) or smallest (-1) in [low, high],
+// for a function with a single extremum there, kink or not.
+static double TimelineAnimationCubicBezierFitExtremum(TimelineAnimationSpecialTimingFunction function,
+                                                      double low,
+                                                      double high,
+                                                      double sign)
+{
+    const double ratio = 0.5 * (sqrt(5.0) - 1.0);
+    double a = high - ratio * (high - low);
+    double b = low + ratio * (high - low);
+    double fa = sign * function(a);
+    double fb = sign * function(b);
+    for (int i = 0; i < TA_FIT_EXTREMA_ITERATIONS && high - low > 1e-15; ++i) {
+        if (fa > fb) {
+            high = b;
+            b = a;
+            fb = fa;
+            a = high - ratio * (high - low);
+            fa = sign * function(a);
+        }
+        else {
+            low = a;
+            a = b;
+            fa = fb;
+            b = low + ratio * (high - low);
+            fb = sign * function(b);
+        }
+    }
+    return 0.5 * (low + high);
+}
+
+size_t TimelineAnimationCubicBezierFitExtrema(TimelineAnimationSpecialTimingFunction function,
+                                              double *extrema,
+                                              size_t capacity)
+{
+    const size_t n = TA_FIT_EXTREMA_GRID;
+    size_t count = 0;
+    const double first = function(0.0);
+    double current = function(1.0 / n);
+    // the direction the curve goes in, 0 while it is flat
+    double direction = (current > first) ? 1.0 : (current < first) ? -1.0 : 0.0;
+    for (size_t i = 1; i < n; ++i) {
+        const double next = function((double)(i + 1) / n);
+        const double step = (next > current) ? 1.0 : (next < current) ? -1.0 : 0.0;
+        if (step != 0.0 && direction != 0.0 && step != direction) {
+            if (count == capacity) {
+                return 0;
+            }
+            const double extremum = TimelineAnimationCubicBezierFitExtremum(function,
+                                                                            (double)(i - 1) / n,
+                                                                            (double)(i + 1) / n,
+                                                                            direction);
+            // never at the ends, nor twice
+            if (extremum > 0.0 && extremum < 1.0 && (count == 0 || extremum > extrema[count - 1])) {
+                extrema[count++] = extremum;
+            }
+        }
+        if (step != 0.0) {
+            direction = step;
+        }
+        current = next;
+    }
+    return count;
+}
+
+size_t TimelineAnimationCubicBezierFitExtremaSegments(TimelineAnimationSpecialTimingFunction function,
+                                                      double tolerance,
+                                                      TimelineAnimationCubicBezierSegment *segments,
+                                                      size_t capacity,
+                                                      TimelineAnimationCubicBezierFitError *error)
+{
+    double extrema[TimelineAnimationCubicBezierFitExtremaCapacity];
+    const size_t extremaCount = TimelineAnimationCubicBezierFitExtrema(function, extrema,
+                                                                       TimelineAnimationCubicBezierFitExtremaCapacity);
+    TimelineAnimationCubicBezierFitResult result = { segments, capacity, 0, 0.0, 0.0 };
+    double start = 0.0;
+    for (size_t i = 0; i <= extremaCount; ++i) {
+        const double end = (i < extremaCount) ? extrema[i] : 1.0;
+        if (!TimelineAnimationCubicBezierFitInterval(function, start, end, tolerance, &result)) {
+            return 0;
+        }
+        start = end;
+    }
+    TimelineAnimationCubicBezierFitReport(&result, error);
+    return result.count;
+}
+
+int TimelineAnimationCubicBezierSegmentControlPoints(const TimelineAnimationCubicBezierSegment *segment,
+                                                     TimelineAnimationCubicBezierControlPoints *points)
+{
+    const double width = segment->x3 - segment->x0;
+    const double height = segment->y3 - segment->y0;
+    if (!(width > 0.0) || height == 0.0) {
+        return 0;
+    }
+    points->x1 = (float)((segment->x1 - segment->x0) / width);
+    points->y1 = (float)((segment->y1 - segment->y0) / height);
+    points->x2 = (float)((segment->x2 - segment->x0) / width);
+    points->y2 = (float)((segment->y2 - segment->y0) / height);
+    return 1;
+}
@@ -0,0 +1,101 @@
+/*!
+ *  @file TimelineAnimationCubicBezierFit.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_CUBIC_BEZIER_FIT_H
+#define TIMELINE_ANIMATIONS_CUBIC_BEZIER_FIT_H
+
+#include <stddef.h>
+#include "TimelineAnimationCubicBezier.h"
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // Least-squares fitting of the timing functions with cubic Bézier curves,
+    // the representation Core Animation interpolates by itself. Fitting is
+    // slow, it is meant for tools and for tables built once.
+
+    /// A piece of cubic Bézier curve in the (time, progress) plane, between
+    /// (x0, y0) and (x3, y3). The x of its control points is within
+    /// [x0, x3], so that it is a function of time.
+    typedef struct {
+        double x0, y0;
+        double x1, y1;
+        double x2, y2;
+        double x3, y3;
+    } TimelineAnimationCubicBezierSegment;
+
+    /// How close a fit is to its function, over a dense grid of times.
+    typedef struct {
+        double maximumError;
+        double rmsError;
+    } TimelineAnimationCubicBezierFitError;
+
+    /// Fits `function` over [start, end] with a single segment through
+    /// (start, function(start)) and (end, function(end)), minimising the
+    /// squared error. Returns 0 if the interval is empty.
+    int TimelineAnimationCubicBezierFitSegment(TimelineAnimationSpecialTimingFunction function,
+                                               double start,
+                                               double end,
+                                               TimelineAnimationCubicBezierSegment *segment,
+                                               TimelineAnimationCubicBezierFitError *error);
+
+    /// Splits [0, 1] in as few segments as it finds whose maximum error is at
+    /// most `tolerance`: every segment is extended as far as it stays within
+    /// the tolerance. Writes at most `capacity` segments and the error of the
+    /// whole fit. Returns the number of segments, or 0 if `capacity` is not
+    /// enough.
+    size_t TimelineAnimationCubicBezierFitSegments(TimelineAnimationSpecialTimingFunction function,
+                                                   double tolerance,
+                                                   TimelineAnimationCubicBezierSegment *segments,
+                                                   size_t capacity,
+                                                   TimelineAnimationCubicBezierFitError *error);
+
+    /// The most extrema TimelineAnimationCubicBezierFitExtremaSegments()
+    /// looks for, more than the curves of TimelineAnimationSpecialTimingFunction.h
+    /// have.
+    #define TimelineAnimationCubicBezierFitExtremaCapacity 64
+
+    /// Writes the times in (0, 1) at which `function` turns, its local minima
+    /// and maxima, kinks included, ascending, and returns how many. Returns 0
+    /// if there are more than `capacity`. Turns closer than 1/2048 may be
+    /// missed.
+    size_t TimelineAnimationCubicBezierFitExtrema(TimelineAnimationSpecialTimingFunction function,
+                                                  double *extrema,
+                                                  size_t capacity);
+
+    /// Like TimelineAnimationCubicBezierFitSegments(), but the segments also
+    /// end at the extrema of `function`, so that each of them is monotonic and
+    /// its ends are the turning points of the curve: the oscillating curves,
+    /// Elastic and Bounce, become a keyframe per extremum with a cubic Bézier
+    /// timing function in between, which Core Animation interpolates itself.
+    /// A monotonic piece that a single segment is not within `tolerance` of is
+    /// split further. Returns 0 if `capacity` is not enough.
+    size_t TimelineAnimationCubicBezierFitExtremaSegments(TimelineAnimationSpecialTimingFunction function,
+                                                          double tolerance,
+                                                          TimelineAnimationCubicBezierSegment *segments,
+                                                          size_t capacity,
+                                                          TimelineAnimationCubicBezierFitError *error);
+
+    /// The progress of `segment` at `x`, within [x0, x3].
+    double TimelineAnimationCubicBezierSegmentEvaluate(const TimelineAnimationCubicBezierSegment *segment, double x);
+
+    /// The control points of `segment` once stretched to go from (0, 0) to
+    /// (1, 1), for CAMediaTimingFunction; the key times and values of a
+    /// keyframe animation give back its ends. Returns 0 if the segment starts
+    /// and ends at the same progress and cannot be stretched.
+    int TimelineAnimationCubicBezierSegmentControlPoints(const TimelineAnimationCubicBezierSegment *segment,
+                                                         TimelineAnimationCubicBezierControlPoints *points);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
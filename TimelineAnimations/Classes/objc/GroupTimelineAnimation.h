@@ -210,6 +210,9 @@ NS_ASSUME_NONNULL_BEGIN
            onStartBlocks:(nullable NSArray<TimelineAnimationOnStartBlock> *)onStartBlocks
         completionBlocks:(nullable NSArray<TimelineAnimationCompletionBlock> *)completionBlocks NS_UNAVAILABLE;
 
+- (BOOL)performBatchUpdates:(NS_NOESCAPE TimelineAnimationVoidBlock)updates
+                      error:(NSError *__autoreleasing _Nullable *_Nullable)error NS_UNAVAILABLE;
+
 - (NSArray<__kindof CAPropertyAnimation *> *)animationsBeginingAtTime:(RelativeTime)time NS_UNAVAILABLE;
 - (NSArray<__kindof CAPropertyAnimation *> *)animationsOngoingAtTime:(RelativeTime)time NS_UNAVAILABLE;
 
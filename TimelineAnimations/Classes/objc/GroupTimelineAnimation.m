@@ -15,6 +15,7 @@
 #import "NSArray+TimelineSwiftyAdditions.h"
 #import "NSSet+TimelineSwiftyAdditions.h"
 #import "PrivateTypes.h"
+#import "TimelineAnimationIntervalIndex.h"
 
 @interface GroupTimelineAnimation ()
 @property (nonatomic, strong) TimelineAnimation *helperTimeline;
@@ -187,12 +188,13 @@
         entity.timeline.beginTime += delay;
     };
 
-    RelativeTime newBeginTime = self.beginTime;
+    const TimelineTicks delayTicks = TimelineTicksFromTime(delay);
+    const TimelineTicks newBeginTicks = TimelineTicksFromTime(self.beginTime);
     // calculate notification time changes
     self.timeNotificationAssociations = [self timeNotificationConvertedUsing:^RelativeTimeNumber * _Nonnull(RelativeTimeNumber * _Nonnull key) {
-        RelativeTime new = Round(key.doubleValue + delay);
-        if (new <= newBeginTime) {
-            new = newBeginTime + TimelineAnimationMillisecond;
+        TimelineTicks new = key.longLongValue + delayTicks;
+        if (new <= newBeginTicks) {
+            new = newBeginTicks + TimelineTicksPerMillisecond;
         }
         return @(new);
     }];
@@ -288,11 +290,48 @@
     return tl;
 }
 
+/// Whether an entity of `entities` may conflict with one of `otherEntities`,
+/// by a sweep over both sorted by their conflict keys and begin times.
+/// YES if memory runs out.
+- (BOOL)_entities:(NSArray<TimelineEntity *> *)entities mayConflictWithEntities:(NSArray<TimelineEntity *> *)otherEntities {
+    guard (entities.count > 0 && otherEntities.count > 0) else { return NO; }
+
+    TimelineAnimationInterval *const intervals = malloc(sizeof(TimelineAnimationInterval) * (entities.count + otherEntities.count));
+    guard (intervals != NULL) else { return YES; }
+
+    NSMutableDictionary<NSString *, NSNumber *> *const keys = [[NSMutableDictionary alloc] init];
+    __block size_t count = 0;
+    void (^const addIntervals)(NSArray<TimelineEntity *> *) = ^(NSArray<TimelineEntity *> *array) {
+        for (TimelineEntity *const entity in array) {
+            NSString *const key = entity.conflictKey;
+            NSNumber *number = keys[key];
+            if (number == nil) {
+                number = @(keys.count);
+                keys[key] = number;
+            }
+            const TimelineAnimationInterval interval = {
+                number.unsignedIntegerValue, entity.beginTicks, entity.endTicks,
+            };
+            intervals[count++] = interval;
+        }
+    };
+    addIntervals(entities);
+    addIntervals(otherEntities);
+
+    const BOOL conflicting = TimelineAnimationIntervalsConflict(intervals, entities.count,
+                                                                intervals + entities.count, otherEntities.count);
+    free(intervals);
+    return conflicting;
+}
+
 - (void)_checkForConflictsWithEntity:(GroupTimelineEntity *)entity {
     @autoreleasepool {
         NSArray<TimelineEntity *> *const myEntities = [self _entitiesOfTimelineAnimation:self];
 
         NSArray<TimelineEntity *> *const otherEntities = [self _entitiesOfTimelineAnimation:entity.timeline];
+        // the sweep rules out a conflict in O(n log n), if it finds one every
+        // pair is checked for the one to report
+        guard ([self _entities:otherEntities mayConflictWithEntities:myEntities]) else { return; }
         [otherEntities enumerateObjectsUsingBlock:^(TimelineEntity * _Nonnull otherEntity, NSUInteger idx, BOOL * _Nonnull stop) {
             [myEntities enumerateObjectsUsingBlock:^(TimelineEntity * _Nonnull myEntity, NSUInteger idx2, BOOL * _Nonnull stop2) {
                 BOOL conflicting = [otherEntity conflictingWith:myEntity];
@@ -579,6 +618,12 @@
     [self __raiseUnsupportedMessageExceptionWithSelector:_cmd];
 }
 
+- (BOOL)performBatchUpdates:(NS_NOESCAPE TimelineAnimationVoidBlock)updates
+                      error:(NSError *__autoreleasing _Nullable *_Nullable)error {
+    [self __raiseUnsupportedMessageExceptionWithSelector:_cmd];
+    return NO;
+}
+
 #pragma mark - Group
 
 - (void)addTimelineAnimation:(__kindof TimelineAnimation *)timelineAnimation {
@@ -912,9 +957,10 @@
     NSMutableArray<GroupTimelineEntity *> *const updatedEntities = [[NSMutableArray alloc] initWithCapacity:sortedEntities.count];
     const NSTimeInterval newTimelineDuration = duration;
     const NSTimeInterval oldTimelineDuration = currentDuration;
+    const TimelineTicks beginTicks = TimelineTicksFromTime(self.beginTime);
     for (GroupTimelineEntity *const entity in sortedEntities) {
         // adjust if the entity's .beginTime is not the same as the timeline's .beginTime
-        BOOL adjust = fabs((double)(entity.beginTime - self.beginTime)) > TimelineAnimationMillisecond;
+        BOOL adjust = (TimelineTicksFromTime(entity.beginTime) != beginTicks);
         const NSTimeInterval newDuration = newTimelineDuration * entity.timeline.duration / oldTimelineDuration;
         GroupTimelineEntity *const updatedEntity = [entity copyWithDuration:newDuration
                                                       shouldAdjustBeginTime:adjust
@@ -934,22 +980,16 @@
 
     // calculate notification time changes
     const double factor = duration / currentDuration;
+    const TimelineTicks millisecond = TimelineTicksFromTime(TimelineAnimationMillisecond);
+    const TimelineTicks frame = TimelineTicksFromTime(TimelineAnimationOneFrame);
     updatedTimeline.timeNotificationAssociations = [self timeNotificationConvertedUsing:^RelativeTimeNumber * _Nonnull(RelativeTimeNumber * _Nonnull key) {
-        double value = key.doubleValue;
-        if ((value == TimelineAnimationMillisecond)
-            || (fabs((double)(value - TimelineAnimationMillisecond)) < 0.001)) {
-            return @(TimelineAnimationMillisecond);
-        }
-        // if around one frame time
-        if ((value == TimelineAnimationOneFrame)
-            || (fabs((double)(value - TimelineAnimationOneFrame)) < 0.001)) {
-            return @(TimelineAnimationOneFrame);
-        }
-        value *= factor;
-        if (value < TimelineAnimationMillisecond) {
-            value = TimelineAnimationMillisecond;
+        const TimelineTicks ticks = key.longLongValue;
+        // if at one millisecond or one frame time
+        if (ticks == millisecond || ticks == frame) {
+            return key;
         }
-        return @(Round(value));
+        const TimelineTicks value = TimelineTicksFromTime(TimelineTimeFromTicks(ticks) * factor);
+        return @(MAX(value, millisecond));
     }];
     return updatedTimeline;
 }
@@ -1126,8 +1166,9 @@
 }
 
 - (NSSet<__kindof TimelineAnimation *> *)timelineAnimationsBeginingAtTime:(RelativeTime)time {
+    const TimelineTicks ticks = TimelineTicksFromTime(time);
     NSSet<GroupTimelineEntity *> *const entities = [_timelinesEntities objectsPassingTest:^BOOL(GroupTimelineEntity * _Nonnull entity, BOOL * _Nonnull stop) {
-        return (entity.beginTime == time);
+        return (TimelineTicksFromTime(entity.beginTime) == ticks);
     }];
 
     NSMutableSet<__kindof TimelineAnimation *> *const timelines = [[NSMutableSet alloc] initWithCapacity:entities.count];
@@ -1138,8 +1179,9 @@
 }
 
 - (NSSet<__kindof TimelineAnimation *> *)timelineAnimationsOngoingAtTime:(RelativeTime)time {
+    const TimelineTicks ticks = TimelineTicksFromTime(time);
     NSSet<GroupTimelineEntity *> *const entities = [_timelinesEntities objectsPassingTest:^BOOL(GroupTimelineEntity * _Nonnull entity, BOOL * _Nonnull stop) {
-        return (time >= entity.beginTime) && (time <= entity.endTime);
+        return (ticks >= TimelineTicksFromTime(entity.beginTime)) && (ticks <= TimelineTicksFromTime(entity.endTime));
     }];
 
     NSMutableSet<__kindof TimelineAnimation *> *const timelines = [[NSMutableSet alloc] initWithCapacity:entities.count];
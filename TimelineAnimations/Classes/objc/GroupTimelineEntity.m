@@ -138,7 +138,7 @@
         entity.timeline.beginTime = totalBeginTime + ((self.timeline.beginTime - totalBeginTime) * factor);
     }
     if (newDuration < TimelineAnimationMillisecond) {
-        NSAssert((NSInteger)Round(entity.timeline.duration) == (NSInteger)Round(TimelineAnimationMillisecond),
+        NSAssert((NSInteger)entity.timeline.duration == (NSInteger)TimelineAnimationMillisecond,
                  @"TimelineAnimations: Something is wrong with the timeline's duration.");
         entity.timeline.beginTime = MAX(entity.beginTime - TimelineAnimationMillisecond, 0);
     }
@@ -0,0 +1,345 @@
+/*!
+ *  @file TimelineAnimationIntervalIndex.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <stdlib.h>
+#include "TimelineAnimationIntervalIndex.h"
+
+// Nodes are numbered from 1, node 0 standing for no node, with the earliest
+// latest end time, so that it needs no test.
+typedef struct {
+    int64_t begin;
+    int64_t end;
+    /// The latest end time of the node and the nodes below it.
+    int64_t latestEnd;
+    uint32_t priority;
+    size_t left;
+    size_t right;
+} TimelineAnimationIntervalNode;
+
+struct TimelineAnimationIntervalIndex {
+    TimelineAnimationIntervalNode *nodes;
+    size_t count;
+    size_t capacity;
+    /// The root of the treap of each key, 0 if it has none.
+    size_t *roots;
+    size_t keyCapacity;
+    uint32_t seed;
+};
+
+TimelineAnimationIntervalIndex *TimelineAnimationIntervalIndexCreate(void)
+{
+    TimelineAnimationIntervalIndex *const index = (TimelineAnimationIntervalIndex *)calloc(1, sizeof(TimelineAnimationIntervalIndex));
+    if (index == NULL) {
+        return NULL;
+    }
+    index->capacity = 64;
+    index->nodes = (TimelineAnimationIntervalNode *)malloc(sizeof(TimelineAnimationIntervalNode) * (index->capacity + 1));
+    if (index->nodes == NULL) {
+        free(index);
+        return NULL;
+    }
+    const TimelineAnimationIntervalNode none = { INT64_MIN, INT64_MIN, INT64_MIN, 0, 0, 0 };
+    index->nodes[0] = none;
+    index->seed = 0x9E3779B9u;
+    return index;
+}
+
+void TimelineAnimationIntervalIndexDestroy(TimelineAnimationIntervalIndex *index)
+{
+    if (index == NULL) {
+        return;
+    }
+    free(index->roots);
+    free(index->nodes);
+    free(index);
+}
+
+void TimelineAnimationIntervalIndexRemoveAll(TimelineAnimationIntervalIndex *index)
+{
+    index->count = 0;
+    for (size_t key = 0; key < index->keyCapacity; ++key) {
+        index->roots[key] = 0;
+    }
+}
+
+size_t TimelineAnimationIntervalIndexCount(const TimelineAnimationIntervalIndex *index)
+{
+    return index->count;
+}
+
+static inline void TimelineAnimationIntervalNodeUpdate(TimelineAnimationIntervalNode *nodes, size_t node)
+{
+    int64_t latest = nodes[node].end;
+    if (nodes[nodes[node].left].latestEnd > latest) {
+        latest = nodes[nodes[node].left].latestEnd;
+    }
+    if (nodes[nodes[node].right].latestEnd > latest) {
+        latest = nodes[nodes[node].right].latestEnd;
+    }
+    nodes[node].latestEnd = latest;
+}
+
+// Inserts `node` below `root`, returning the root of the subtree.
+static size_t TimelineAnimationIntervalNodeInsert(TimelineAnimationIntervalNode *nodes, size_t root, size_t node)
+{
+    if (root == 0) {
+        return node;
+    }
+    if (nodes[node].begin < nodes[root].begin) {
+        nodes[root].left = TimelineAnimationIntervalNodeInsert(nodes, nodes[root].left, node);
+        const size_t left = nodes[root].left;
+        if (nodes[left].priority > nodes[root].priority) {
+            // rotate right
+            nodes[root].left = nodes[left].right;
+            nodes[left].right = root;
+            TimelineAnimationIntervalNodeUpdate(nodes, root);
+            root = left;
+        }
+    }
+    else {
+        nodes[root].right = TimelineAnimationIntervalNodeInsert(nodes, nodes[root].right, node);
+        const size_t right = nodes[root].right;
+        if (nodes[right].priority > nodes[root].priority) {
+            // rotate left
+            nodes[root].right = nodes[right].left;
+            nodes[right].left = root;
+            TimelineAnimationIntervalNodeUpdate(nodes, root);
+            root = right;
+        }
+    }
+    TimelineAnimationIntervalNodeUpdate(nodes, root);
+    return root;
+}
+
+int TimelineAnimationIntervalIndexInsert(TimelineAnimationIntervalIndex *index,
+                                         const TimelineAnimationInterval *interval)
+{
+    if (index->count == index->capacity) {
+        const size_t capacity = index->capacity * 2;
+        TimelineAnimationIntervalNode *const nodes = (TimelineAnimationIntervalNode *)realloc(index->nodes,
+                                                                                              sizeof(TimelineAnimationIntervalNode) * (capacity + 1));
+        if (nodes == NULL) {
+            return 0;
+        }
+        index->nodes = nodes;
+        index->capacity = capacity;
+    }
+    if (interval->key >= index->keyCapacity) {
+        size_t keyCapacity = (index->keyCapacity > 0) ? index->keyCapacity : 16;
+        while (keyCapacity <= interval->key) {
+            keyCapacity *= 2;
+        }
+        size_t *const roots = (size_t *)realloc(index->roots, sizeof(size_t) * keyCapacity);
+        if (roots == NULL) {
+            return 0;
+        }
+        for (size_t key = index->keyCapacity; key < keyCapacity; ++key) {
+            roots[key] = 0;
+        }
+        index->roots = roots;
+        index->keyCapacity = keyCapacity;
+    }
+
+    // xorshift, for the priorities
+    uint32_t seed = index->seed;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    index->seed = seed;
+
+    const size_t node = ++index->count;
+    const TimelineAnimationIntervalNode added = {
+        interval->begin, interval->end, interval->end, seed, 0, 0,
+    };
+    index->nodes[node] = added;
+    index->roots[interval->key] = TimelineAnimationIntervalNodeInsert(index->nodes, index->roots[interval->key], node);
+    return 1;
+}
+
+void TimelineAnimationIntervalIndexShift(TimelineAnimationIntervalIndex *index, int64_t ticks)
+{
+    // node 0 keeps the earliest time
+    for (size_t node = 1; node <= index->count; ++node) {
+        index->nodes[node].begin += ticks;
+        index->nodes[node].end += ticks;
+        index->nodes[node].latestEnd += ticks;
+    }
+}
+
+int TimelineAnimationIntervalIndexMayConflict(const TimelineAnimationIntervalIndex *index,
+                                              const TimelineAnimationInterval *interval)
+{
+    if (interval->key >= index->keyCapacity) {
+        return 0;
+    }
+    const TimelineAnimationIntervalNode *const nodes = index->nodes;
+    const size_t root = index->roots[interval->key];
+    const int64_t begin = interval->begin;
+
+    // an interval beginning at or before `begin` and ending after it: below a
+    // node beginning at or before it, all of the left subtree does too
+    for (size_t node = root; node != 0;) {
+        if (nodes[node].begin <= begin) {
+            if (nodes[node].end > begin || nodes[nodes[node].left].latestEnd > begin) {
+                return 1;
+            }
+            node = nodes[node].right;
+        }
+        else {
+            node = nodes[node].left;
+        }
+    }
+
+    // the first interval beginning at or after `begin`, within the interval,
+    // or at `begin` if it is empty
+    const int64_t end = (interval->end > begin) ? interval->end : begin + 1;
+    int found = 0;
+    int64_t first = 0;
+    for (size_t node = root; node != 0;) {
+        if (nodes[node].begin >= begin) {
+            found = 1;
+            first = nodes[node].begin;
+            node = nodes[node].left;
+        }
+        else {
+            node = nodes[node].right;
+        }
+    }
+    return found && first < end;
+}
+
+static int TimelineAnimationIntervalCompare(const void *a, const void *b)
+{
+    const TimelineAnimationInterval *const first = (const TimelineAnimationInterval *)a;
+    const TimelineAnimationInterval *const second = (const TimelineAnimationInterval *)b;
+    if (first->key != second->key) {
+        return (first->key < second->key) ? -1 : 1;
+    }
+    if (first->begin != second->begin) {
+        return (first->begin < second->begin) ? -1 : 1;
+    }
+    return 0;
+}
+
+int TimelineAnimationIntervalsConflict(TimelineAnimationInterval *intervals,
+                                       size_t count,
+                                       TimelineAnimationInterval *others,
+                                       size_t otherCount)
+{
+    qsort(intervals, count, sizeof(TimelineAnimationInterval), TimelineAnimationIntervalCompare);
+    qsort(others, otherCount, sizeof(TimelineAnimationInterval), TimelineAnimationIntervalCompare);
+
+    // in order of key and begin time, each interval conflicts with one of the
+    // other set seen before it if that one ends after it begins, or begins at
+    // the same time while it is not empty; the latest end time and begin time
+    // of each set are kept for the key being swept
+    TimelineAnimationInterval *const sets[2] = { intervals, others };
+    const size_t counts[2] = { count, otherCount };
+    size_t next[2] = { 0, 0 };
+    int64_t latestEnd[2] = { INT64_MIN, INT64_MIN };
+    int64_t latestBegin[2] = { INT64_MIN, INT64_MIN };
+    size_t key = 0;
+    int started = 0;
+    while (next[0] < counts[0] && next[1] < counts[1]) {
+        const int set = (TimelineAnimationIntervalCompare(&sets[1][next[1]], &sets[0][next[0]]) < 0) ? 1 : 0;
+        const TimelineAnimationInterval *const interval = &sets[set][next[set]++];
+        if (!started || interval->key != key) {
+            started = 1;
+            key = interval->key;
+            latestEnd[0] = latestEnd[1] = INT64_MIN;
+            latestBegin[0] = latestBegin[1] = INT64_MIN;
+        }
+        const int other = 1 - set;
+        if (latestEnd[other] > interval->begin
+            || (latestBegin[other] == interval->begin && interval->end > interval->begin)) {
+            return 1;
+        }
+        if (interval->end > latestEnd[set]) {
+            latestEnd[set] = interval->end;
+        }
+        latestBegin[set] = interval->begin;
+    }
+    // once one set is through, the rest of the other can only conflict with
+    // its last key
+    for (int set = 0; set < 2; ++set) {
+        const int other = 1 - set;
+        for (; next[set] < counts[set] && started; ++next[set]) {
+            const TimelineAnimationInterval *const interval = &sets[set][next[set]];
+            if (interval->key != key) {
+                break;
+            }
+            if (latestEnd[other] > interval->begin
+                || (latestBegin[other] == interval->begin && interval->end > interval->begin)) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+typedef struct {
+    TimelineAnimationInterval interval;
+    size_t number;
+} TimelineAnimationNumberedInterval;
+
+static int TimelineAnimationNumberedIntervalCompare(const void *a, const void *b)
+{
+    const TimelineAnimationNumberedInterval *const first = (const TimelineAnimationNumberedInterval *)a;
+    const TimelineAnimationNumberedInterval *const second = (const TimelineAnimationNumberedInterval *)b;
+    const int order = TimelineAnimationIntervalCompare(&first->interval, &second->interval);
+    if (order != 0) {
+        return order;
+    }
+    return (first->number < second->number) ? -1 : (first->number > second->number);
+}
+
+size_t TimelineAnimationIntervalsFindConflicts(const TimelineAnimationInterval *intervals,
+                                               size_t count,
+                                               TimelineAnimationIntervalConflict *conflicts)
+{
+    if (count == 0) {
+        return 0;
+    }
+    TimelineAnimationNumberedInterval *const sorted = (TimelineAnimationNumberedInterval *)malloc(sizeof(TimelineAnimationNumberedInterval) * count);
+    if (sorted == NULL) {
+        return SIZE_MAX;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        sorted[i].interval = intervals[i];
+        sorted[i].number = i;
+    }
+    qsort(sorted, count, sizeof(TimelineAnimationNumberedInterval), TimelineAnimationNumberedIntervalCompare);
+
+    // in order of key and begin time, an interval conflicts with one before
+    // it if that one ends after it begins, the one ending last of the key
+    // being kept, or begins at the same time, as the one just before it does
+    size_t found = 0;
+    size_t latest = 0;
+    for (size_t i = 1; i < count; ++i) {
+        const TimelineAnimationInterval *const interval = &sorted[i].interval;
+        const TimelineAnimationInterval *const previous = &sorted[i - 1].interval;
+        if (interval->key != previous->key) {
+            latest = i;
+            continue;
+        }
+        if (previous->begin == interval->begin) {
+            const TimelineAnimationIntervalConflict conflict = { sorted[i].number, sorted[i - 1].number };
+            conflicts[found++] = conflict;
+        }
+        else if (sorted[latest].interval.end > interval->begin) {
+            const TimelineAnimationIntervalConflict conflict = { sorted[i].number, sorted[latest].number };
+            conflicts[found++] = conflict;
+        }
+        if (interval->end > sorted[latest].interval.end) {
+            latest = i;
+        }
+    }
+    free(sorted);
+    return found;
+}
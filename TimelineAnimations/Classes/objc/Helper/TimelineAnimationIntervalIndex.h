@@ -0,0 +1,97 @@
+/*!
+ *  @file TimelineAnimationIntervalIndex.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_INTERVAL_INDEX_H
+#define TIMELINE_ANIMATIONS_INTERVAL_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // The conflicts between the entities of timelines, free of Foundation so
+    // that it builds and can be checked on any platform.
+    //
+    // Two intervals conflict, as -[TimelineEntity conflictingWith:] has it,
+    // if they have the same key, the layer, animation key and key path of the
+    // entity numbered by the caller, and either begins within the other:
+    //
+    //     begin in [otherBegin, otherEnd) or otherBegin in [begin, end)
+    //
+    // the times being whole milliseconds. Two empty intervals at the same
+    // time do not conflict, an empty one within another does.
+
+    typedef struct {
+        size_t key;
+        int64_t begin;
+        int64_t end;
+    } TimelineAnimationInterval;
+
+    /// The intervals of a timeline, in a treap per key ordered by begin time
+    /// and holding the latest end time below each node, so that inserting and
+    /// looking for a conflict take O(log n).
+    typedef struct TimelineAnimationIntervalIndex TimelineAnimationIntervalIndex;
+
+    /// An empty index, or NULL if memory runs out.
+    TimelineAnimationIntervalIndex *TimelineAnimationIntervalIndexCreate(void);
+
+    void TimelineAnimationIntervalIndexDestroy(TimelineAnimationIntervalIndex *index);
+
+    /// Empties `index`, keeping its memory.
+    void TimelineAnimationIntervalIndexRemoveAll(TimelineAnimationIntervalIndex *index);
+
+    /// The number of intervals in `index`.
+    size_t TimelineAnimationIntervalIndexCount(const TimelineAnimationIntervalIndex *index);
+
+    /// Adds `interval` to `index`. Returns 0 if memory runs out, `index`
+    /// being left as it was.
+    int TimelineAnimationIntervalIndexInsert(TimelineAnimationIntervalIndex *index,
+                                             const TimelineAnimationInterval *interval);
+
+    /// Moves every interval of `index` by `ticks`, in O(n) and keeping the
+    /// treaps, as moving them all keeps their order.
+    void TimelineAnimationIntervalIndexShift(TimelineAnimationIntervalIndex *index, int64_t ticks);
+
+    /// Whether an interval of `index` conflicts with `interval`, or begins at
+    /// the same time with the same key, as an equal entity does.
+    int TimelineAnimationIntervalIndexMayConflict(const TimelineAnimationIntervalIndex *index,
+                                                  const TimelineAnimationInterval *interval);
+
+    /// Whether any of the `count` intervals conflicts with any of the
+    /// `otherCount` others. Sorts both by key and begin time, in place, and
+    /// merges them in a single sweep, O((n + m) log(n + m)).
+    int TimelineAnimationIntervalsConflict(TimelineAnimationInterval *intervals,
+                                           size_t count,
+                                           TimelineAnimationInterval *others,
+                                           size_t otherCount);
+
+    /// An interval that conflicts with another, or begins at the same time
+    /// with the same key, numbered as they were given.
+    typedef struct {
+        size_t interval;
+        size_t other;
+    } TimelineAnimationIntervalConflict;
+
+    /// Finds the conflicts among the `count` intervals, in a single sweep
+    /// over them sorted by key and begin time, O(n log n): each interval that
+    /// conflicts with one before it in that order, those beginning together
+    /// in the order given, is written to `conflicts` with one such other
+    /// interval. Returns the number of conflicts, at most `count`, or
+    /// SIZE_MAX if memory runs out.
+    size_t TimelineAnimationIntervalsFindConflicts(const TimelineAnimationInterval *intervals,
+                                                   size_t count,
+                                                   TimelineAnimationIntervalConflict *conflicts);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* TIMELINE_ANIMATIONS_INTERVAL_INDEX_H */
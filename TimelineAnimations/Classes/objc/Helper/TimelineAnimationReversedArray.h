@@ -0,0 +1,33 @@
+/*!
+ *  @file TimelineAnimationReversedArray.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+@import Foundation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/*!
+ *  @public
+ *  @class TimelineAnimationReversedArray
+ *  @brief An immutable array that is another one backwards, without copying it.
+ *  @details Object i is object count - 1 - i of the array it reverses, or for
+ *  key times 1 minus that key time, boxed when it is asked for. Copying it
+ *  returns it, and reversing it again returns the array it reverses.
+ */
+@interface TimelineAnimationReversedArray<ObjectType> : NSArray<ObjectType>
+
+/// `array` backwards.
++ (NSArray<ObjectType> *)arrayByReversingArray:(NSArray<ObjectType> *)array;
+
+/// The key times of the reversed keyframes of `keyTimes`: 1 minus them,
+/// backwards.
++ (NSArray<NSNumber *> *)arrayByReversingKeyTimes:(NSArray<NSNumber *> *)keyTimes;
+
+@end
+
+NS_ASSUME_NONNULL_END
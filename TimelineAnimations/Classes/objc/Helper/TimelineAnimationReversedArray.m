@@ -0,0 +1,70 @@
+/*!
+ *  @file TimelineAnimationReversedArray.m
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#import "TimelineAnimationReversedArray.h"
+#import "PrivateTypes.h"
+
+@implementation TimelineAnimationReversedArray {
+    NSArray *_array;
+    NSUInteger _count;
+    BOOL _keyTimes;
+}
+
+- (instancetype)initWithArray:(NSArray *)array keyTimes:(BOOL)keyTimes {
+    self = [super init];
+    if (self != nil) {
+        _array    = array.copy;
+        _count    = _array.count;
+        _keyTimes = keyTimes;
+    }
+    return self;
+}
+
+/// The array `array` reverses, if it is reversed the same way.
+static NSArray *_Nullable __reversedArray(NSArray *array, BOOL keyTimes) {
+    guard ([array isKindOfClass:[TimelineAnimationReversedArray class]]) else { return nil; }
+    TimelineAnimationReversedArray *const reversed = (TimelineAnimationReversedArray *)array;
+    guard (reversed->_keyTimes == keyTimes) else { return nil; }
+    return reversed->_array;
+}
+
++ (NSArray *)arrayByReversingArray:(NSArray *)array {
+    NSParameterAssert(array != nil);
+    NSArray *const reversed = __reversedArray(array, NO);
+    guard (reversed == nil) else { return reversed; }
+    return [[TimelineAnimationReversedArray alloc] initWithArray:array keyTimes:NO];
+}
+
++ (NSArray<NSNumber *> *)arrayByReversingKeyTimes:(NSArray<NSNumber *> *)keyTimes {
+    NSParameterAssert(keyTimes != nil);
+    NSArray *const reversed = __reversedArray(keyTimes, YES);
+    guard (reversed == nil) else { return reversed; }
+    return [[TimelineAnimationReversedArray alloc] initWithArray:keyTimes keyTimes:YES];
+}
+
+- (NSUInteger)count {
+    return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index {
+    if (index >= _count) {
+        [NSException raise:NSRangeException
+                    format:@"index %lu beyond bounds [0 .. %lu]", (unsigned long)index, (unsigned long)_count];
+    }
+    id const object = [_array objectAtIndex:_count - 1 - index];
+    guard (_keyTimes) else { return object; }
+    return @(1.0 - [(NSNumber *)object doubleValue]);
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    // immutable, as is the array it reverses
+    return self;
+}
+
+@end
@@ -14,10 +14,6 @@
 #define not(expression) (!(expression))
 #endif /* not */
 
-#ifndef Round
-#define Round(t) ((double)((unsigned long long)round((double)t * 1000.0)) / 1000.0)
-#endif /* Round */
-
 
 #define TIMELINE_ANIMATION_NO_RETURN __attribute__ ((noreturn));
 #define SortKey(s) (NSStringFromSelector(@selector((s))))
@@ -25,10 +21,27 @@
 @class TimelineAnimationNotifyBlockInfo;
 #import "Types.h"
 
+/// The times of the entities, notifications and comparisons of a timeline,
+/// in whole milliseconds. RelativeTime is converted to ticks where it comes
+/// in, and back only for the API and Core Animation.
+typedef int64_t TimelineTicks;
+
+static const TimelineTicks TimelineTicksPerSecond = 1000;
+static const TimelineTicks TimelineTicksPerMillisecond = 1;
+
+/// `time` to the nearest tick, negative times too.
+NS_INLINE TimelineTicks TimelineTicksFromTime(RelativeTime time) {
+    return (TimelineTicks)llround(time * (RelativeTime)TimelineTicksPerSecond);
+}
+
+NS_INLINE RelativeTime TimelineTimeFromTicks(TimelineTicks ticks) {
+    return (RelativeTime)ticks / (RelativeTime)TimelineTicksPerSecond;
+}
+
 typedef NSNumber ProgressNumber; // float
 typedef NSMutableDictionary<ProgressNumber *, TimelineAnimationNotifyBlock> ProgressNotificationAssociations; // [Float<0..1>: TimelineAnimationNotifyBlock]
-typedef NSNumber RelativeTimeNumber;// relative time -> double
-typedef NSMutableDictionary<RelativeTimeNumber *, NSMutableArray<TimelineAnimationNotifyBlockInfo *> *> NotificationAssociations; // [RelativeTime: [NotifyInfoBlock]]
+typedef NSNumber RelativeTimeNumber;// relative time -> TimelineTicks
+typedef NSMutableDictionary<RelativeTimeNumber *, NSMutableArray<TimelineAnimationNotifyBlockInfo *> *> NotificationAssociations; // [TimelineTicks: [NotifyInfoBlock]]
 
 typedef RelativeTimeNumber *_Nonnull (^TimeNotificationCalculation)(RelativeTimeNumber *_Nonnull);
 
@@ -13,7 +13,10 @@
 
 @interface CAKeyframeAnimation (SpecialEasing)
 
-/// Factory method to create a keyframe animation for animating a scalar value
+/// Factory method to create a keyframe animation for animating a scalar value.
+/// The values of this and the other `keyframeCount:` factories are kept in
+/// `+[TimelineAnimationKeyframeCache sharedCache]`, and shared by the
+/// animations built with the same arguments.
 + (instancetype)animationWithKeyPath:(AnimationKeyPath)path
                             function:(TimelineAnimationSpecialTimingFunction)function
                            fromValue:(CGFloat)fromValue
@@ -27,6 +30,16 @@
                            fromValue:(CGFloat)fromValue
                              toValue:(CGFloat)toValue NS_REFINED_FOR_SWIFT;
 
+/// Factory method to create a keyframe animation for animating a scalar value,
+/// with the keyframes placed where `function` bends, as few as can be linearly
+/// interpolated within `maximumError` of it, a fraction of the distance
+/// between the values. The key times are set accordingly.
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue
+                        maximumError:(CGFloat)maximumError;
+
 /// Factory method to create a keyframe animation for animating between two points
 + (instancetype)animationWithKeyPath:(AnimationKeyPath)path
                             function:(TimelineAnimationSpecialTimingFunction)function
@@ -41,6 +54,14 @@
                            fromPoint:(CGPoint)fromValue
                              toPoint:(CGPoint)toValue NS_REFINED_FOR_SWIFT;
 
+/// Factory method to create a keyframe animation for animating between two points,
+/// with the keyframes placed where `function` bends, within `maximumError`
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromPoint:(CGPoint)fromPoint
+                             toPoint:(CGPoint)toPoint
+                        maximumError:(CGFloat)maximumError;
+
 /// Factory method to create a keyframe animation for animating between two sizes
 + (instancetype)animationWithKeyPath:(AnimationKeyPath)path
                             function:(TimelineAnimationSpecialTimingFunction)function
@@ -55,8 +76,16 @@
                             fromSize:(CGSize)fromValue
                               toSize:(CGSize)toValue NS_REFINED_FOR_SWIFT;
 
+/// Factory method to create a keyframe animation for animating between two sizes,
+/// with the keyframes placed where `function` bends, within `maximumError`
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromSize:(CGSize)fromSize
+                              toSize:(CGSize)toSize
+                        maximumError:(CGFloat)maximumError;
+
 /// Factory method to create a keyframe animation for animating between two affine transforms.
-/// The provinstancetypeed transforms must not have any shearing factors, and must have uniform scale.
+/// The transforms are decomposed into translation, rotation, skew and scale, which are interpolated, the rotation along the shorter arc.
 /// The keyframe values are instances of NSValue wrapping a CATransform3D.
 + (instancetype)animationWithKeyPath:(AnimationKeyPath)path
                             function:(TimelineAnimationSpecialTimingFunction)function
@@ -66,11 +95,204 @@
 
 /// Factory method to create a keyframe animation for animating between two affine transforms,
 /// with keyFrameCount set to 60.
-/// The provinstancetypeed transforms must not have any shearing factors, and must have uniform scale.
+/// The transforms are decomposed into translation, rotation, skew and scale, which are interpolated, the rotation along the shorter arc.
 /// The keyframe values are instances of NSValue wrapping a CATransform3D.
 + (instancetype)animationWithKeyPath:(AnimationKeyPath)path
                             function:(TimelineAnimationSpecialTimingFunction)function
                        fromTransform:(CGAffineTransform)fromTransform
                          toTransform:(CGAffineTransform)toTransform NS_REFINED_FOR_SWIFT;
 
+/// Factory method to create a keyframe animation for animating between two affine transforms,
+/// with the keyframes placed where `function` bends, within `maximumError`.
+/// The transforms are decomposed into translation, rotation, skew and scale, which are interpolated, the rotation along the shorter arc.
+/// The keyframe values are instances of NSValue wrapping a CATransform3D.
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                       fromTransform:(CGAffineTransform)fromTransform
+                         toTransform:(CGAffineTransform)toTransform
+                        maximumError:(CGFloat)maximumError;
+
+/// Factory method to create a keyframe animation for animating between two rects
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromRect:(CGRect)fromRect
+                              toRect:(CGRect)toRect
+                       keyframeCount:(size_t)keyframeCount NS_REFINED_FOR_SWIFT;
+
+/// Factory method to create a keyframe animation for animating between two rects,
+/// with keyFrameCount set to 60
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromRect:(CGRect)fromRect
+                              toRect:(CGRect)toRect NS_REFINED_FOR_SWIFT;
+
+/// Factory method to create a keyframe animation for animating a scalar value
+/// along a damped spring, see TimelineAnimationSpring.h.
+/// The duration of the animation is set to the time the spring takes to settle
+/// and the keyframes are spread over it, so the animation does not run while
+/// nothing moves any more.
+/// It never fails: a mass, stiffness or damping below 0.001 is taken as 0.001,
+/// so that the spring settles, a non finite initial velocity as 0, and
+/// keyframeCount as at least 2.
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                                mass:(CGFloat)mass
+                           stiffness:(CGFloat)stiffness
+                             damping:(CGFloat)damping
+                     initialVelocity:(CGFloat)initialVelocity
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue
+                       keyframeCount:(size_t)keyframeCount;
+
+/// Factory method to create a keyframe animation for animating a scalar value
+/// along a damped spring, with keyFrameCount set to 60
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                                mass:(CGFloat)mass
+                           stiffness:(CGFloat)stiffness
+                             damping:(CGFloat)damping
+                     initialVelocity:(CGFloat)initialVelocity
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue;
+
+/// Factory method to create a keyframe animation for animating a scalar value
+/// with a keyframe at every extremum of `function` and a cubic Bézier timing
+/// function in between, within `tolerance` of it, see
+/// TimelineAnimationCubicBezierFitExtremaSegments(). Elastic and Bounce take
+/// 8 keyframes instead of 60, their InOut versions about 15, and Core
+/// Animation interpolates between them along the curve.
+/// The fit is computed once per function and tolerance.
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue
+                     bezierTolerance:(CGFloat)tolerance;
+
+/// Factory method to create a keyframe animation for animating between two
+/// points with a keyframe at every extremum of `function`, see above
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromPoint:(CGPoint)fromPoint
+                             toPoint:(CGPoint)toPoint
+                     bezierTolerance:(CGFloat)tolerance;
+
+/// Factory method to create a keyframe animation for animating between two
+/// sizes with a keyframe at every extremum of `function`, see above
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromSize:(CGSize)fromSize
+                              toSize:(CGSize)toSize
+                     bezierTolerance:(CGFloat)tolerance;
+
+/// Factory method to create a keyframe animation for animating between two
+/// rects with a keyframe at every extremum of `function`, see above
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromRect:(CGRect)fromRect
+                              toRect:(CGRect)toRect
+                     bezierTolerance:(CGFloat)tolerance;
+
+/// Factory method to create a keyframe animation for animating between two
+/// affine transforms with a keyframe at every extremum of `function`, see
+/// above. The keyframes are decomposed as by the other transform factories,
+/// in between Core Animation interpolates the transforms itself.
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                       fromTransform:(CGAffineTransform)fromTransform
+                         toTransform:(CGAffineTransform)toTransform
+                     bezierTolerance:(CGFloat)tolerance;
+
+/// Factory method to create a keyframe animation for animating a scalar value
+/// with the cubic calculation mode, and keyframes picked greedily for their
+/// Catmull-Rom spline to stay within `maximumError` of `function`, a fraction
+/// of the distance between the values, see
+/// TimelineAnimationKeyframeSplineProgress(). When the linearly interpolated
+/// keyframes of `maximumError:` are fewer, as for lines and the Bounce curves,
+/// those are used with the linear calculation mode instead. Within 1e-3, the
+/// curves take about 14% fewer keyframes than linearly interpolated ones
+/// alone, and about 6% fewer within 1e-2.
+/// `maximumError` is a target checked on a sampling grid, not a bound: in
+/// between, the spline may stray slightly further, CircularEaseInOut by
+/// 1.18e-3 within 1e-3. The keyframes are chosen once per function and
+/// maximum error.
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue
+                  splineMaximumError:(CGFloat)maximumError;
+
+/// Factory method to create a keyframe animation for animating between two
+/// points with the cubic calculation mode, see above
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromPoint:(CGPoint)fromPoint
+                             toPoint:(CGPoint)toPoint
+                  splineMaximumError:(CGFloat)maximumError;
+
+/// Factory method to create a keyframe animation for animating between two
+/// sizes with the cubic calculation mode, see above
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromSize:(CGSize)fromSize
+                              toSize:(CGSize)toSize
+                  splineMaximumError:(CGFloat)maximumError;
+
+/// Factory method to create a keyframe animation for animating between two
+/// rects with the cubic calculation mode, see above
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromRect:(CGRect)fromRect
+                              toRect:(CGRect)toRect
+                  splineMaximumError:(CGFloat)maximumError;
+
+/// Factory method to create a keyframe animation for animating a scalar value,
+/// the values of which are computed only when needed, see `-materializeValues`.
+/// Until then `values` is nil and the animation holds only its arguments.
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                                   fromValue:(CGFloat)fromValue
+                                     toValue:(CGFloat)toValue
+                               keyframeCount:(size_t)keyframeCount;
+
+/// Factory method to create a keyframe animation for animating between two
+/// points, the values of which are computed only when needed
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                                   fromPoint:(CGPoint)fromPoint
+                                     toPoint:(CGPoint)toPoint
+                               keyframeCount:(size_t)keyframeCount;
+
+/// Factory method to create a keyframe animation for animating between two
+/// sizes, the values of which are computed only when needed
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                                    fromSize:(CGSize)fromSize
+                                      toSize:(CGSize)toSize
+                               keyframeCount:(size_t)keyframeCount;
+
+/// Factory method to create a keyframe animation for animating between two
+/// rects, the values of which are computed only when needed
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                                    fromRect:(CGRect)fromRect
+                                      toRect:(CGRect)toRect
+                               keyframeCount:(size_t)keyframeCount;
+
+/// Factory method to create a keyframe animation for animating between two
+/// affine transforms, the values of which are computed only when needed.
+/// The same restrictions as the non deferred factory apply.
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                               fromTransform:(CGAffineTransform)fromTransform
+                                 toTransform:(CGAffineTransform)toTransform
+                               keyframeCount:(size_t)keyframeCount;
+
+/// Whether the values of the animation are still to be computed.
+/// Copies made before the values are materialized are deferred too, and
+/// materialize their own values.
+@property (nonatomic, readonly) BOOL hasDeferredValues;
+
+/// Computes the deferred values of the animation and sets `values`.
+/// Does nothing if there are none. A TimelineAnimation calls this when the
+/// animation is added to its layer.
+- (void)materializeValues;
+
 @end
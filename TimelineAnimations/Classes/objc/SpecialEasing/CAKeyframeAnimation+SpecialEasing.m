@@ -9,6 +9,11 @@
 
 #import "CAKeyframeAnimation+SpecialEasing.h"
 #import "AnimationsKeyPath.h"
+#import "TimelineAnimationKeyframes.h"
+#import "TimelineAnimationKeyframeCache.h"
+#import "TimelineAnimationKeyframeSpline.h"
+#import "TimelineAnimationCubicBezierFit.h"
+#import "TimelineAnimationSpring.h"
 @import UIKit;
 @import QuartzCore;
 @import Foundation;
@@ -20,6 +25,252 @@
 
 #endif
 
+// The smallest mass, stiffness and damping of the spring factories
+#define SpringMinimumParameter 1e-3
+
+/// Places the keyframes of `function` where it bends, see
+/// TimelineAnimationKeyframeAdaptiveProgress(), and returns their key times.
+/// The caller is responsible to `free()` `*progress`, NULL if memory ran out.
+static NSArray<NSNumber *> *__adaptiveKeyTimes(TimelineAnimationSpecialTimingFunction function,
+                                               CGFloat maximumError,
+                                               double *_Nullable *_Nonnull progress) {
+    *progress = NULL;
+    double *const keyTimes = (double *)malloc(sizeof(double) * TimelineAnimationKeyframeAdaptiveCapacity);
+    double *const values = (double *)malloc(sizeof(double) * TimelineAnimationKeyframeAdaptiveCapacity);
+    const size_t keyframeCount = (keyTimes != NULL && values != NULL)
+        ? TimelineAnimationKeyframeAdaptiveProgress(function, maximumError, TimelineAnimationKeyframeAdaptiveCapacity, keyTimes, values)
+        : 0;
+    if (keyframeCount == 0) {
+        free(values);
+        free(keyTimes);
+        return @[];
+    }
+    NSMutableArray<NSNumber *> *const times = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+        [times addObject:@(keyTimes[frame])];
+    }
+    free(keyTimes);
+    *progress = values;
+    return [times copy];
+}
+
+/// The key of the shared cache for the values of `function` from `from` to
+/// `to`, as many components as `type` has.
+static TimelineAnimationKeyframeCacheKey __cacheKey(TimelineAnimationSpecialTimingFunction function,
+                                                    TimelineAnimationKeyframeValueType type,
+                                                    const double *from,
+                                                    const double *to,
+                                                    size_t components,
+                                                    size_t keyframeCount) {
+    TimelineAnimationKeyframeCacheKey key;
+    memset(&key, 0, sizeof(key));
+    key.function = function;
+    key.type = type;
+    memcpy(key.from, from, sizeof(double) * components);
+    memcpy(key.to, to, sizeof(double) * components);
+    key.keyframeCount = keyframeCount;
+    return key;
+}
+
+// The planar keyframes of TimelineAnimationKeyframes.h, boxed in one pass.
+
+static NSArray<NSValue *> *__pointValues(const double *planes, size_t keyframeCount) {
+    NSMutableArray<NSValue *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
+    const double *const x = planes;
+    const double *const y = planes + keyframeCount;
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+#if TARGET_OS_IPHONE
+        [values addObject:[NSValue valueWithCGPoint:CGPointMake((CGFloat)x[frame], (CGFloat)y[frame])]];
+#else
+        [values addObject:[NSValue valueWithPoint:NSMakePoint((CGFloat)x[frame], (CGFloat)y[frame])]];
+#endif
+    }
+    return [values copy];
+}
+
+static NSArray<NSValue *> *__sizeValues(const double *planes, size_t keyframeCount) {
+    NSMutableArray<NSValue *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
+    const double *const w = planes;
+    const double *const h = planes + keyframeCount;
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+#if TARGET_OS_IPHONE
+        [values addObject:[NSValue valueWithCGSize:CGSizeMake((CGFloat)w[frame], (CGFloat)h[frame])]];
+#else
+        [values addObject:[NSValue valueWithSize:NSMakeSize((CGFloat)w[frame], (CGFloat)h[frame])]];
+#endif
+    }
+    return [values copy];
+}
+
+static NSArray<NSValue *> *__rectValues(const double *planes, size_t keyframeCount) {
+    NSMutableArray<NSValue *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
+    const double *const x = planes;
+    const double *const y = planes + keyframeCount;
+    const double *const w = planes + 2 * keyframeCount;
+    const double *const h = planes + 3 * keyframeCount;
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+#if TARGET_OS_IPHONE
+        [values addObject:[NSValue valueWithCGRect:CGRectMake((CGFloat)x[frame], (CGFloat)y[frame],
+                                                              (CGFloat)w[frame], (CGFloat)h[frame])]];
+#else
+        [values addObject:[NSValue valueWithRect:NSMakeRect((CGFloat)x[frame], (CGFloat)y[frame],
+                                                            (CGFloat)w[frame], (CGFloat)h[frame])]];
+#endif
+    }
+    return [values copy];
+}
+
+static NSArray<NSValue *> *__transformValues(const double *planes, size_t keyframeCount) {
+    NSMutableArray<NSValue *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
+    const double *const a = planes;
+    const double *const b = planes + keyframeCount;
+    const double *const c = planes + 2 * keyframeCount;
+    const double *const d = planes + 3 * keyframeCount;
+    const double *const tx = planes + 4 * keyframeCount;
+    const double *const ty = planes + 5 * keyframeCount;
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+        const CGAffineTransform affineTransform = CGAffineTransformMake((CGFloat)a[frame], (CGFloat)b[frame],
+                                                                        (CGFloat)c[frame], (CGFloat)d[frame],
+                                                                        (CGFloat)tx[frame], (CGFloat)ty[frame]);
+        const CATransform3D transform = CATransform3DMakeAffineTransform(affineTransform);
+        [values addObject:[NSValue valueWithCATransform3D:transform]];
+    }
+    return [values copy];
+}
+
+/// The keyframes of a curve at its extrema, with a timing function per segment,
+/// see TimelineAnimationCubicBezierFitExtremaSegments().
+@interface TimelineAnimationBezierKeyframes : NSObject
+@property (nonatomic, copy) NSArray<NSNumber *> *keyTimes;
+@property (nonatomic, copy) NSArray<CAMediaTimingFunction *> *timingFunctions;
+/// The progress at every key time, as doubles.
+@property (nonatomic, copy) NSData *progress;
+@end
+
+@implementation TimelineAnimationBezierKeyframes
+@end
+
+/// The keyframes of `function` at its extrema within `tolerance`, kept in the
+/// shared TimelineAnimationKeyframeCache as fitting takes milliseconds. nil if
+/// the curve cannot be fitted.
+static TimelineAnimationBezierKeyframes *_Nullable __bezierKeyframes(TimelineAnimationSpecialTimingFunction function,
+                                                                     CGFloat tolerance) {
+    const double toleranceValue[1] = { (double)tolerance };
+    const TimelineAnimationKeyframeCacheKey key = __cacheKey(function, TimelineAnimationKeyframeValueTypeBezierFit,
+                                                             toleranceValue, toleranceValue, 1, 0);
+    NSArray *const fit = [[TimelineAnimationKeyframeCache sharedCache] valuesForKey:key generator:^NSArray *{
+        TimelineAnimationCubicBezierSegment segments[TimelineAnimationCubicBezierFitExtremaCapacity];
+        const size_t count = TimelineAnimationCubicBezierFitExtremaSegments(function, (double)tolerance, segments,
+                                                                            TimelineAnimationCubicBezierFitExtremaCapacity, NULL);
+        if (count == 0) {
+            return @[];
+        }
+        NSMutableArray<NSNumber *> *const keyTimes = [[NSMutableArray alloc] initWithCapacity:count + 1];
+        NSMutableArray<CAMediaTimingFunction *> *const timingFunctions = [[NSMutableArray alloc] initWithCapacity:count];
+        NSMutableData *const progress = [[NSMutableData alloc] initWithLength:sizeof(double) * (count + 1)];
+        double *const values = (double *)progress.mutableBytes;
+        for (size_t i = 0; i < count; ++i) {
+            [keyTimes addObject:@(segments[i].x0)];
+            values[i] = segments[i].y0;
+            TimelineAnimationCubicBezierControlPoints points;
+            if (TimelineAnimationCubicBezierSegmentControlPoints(&segments[i], &points)) {
+                [timingFunctions addObject:[CAMediaTimingFunction functionWithControlPoints:points.x1 :points.y1 :points.x2 :points.y2]];
+            }
+            else {
+                // flat, any timing function goes
+                [timingFunctions addObject:[CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear]];
+            }
+        }
+        // the ends exactly
+        keyTimes[0] = @0.0;
+        [keyTimes addObject:@1.0];
+        values[count] = segments[count - 1].y3;
+        return @[[keyTimes copy], [timingFunctions copy], [progress copy]];
+    }];
+    if (fit.count == 0) {
+        return nil;
+    }
+
+    TimelineAnimationBezierKeyframes *const keyframes = [[TimelineAnimationBezierKeyframes alloc] init];
+    keyframes.keyTimes = fit[0];
+    keyframes.timingFunctions = fit[1];
+    keyframes.progress = fit[2];
+    return keyframes;
+}
+
+/// The keyframes of `function` whose Catmull-Rom spline is within
+/// `maximumError` of it, see TimelineAnimationKeyframeSplineProgress(), or
+/// those placed by TimelineAnimationKeyframeAdaptiveProgress() when linearly
+/// interpolated they are fewer.
+@interface TimelineAnimationSplineKeyframes : NSObject
+@property (nonatomic, copy) NSArray<NSNumber *> *keyTimes;
+/// The progress at every key time, as doubles.
+@property (nonatomic, copy) NSData *progress;
+/// kCAAnimationCubic or kCAAnimationLinear.
+@property (nonatomic, copy) NSString *calculationMode;
+@end
+
+@implementation TimelineAnimationSplineKeyframes
+@end
+
+/// The spline keyframes of `function` within `maximumError`, kept in the
+/// shared TimelineAnimationKeyframeCache as choosing them takes milliseconds.
+/// The spline keyframes are picked greedily and some curves, straight or
+/// with corners as Bounce, need fewer linear ones, which are taken instead.
+/// nil if too many are needed either way.
+static TimelineAnimationSplineKeyframes *_Nullable __splineKeyframes(TimelineAnimationSpecialTimingFunction function,
+                                                                     CGFloat maximumError) {
+    const double maximumErrorValue[1] = { (double)maximumError };
+    const TimelineAnimationKeyframeCacheKey key = __cacheKey(function, TimelineAnimationKeyframeValueTypeSpline,
+                                                             maximumErrorValue, maximumErrorValue, 1, 0);
+    NSArray *const spline = [[TimelineAnimationKeyframeCache sharedCache] valuesForKey:key generator:^NSArray *{
+        double keyTimes[TimelineAnimationKeyframeSplineCapacity];
+        NSMutableData *const progress = [[NSMutableData alloc] initWithLength:sizeof(double) * TimelineAnimationKeyframeSplineCapacity];
+        const size_t count = TimelineAnimationKeyframeSplineProgress(function, (double)maximumError,
+                                                                     TimelineAnimationKeyframeSplineCapacity,
+                                                                     keyTimes, (double *)progress.mutableBytes);
+        double *linearProgress = NULL;
+        NSArray<NSNumber *> *const linearKeyTimes = __adaptiveKeyTimes(function, maximumError, &linearProgress);
+        if (linearProgress != NULL && (count == 0 || linearKeyTimes.count < count)) {
+            NSData *const linear = [NSData dataWithBytes:linearProgress length:sizeof(double) * linearKeyTimes.count];
+            free(linearProgress);
+            return @[linearKeyTimes, linear, kCAAnimationLinear];
+        }
+        free(linearProgress);
+        if (count == 0) {
+            return @[];
+        }
+        progress.length = sizeof(double) * count;
+        NSMutableArray<NSNumber *> *const times = [[NSMutableArray alloc] initWithCapacity:count];
+        for (size_t frame = 0; frame < count; ++frame) {
+            [times addObject:@(keyTimes[frame])];
+        }
+        return @[[times copy], [progress copy], kCAAnimationCubic];
+    }];
+    if (spline.count == 0) {
+        return nil;
+    }
+
+    TimelineAnimationSplineKeyframes *const keyframes = [[TimelineAnimationSplineKeyframes alloc] init];
+    keyframes.keyTimes = spline[0];
+    keyframes.progress = spline[1];
+    keyframes.calculationMode = spline[2];
+    return keyframes;
+}
+
+/// The arguments of a deferred keyframe animation, kept on the animation under
+/// `__deferredKeyframesKey` so that copies of the animation share them.
+@interface TimelineAnimationDeferredKeyframes : NSObject {
+    @public
+    TimelineAnimationKeyframeCacheKey _key;
+}
+@end
+
+@implementation TimelineAnimationDeferredKeyframes
+@end
+
+static NSString *const __deferredKeyframesKey = @"TimelineAnimations.deferredKeyframes";
+
 @implementation CAKeyframeAnimation (SpecialEasing)
 
 + (instancetype)animationWithKeyPath:(AnimationKeyPath)path
@@ -54,16 +305,49 @@
                                            to:(CGFloat)to
                                 keyframeCount:(size_t)keyframeCount {
     
-    NSMutableArray<NSNumber *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
-    
-    double t = 0.0;
-    const CGFloat dt = (CGFloat)(1.0 / (keyframeCount - 1));
-    const CGFloat diff = (to - from);
-    for(size_t frame = 0; frame < keyframeCount; ++frame, t += dt) {
-        const CGFloat value = from + (CGFloat)function(t) * diff;
-        [values addObject:@((float)value)];
+    const double fromValues[1] = { from };
+    const double toValues[1] = { to };
+    const TimelineAnimationKeyframeCacheKey key = __cacheKey(function, TimelineAnimationKeyframeValueTypeNumber,
+                                                             fromValues, toValues, 1, keyframeCount);
+    return [[TimelineAnimationKeyframeCache sharedCache] valuesForKey:key generator:^NSArray *{
+        float *const numbers = (float *)malloc(sizeof(float) * keyframeCount);
+        if (numbers == NULL) {
+            return @[];
+        }
+        if (TimelineAnimationKeyframeNumbers(function, from, to, keyframeCount, numbers) == 0) {
+            free(numbers);
+            return @[];
+        }
+        NSMutableArray<NSNumber *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
+        for (size_t frame = 0; frame < keyframeCount; ++frame) {
+            [values addObject:@(numbers[frame])];
+        }
+        free(numbers);
+        return [values copy];
+    }];
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue
+                        maximumError:(CGFloat)maximumError {
+
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    double *progress = NULL;
+    NSArray<NSNumber *> *const keyTimes = __adaptiveKeyTimes(function, maximumError, &progress);
+    if (progress == NULL) {
+        animation.values = @[];
+        return animation;
     }
-    return [values copy];
+    const CGFloat diff = (toValue - fromValue);
+    NSMutableArray<NSNumber *> *const values = [[NSMutableArray alloc] initWithCapacity:keyTimes.count];
+    for (NSUInteger frame = 0; frame < keyTimes.count; ++frame) {
+        [values addObject:@((float)(fromValue + (CGFloat)progress[frame] * diff))];
+    }
+    animation.keyTimes = keyTimes;
+    animation.values = [values copy];
+    return animation;
 }
 
 
@@ -102,24 +386,59 @@
                                          to:(CGPoint)to
                               keyframeCount:(size_t)keyframeCount {
     
-    NSMutableArray<NSValue *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
-    
-    double t = 0.0;
-    const CGFloat dt = (CGFloat)(1.0 / (keyframeCount - 1));
-    const CGFloat xDiff = (to.x - from.x);
-    const CGFloat yDiff = (to.y - from.y);
-    
-    for (size_t frame = 0; frame < keyframeCount; ++frame, t += dt) {
-        const CGFloat v = (CGFloat)function(t);
-        const CGFloat x = from.x + v * xDiff;
-        const CGFloat y = from.y + v * yDiff;
-#if TARGET_OS_IPHONE
-        [values addObject:[NSValue valueWithCGPoint:CGPointMake(x, y)]];
-#else
-        [values addObject:[NSValue valueWithPoint:NSMakePoint(x, y)]];
-#endif
+    const double fromValues[2] = { from.x, from.y };
+    const double toValues[2] = { to.x, to.y };
+    const TimelineAnimationKeyframeCacheKey key = __cacheKey(function, TimelineAnimationKeyframeValueTypePoint,
+                                                             fromValues, toValues, 2, keyframeCount);
+    return [[TimelineAnimationKeyframeCache sharedCache] valuesForKey:key generator:^NSArray *{
+        double *const planes = (double *)malloc(sizeof(double) * 2 * keyframeCount);
+        if (planes == NULL) {
+            return @[];
+        }
+        TimelineAnimationKeyframeVectors(function, key.from, key.to, 2, keyframeCount, planes);
+        NSArray<NSValue *> *const values = __pointValues(planes, keyframeCount);
+        free(planes);
+        return values;
+    }];
+}
+
++ (NSArray<NSValue *> *)pointValuesWithProgress:(const double *)progress
+                                  keyframeCount:(size_t)keyframeCount
+                                           from:(CGPoint)from
+                                             to:(CGPoint)to {
+
+    double *const planes = (double *)malloc(sizeof(double) * 2 * keyframeCount);
+    if (planes == NULL) {
+        return @[];
     }
-    return [values copy];
+    const double fromValues[2] = { from.x, from.y };
+    const double toValues[2] = { to.x, to.y };
+    TimelineAnimationKeyframeInterpolate(progress, keyframeCount, fromValues, toValues, 2, planes);
+    NSArray<NSValue *> *const values = __pointValues(planes, keyframeCount);
+    free(planes);
+    return values;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromPoint:(CGPoint)from
+                             toPoint:(CGPoint)to
+                        maximumError:(CGFloat)maximumError {
+
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    double *progress = NULL;
+    NSArray<NSNumber *> *const keyTimes = __adaptiveKeyTimes(function, maximumError, &progress);
+    if (progress == NULL) {
+        animation.values = @[];
+        return animation;
+    }
+    animation.keyTimes = keyTimes;
+    animation.values = [self pointValuesWithProgress:progress
+                                       keyframeCount:keyTimes.count
+                                                from:from
+                                                  to:to];
+    free(progress);
+    return animation;
 }
 
 + (instancetype)animationWithKeyPath:(AnimationKeyPath)path
@@ -141,25 +460,59 @@
                                         to:(CGSize)to
                              keyframeCount:(size_t)keyframeCount {
     
-    NSMutableArray<NSValue *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
-    
-    double t = 0.0;
-    const CGFloat dt = (CGFloat)(1.0 / (keyframeCount - 1));
-    const CGFloat wDiff = (to.width - from.width);
-    const CGFloat hDiff = (to.height - from.height);
-    
-    for(size_t frame = 0; frame < keyframeCount; ++frame, t += dt) {
-        const CGFloat v = (CGFloat)function(t);
-        const CGFloat w = from.width  + v * wDiff;
-        const CGFloat h = from.height + v * hDiff;
-#if TARGET_OS_IPHONE
-        [values addObject:[NSValue valueWithCGSize:CGSizeMake(w, h)]];
-#else
-        [values addObject:[NSValue valueWithSize:NSMakeSize(w, h)]];
-#endif
+    const double fromValues[2] = { from.width, from.height };
+    const double toValues[2] = { to.width, to.height };
+    const TimelineAnimationKeyframeCacheKey key = __cacheKey(function, TimelineAnimationKeyframeValueTypeSize,
+                                                             fromValues, toValues, 2, keyframeCount);
+    return [[TimelineAnimationKeyframeCache sharedCache] valuesForKey:key generator:^NSArray *{
+        double *const planes = (double *)malloc(sizeof(double) * 2 * keyframeCount);
+        if (planes == NULL) {
+            return @[];
+        }
+        TimelineAnimationKeyframeVectors(function, key.from, key.to, 2, keyframeCount, planes);
+        NSArray<NSValue *> *const values = __sizeValues(planes, keyframeCount);
+        free(planes);
+        return values;
+    }];
+}
+
++ (NSArray<NSValue *> *)sizeValuesWithProgress:(const double *)progress
+                                 keyframeCount:(size_t)keyframeCount
+                                          from:(CGSize)from
+                                            to:(CGSize)to {
+
+    double *const planes = (double *)malloc(sizeof(double) * 2 * keyframeCount);
+    if (planes == NULL) {
+        return @[];
     }
+    const double fromValues[2] = { from.width, from.height };
+    const double toValues[2] = { to.width, to.height };
+    TimelineAnimationKeyframeInterpolate(progress, keyframeCount, fromValues, toValues, 2, planes);
+    NSArray<NSValue *> *const values = __sizeValues(planes, keyframeCount);
+    free(planes);
+    return values;
+}
 
-    return [values copy];
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromSize:(CGSize)from
+                              toSize:(CGSize)to
+                        maximumError:(CGFloat)maximumError {
+
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    double *progress = NULL;
+    NSArray<NSNumber *> *const keyTimes = __adaptiveKeyTimes(function, maximumError, &progress);
+    if (progress == NULL) {
+        animation.values = @[];
+        return animation;
+    }
+    animation.keyTimes = keyTimes;
+    animation.values = [self sizeValuesWithProgress:progress
+                                      keyframeCount:keyTimes.count
+                                               from:from
+                                                 to:to];
+    free(progress);
+    return animation;
 }
 
 
@@ -205,52 +558,539 @@
                                            from:(CGAffineTransform)from
                                              to:(CGAffineTransform)to
                                   keyframeCount:(size_t)keyframeCount {
-    NSMutableArray<NSValue *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
-    
-    const CGPoint fromTranslation  = CGPointMake(from.tx, from.ty);
-    const CGPoint toTranslation    = CGPointMake(to.tx, to.ty);
-    const CGFloat xTranslationDiff = (toTranslation.x - fromTranslation.x);
-    const CGFloat yTranslationDiff = (toTranslation.y - fromTranslation.y);
-    
-    
-    const CGFloat fromScale = (CGFloat)(hypot(from.a, from.c));
-    const CGFloat toScale   = (CGFloat)(hypot(to.a, to.c));
-    const CGFloat scaleDiff = (toScale - fromScale);
-    
-    const CGFloat fromRotation = (CGFloat)(atan2(from.c, from.a));
-    const CGFloat toRotation   = (CGFloat)(atan2(to.c, to.a));
-    
-    CGFloat deltaRotation = toRotation - fromRotation;
-    
-    if (deltaRotation < -M_PI) {
-        deltaRotation += (2 * M_PI);
+    const double fromValues[TimelineAnimationKeyframeAffineComponents] = { from.a, from.b, from.c, from.d, from.tx, from.ty };
+    const double toValues[TimelineAnimationKeyframeAffineComponents] = { to.a, to.b, to.c, to.d, to.tx, to.ty };
+    const TimelineAnimationKeyframeCacheKey key = __cacheKey(function, TimelineAnimationKeyframeValueTypeTransform,
+                                                             fromValues, toValues, TimelineAnimationKeyframeAffineComponents, keyframeCount);
+    return [[TimelineAnimationKeyframeCache sharedCache] valuesForKey:key generator:^NSArray *{
+        double *const planes = (double *)malloc(sizeof(double) * TimelineAnimationKeyframeAffineComponents * keyframeCount);
+        if (planes == NULL) {
+            return @[];
+        }
+        TimelineAnimationKeyframeAffineTransforms(function, key.from, key.to, keyframeCount, planes);
+        NSArray<NSValue *> *const values = __transformValues(planes, keyframeCount);
+        free(planes);
+        return values;
+    }];
+}
+
++ (NSArray<NSValue *> *)transformValuesWithProgress:(const double *)progress
+                                      keyframeCount:(size_t)keyframeCount
+                                               from:(CGAffineTransform)from
+                                                 to:(CGAffineTransform)to {
+    double *const planes = (double *)malloc(sizeof(double) * TimelineAnimationKeyframeAffineComponents * keyframeCount);
+    if (planes == NULL) {
+        return @[];
     }
-    else if (deltaRotation > M_PI) {
-        deltaRotation -= (2 * M_PI);
+    const double fromValues[TimelineAnimationKeyframeAffineComponents] = { from.a, from.b, from.c, from.d, from.tx, from.ty };
+    const double toValues[TimelineAnimationKeyframeAffineComponents] = { to.a, to.b, to.c, to.d, to.tx, to.ty };
+    TimelineAnimationKeyframeInterpolateAffineTransform(progress, keyframeCount, fromValues, toValues, planes);
+    NSArray<NSValue *> *const values = __transformValues(planes, keyframeCount);
+    free(planes);
+    return values;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                       fromTransform:(CGAffineTransform)from
+                         toTransform:(CGAffineTransform)to
+                        maximumError:(CGFloat)maximumError {
+
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    double *progress = NULL;
+    NSArray<NSNumber *> *const keyTimes = __adaptiveKeyTimes(function, maximumError, &progress);
+    if (progress == NULL) {
+        animation.values = @[];
+        return animation;
     }
-    
-    
-    
-    double t = 0.0;
-    const CGFloat dt = (CGFloat)(1.0 / (keyframeCount - 1));
-    for (size_t frame = 0; frame < keyframeCount; ++frame, t += dt) {
-        const CGFloat v = (CGFloat)function(t);
-        const CGFloat scale = fromScale + v * scaleDiff;
-        const CGFloat rotate = fromRotation + v * deltaRotation;
-        
-        const CGFloat translateX = fromTranslation.x + v * xTranslationDiff;
-        const CGFloat translateY = fromTranslation.y + v * yTranslationDiff;
-        
-        const CGAffineTransform affineTransform = CGAffineTransformMake(scale * cos(rotate), -scale * sin(rotate),
-                                                                        scale * sin(rotate), scale * cos(rotate),
-                                                                        translateX, translateY);
-        
-        const CATransform3D transform = CATransform3DMakeAffineTransform(affineTransform);
-        
-        [values addObject:[NSValue valueWithCATransform3D:transform]];
+    animation.keyTimes = keyTimes;
+    animation.values = [self transformValuesWithProgress:progress
+                                           keyframeCount:keyTimes.count
+                                                    from:from
+                                                      to:to];
+    free(progress);
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromRect:(CGRect)from
+                              toRect:(CGRect)to
+                       keyframeCount:(size_t)keyframeCount {
+
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.values = [self rectValuesFunction:function
+                                           from:from
+                                             to:to
+                                  keyframeCount:keyframeCount];
+    return animation;
+}
+
++ (NSArray<NSValue *> *)rectValuesFunction:(TimelineAnimationSpecialTimingFunction)function
+                                      from:(CGRect)from
+                                        to:(CGRect)to
+                             keyframeCount:(size_t)keyframeCount {
+
+    const double fromValues[4] = { from.origin.x, from.origin.y, from.size.width, from.size.height };
+    const double toValues[4] = { to.origin.x, to.origin.y, to.size.width, to.size.height };
+    const TimelineAnimationKeyframeCacheKey key = __cacheKey(function, TimelineAnimationKeyframeValueTypeRect,
+                                                             fromValues, toValues, 4, keyframeCount);
+    return [[TimelineAnimationKeyframeCache sharedCache] valuesForKey:key generator:^NSArray *{
+        double *const planes = (double *)malloc(sizeof(double) * 4 * keyframeCount);
+        if (planes == NULL) {
+            return @[];
+        }
+        TimelineAnimationKeyframeVectors(function, key.from, key.to, 4, keyframeCount, planes);
+        NSArray<NSValue *> *const values = __rectValues(planes, keyframeCount);
+        free(planes);
+        return values;
+    }];
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromRect:(CGRect)fromRect
+                              toRect:(CGRect)toRect {
+
+    return [self animationWithKeyPath:path
+                             function:function
+                             fromRect:fromRect
+                               toRect:toRect
+                        keyframeCount:DefaultKeyframeCount];
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue
+                     bezierTolerance:(CGFloat)tolerance {
+    NSParameterAssert(tolerance > 0);
+
+    TimelineAnimationBezierKeyframes *const keyframes = __bezierKeyframes(function, tolerance);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                                fromValue:fromValue
+                                  toValue:toValue
+                            keyframeCount:DefaultKeyframeCount];
     }
-    
-    return [values copy];
+    const double *const progress = (const double *)keyframes.progress.bytes;
+    const CGFloat diff = (toValue - fromValue);
+    NSMutableArray<NSNumber *> *const values = [[NSMutableArray alloc] initWithCapacity:keyframes.keyTimes.count];
+    for (NSUInteger frame = 0; frame < keyframes.keyTimes.count; ++frame) {
+        [values addObject:@((float)(fromValue + (CGFloat)progress[frame] * diff))];
+    }
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.values = [values copy];
+    animation.keyTimes = keyframes.keyTimes;
+    animation.timingFunctions = keyframes.timingFunctions;
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromPoint:(CGPoint)from
+                             toPoint:(CGPoint)to
+                     bezierTolerance:(CGFloat)tolerance {
+    NSParameterAssert(tolerance > 0);
+
+    TimelineAnimationBezierKeyframes *const keyframes = __bezierKeyframes(function, tolerance);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                                fromPoint:from
+                                  toPoint:to
+                            keyframeCount:DefaultKeyframeCount];
+    }
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.values = [self pointValuesWithProgress:(const double *)keyframes.progress.bytes
+                                       keyframeCount:keyframes.keyTimes.count
+                                                from:from
+                                                  to:to];
+    animation.keyTimes = keyframes.keyTimes;
+    animation.timingFunctions = keyframes.timingFunctions;
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromSize:(CGSize)from
+                              toSize:(CGSize)to
+                     bezierTolerance:(CGFloat)tolerance {
+    NSParameterAssert(tolerance > 0);
+
+    TimelineAnimationBezierKeyframes *const keyframes = __bezierKeyframes(function, tolerance);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                                 fromSize:from
+                                   toSize:to
+                            keyframeCount:DefaultKeyframeCount];
+    }
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.values = [self sizeValuesWithProgress:(const double *)keyframes.progress.bytes
+                                      keyframeCount:keyframes.keyTimes.count
+                                               from:from
+                                                 to:to];
+    animation.keyTimes = keyframes.keyTimes;
+    animation.timingFunctions = keyframes.timingFunctions;
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromRect:(CGRect)from
+                              toRect:(CGRect)to
+                     bezierTolerance:(CGFloat)tolerance {
+    NSParameterAssert(tolerance > 0);
+
+    TimelineAnimationBezierKeyframes *const keyframes = __bezierKeyframes(function, tolerance);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                                 fromRect:from
+                                   toRect:to
+                            keyframeCount:DefaultKeyframeCount];
+    }
+    const size_t keyframeCount = keyframes.keyTimes.count;
+    const double fromValues[4] = { from.origin.x, from.origin.y, from.size.width, from.size.height };
+    const double toValues[4] = { to.origin.x, to.origin.y, to.size.width, to.size.height };
+    double *const planes = (double *)malloc(sizeof(double) * 4 * keyframeCount);
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    if (planes == NULL) {
+        animation.values = @[];
+        return animation;
+    }
+    TimelineAnimationKeyframeInterpolate((const double *)keyframes.progress.bytes, keyframeCount,
+                                         fromValues, toValues, 4, planes);
+    animation.values = __rectValues(planes, keyframeCount);
+    animation.keyTimes = keyframes.keyTimes;
+    animation.timingFunctions = keyframes.timingFunctions;
+    free(planes);
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                       fromTransform:(CGAffineTransform)from
+                         toTransform:(CGAffineTransform)to
+                     bezierTolerance:(CGFloat)tolerance {
+    NSParameterAssert(tolerance > 0);
+
+    TimelineAnimationBezierKeyframes *const keyframes = __bezierKeyframes(function, tolerance);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                            fromTransform:from
+                              toTransform:to
+                            keyframeCount:DefaultKeyframeCount];
+    }
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.values = [self transformValuesWithProgress:(const double *)keyframes.progress.bytes
+                                           keyframeCount:keyframes.keyTimes.count
+                                                    from:from
+                                                      to:to];
+    animation.keyTimes = keyframes.keyTimes;
+    animation.timingFunctions = keyframes.timingFunctions;
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue
+                  splineMaximumError:(CGFloat)maximumError {
+    NSParameterAssert(maximumError > 0);
+
+    TimelineAnimationSplineKeyframes *const keyframes = __splineKeyframes(function, maximumError);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                                fromValue:fromValue
+                                  toValue:toValue
+                            keyframeCount:DefaultKeyframeCount];
+    }
+    const double *const progress = (const double *)keyframes.progress.bytes;
+    const CGFloat diff = (toValue - fromValue);
+    NSMutableArray<NSNumber *> *const values = [[NSMutableArray alloc] initWithCapacity:keyframes.keyTimes.count];
+    for (NSUInteger frame = 0; frame < keyframes.keyTimes.count; ++frame) {
+        [values addObject:@((float)(fromValue + (CGFloat)progress[frame] * diff))];
+    }
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.calculationMode = keyframes.calculationMode;
+    animation.values = [values copy];
+    animation.keyTimes = keyframes.keyTimes;
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                           fromPoint:(CGPoint)from
+                             toPoint:(CGPoint)to
+                  splineMaximumError:(CGFloat)maximumError {
+    NSParameterAssert(maximumError > 0);
+
+    TimelineAnimationSplineKeyframes *const keyframes = __splineKeyframes(function, maximumError);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                                fromPoint:from
+                                  toPoint:to
+                            keyframeCount:DefaultKeyframeCount];
+    }
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.calculationMode = keyframes.calculationMode;
+    animation.values = [self pointValuesWithProgress:(const double *)keyframes.progress.bytes
+                                       keyframeCount:keyframes.keyTimes.count
+                                                from:from
+                                                  to:to];
+    animation.keyTimes = keyframes.keyTimes;
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromSize:(CGSize)from
+                              toSize:(CGSize)to
+                  splineMaximumError:(CGFloat)maximumError {
+    NSParameterAssert(maximumError > 0);
+
+    TimelineAnimationSplineKeyframes *const keyframes = __splineKeyframes(function, maximumError);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                                 fromSize:from
+                                   toSize:to
+                            keyframeCount:DefaultKeyframeCount];
+    }
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.calculationMode = keyframes.calculationMode;
+    animation.values = [self sizeValuesWithProgress:(const double *)keyframes.progress.bytes
+                                      keyframeCount:keyframes.keyTimes.count
+                                               from:from
+                                                 to:to];
+    animation.keyTimes = keyframes.keyTimes;
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                            function:(TimelineAnimationSpecialTimingFunction)function
+                            fromRect:(CGRect)from
+                              toRect:(CGRect)to
+                  splineMaximumError:(CGFloat)maximumError {
+    NSParameterAssert(maximumError > 0);
+
+    TimelineAnimationSplineKeyframes *const keyframes = __splineKeyframes(function, maximumError);
+    if (keyframes == nil) {
+        return [self animationWithKeyPath:path
+                                 function:function
+                                 fromRect:from
+                                   toRect:to
+                            keyframeCount:DefaultKeyframeCount];
+    }
+    const size_t keyframeCount = keyframes.keyTimes.count;
+    const double fromValues[4] = { from.origin.x, from.origin.y, from.size.width, from.size.height };
+    const double toValues[4] = { to.origin.x, to.origin.y, to.size.width, to.size.height };
+    double *const planes = (double *)malloc(sizeof(double) * 4 * keyframeCount);
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    if (planes == NULL) {
+        animation.values = @[];
+        return animation;
+    }
+    TimelineAnimationKeyframeInterpolate((const double *)keyframes.progress.bytes, keyframeCount,
+                                         fromValues, toValues, 4, planes);
+    animation.calculationMode = keyframes.calculationMode;
+    animation.values = __rectValues(planes, keyframeCount);
+    animation.keyTimes = keyframes.keyTimes;
+    free(planes);
+    return animation;
+}
+
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                         key:(TimelineAnimationKeyframeCacheKey)key {
+    NSParameterAssert(key.keyframeCount >= 2);
+
+    TimelineAnimationDeferredKeyframes *const deferred = [[TimelineAnimationDeferredKeyframes alloc] init];
+    deferred->_key = key;
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    [animation setValue:deferred forKey:__deferredKeyframesKey];
+    return animation;
+}
+
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                                   fromValue:(CGFloat)fromValue
+                                     toValue:(CGFloat)toValue
+                               keyframeCount:(size_t)keyframeCount {
+    const double fromValues[1] = { fromValue };
+    const double toValues[1] = { toValue };
+    return [self deferredAnimationWithKeyPath:path
+                                          key:__cacheKey(function, TimelineAnimationKeyframeValueTypeNumber,
+                                                         fromValues, toValues, 1, keyframeCount)];
+}
+
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                                   fromPoint:(CGPoint)from
+                                     toPoint:(CGPoint)to
+                               keyframeCount:(size_t)keyframeCount {
+    const double fromValues[2] = { from.x, from.y };
+    const double toValues[2] = { to.x, to.y };
+    return [self deferredAnimationWithKeyPath:path
+                                          key:__cacheKey(function, TimelineAnimationKeyframeValueTypePoint,
+                                                         fromValues, toValues, 2, keyframeCount)];
+}
+
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                                    fromSize:(CGSize)from
+                                      toSize:(CGSize)to
+                               keyframeCount:(size_t)keyframeCount {
+    const double fromValues[2] = { from.width, from.height };
+    const double toValues[2] = { to.width, to.height };
+    return [self deferredAnimationWithKeyPath:path
+                                          key:__cacheKey(function, TimelineAnimationKeyframeValueTypeSize,
+                                                         fromValues, toValues, 2, keyframeCount)];
+}
+
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                                    fromRect:(CGRect)from
+                                      toRect:(CGRect)to
+                               keyframeCount:(size_t)keyframeCount {
+    const double fromValues[4] = { from.origin.x, from.origin.y, from.size.width, from.size.height };
+    const double toValues[4] = { to.origin.x, to.origin.y, to.size.width, to.size.height };
+    return [self deferredAnimationWithKeyPath:path
+                                          key:__cacheKey(function, TimelineAnimationKeyframeValueTypeRect,
+                                                         fromValues, toValues, 4, keyframeCount)];
+}
+
++ (instancetype)deferredAnimationWithKeyPath:(AnimationKeyPath)path
+                                    function:(TimelineAnimationSpecialTimingFunction)function
+                               fromTransform:(CGAffineTransform)from
+                                 toTransform:(CGAffineTransform)to
+                               keyframeCount:(size_t)keyframeCount {
+    const double fromValues[TimelineAnimationKeyframeAffineComponents] = { from.a, from.b, from.c, from.d, from.tx, from.ty };
+    const double toValues[TimelineAnimationKeyframeAffineComponents] = { to.a, to.b, to.c, to.d, to.tx, to.ty };
+    return [self deferredAnimationWithKeyPath:path
+                                          key:__cacheKey(function, TimelineAnimationKeyframeValueTypeTransform,
+                                                         fromValues, toValues,
+                                                         TimelineAnimationKeyframeAffineComponents, keyframeCount)];
+}
+
+- (BOOL)hasDeferredValues {
+    return [[self valueForKey:__deferredKeyframesKey] isKindOfClass:[TimelineAnimationDeferredKeyframes class]];
+}
+
+- (void)materializeValues {
+    TimelineAnimationDeferredKeyframes *const deferred = [self valueForKey:__deferredKeyframesKey];
+    if (![deferred isKindOfClass:[TimelineAnimationDeferredKeyframes class]]) {
+        return;
+    }
+    const TimelineAnimationKeyframeCacheKey key = deferred->_key;
+    const TimelineAnimationSpecialTimingFunction function = key.function;
+    const size_t keyframeCount = key.keyframeCount;
+    NSArray *values = nil;
+    switch (key.type) {
+        case TimelineAnimationKeyframeValueTypeNumber:
+            values = [CAKeyframeAnimation numberValuesFunction:function
+                                                          from:(CGFloat)key.from[0]
+                                                            to:(CGFloat)key.to[0]
+                                                 keyframeCount:keyframeCount];
+            break;
+        case TimelineAnimationKeyframeValueTypePoint:
+            values = [CAKeyframeAnimation pointValuesFunction:function
+                                                         from:CGPointMake((CGFloat)key.from[0], (CGFloat)key.from[1])
+                                                           to:CGPointMake((CGFloat)key.to[0], (CGFloat)key.to[1])
+                                                keyframeCount:keyframeCount];
+            break;
+        case TimelineAnimationKeyframeValueTypeSize:
+            values = [CAKeyframeAnimation sizeValuesFunction:function
+                                                        from:CGSizeMake((CGFloat)key.from[0], (CGFloat)key.from[1])
+                                                          to:CGSizeMake((CGFloat)key.to[0], (CGFloat)key.to[1])
+                                               keyframeCount:keyframeCount];
+            break;
+        case TimelineAnimationKeyframeValueTypeRect:
+            values = [CAKeyframeAnimation rectValuesFunction:function
+                                                        from:CGRectMake((CGFloat)key.from[0], (CGFloat)key.from[1],
+                                                                        (CGFloat)key.from[2], (CGFloat)key.from[3])
+                                                          to:CGRectMake((CGFloat)key.to[0], (CGFloat)key.to[1],
+                                                                        (CGFloat)key.to[2], (CGFloat)key.to[3])
+                                               keyframeCount:keyframeCount];
+            break;
+        case TimelineAnimationKeyframeValueTypeTransform:
+            values = [CAKeyframeAnimation transformValuesFunction:function
+                                                             from:CGAffineTransformMake((CGFloat)key.from[0], (CGFloat)key.from[1],
+                                                                                        (CGFloat)key.from[2], (CGFloat)key.from[3],
+                                                                                        (CGFloat)key.from[4], (CGFloat)key.from[5])
+                                                               to:CGAffineTransformMake((CGFloat)key.to[0], (CGFloat)key.to[1],
+                                                                                        (CGFloat)key.to[2], (CGFloat)key.to[3],
+                                                                                        (CGFloat)key.to[4], (CGFloat)key.to[5])
+                                                    keyframeCount:keyframeCount];
+            break;
+    }
+    self.values = values;
+    [self setValue:nil forKey:__deferredKeyframesKey];
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                                mass:(CGFloat)mass
+                           stiffness:(CGFloat)stiffness
+                             damping:(CGFloat)damping
+                     initialVelocity:(CGFloat)initialVelocity
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue
+                       keyframeCount:(size_t)keyframeCount {
+    NSParameterAssert(mass > 0);
+    NSParameterAssert(stiffness > 0);
+    NSParameterAssert(damping > 0);
+    NSParameterAssert(keyframeCount >= 2);
+
+    // clamped as documented, so that the spring always settles and there is
+    // always an animation to return
+    keyframeCount = MAX(keyframeCount, (size_t)2);
+    TimelineAnimationSpring spring;
+    TimelineAnimationSpringInit(&spring,
+                                fmax((double)mass, SpringMinimumParameter),
+                                fmax((double)stiffness, SpringMinimumParameter),
+                                fmax((double)damping, SpringMinimumParameter),
+                                isfinite(initialVelocity) ? (double)initialVelocity : 0.0);
+    const double duration = TimelineAnimationSpringSettlingTime(&spring, TimelineAnimationSpringDefaultTolerance);
+
+    NSMutableData *const progressData = [[NSMutableData alloc] initWithLength:sizeof(double) * keyframeCount];
+    double *const progress = (double *)progressData.mutableBytes;
+    TimelineAnimationSpringKeyframeProgress(&spring, duration, keyframeCount, progress);
+    // settled, end exactly on the value
+    progress[keyframeCount - 1] = 1.0;
+
+    NSMutableArray<NSNumber *> *const values = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)keyframeCount];
+    const CGFloat diff = (toValue - fromValue);
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+        [values addObject:@((float)(fromValue + (CGFloat)progress[frame] * diff))];
+    }
+
+    CAKeyframeAnimation *const animation = [CAKeyframeAnimation animationWithKeyPath:path];
+    animation.values = [values copy];
+    animation.duration = (CFTimeInterval)duration;
+    return animation;
+}
+
++ (instancetype)animationWithKeyPath:(AnimationKeyPath)path
+                                mass:(CGFloat)mass
+                           stiffness:(CGFloat)stiffness
+                             damping:(CGFloat)damping
+                     initialVelocity:(CGFloat)initialVelocity
+                           fromValue:(CGFloat)fromValue
+                             toValue:(CGFloat)toValue {
+
+    return [self animationWithKeyPath:path
+                                 mass:mass
+                            stiffness:stiffness
+                              damping:damping
+                      initialVelocity:initialVelocity
+                            fromValue:fromValue
+                              toValue:toValue
+                        keyframeCount:DefaultKeyframeCount];
 }
 
 
@@ -0,0 +1,534 @@
+/*!
+ *  @file TimelineAnimationEasingExpression.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "TimelineAnimationEasingExpression.h"
+#include "TimelineAnimationSpecialTimingFunctionBatch.h"
+
+// The progress values evaluated together. Every instruction runs over a whole
+// chunk, so the interpretation costs once per chunk and not once per value.
+// The last chunk is padded: loops of a constant length are vectorised at -O2
+// and -Os, which keeps their stores as wide as the loads of the batch kernels.
+#define TA_EXPRESSION_CHUNK 64
+
+typedef enum {
+    TA_NODE_CURVE = 0,
+    TA_NODE_BEZIER,
+    TA_NODE_REVERSE,
+    TA_NODE_MIRROR,
+    TA_NODE_CONCATENATE,
+    TA_NODE_BLEND,
+    TA_NODE_CLAMP,
+    TA_NODE_REPEAT,
+} TimelineAnimationEasingNodeKind;
+
+// The program works on two stacks: the progress values the curves read, whose
+// bottom is the input, and the values they produce. Reversing, mirroring and
+// concatenating only scale and offset the time, so the compiler folds that
+// into the instructions that read it instead of pushing a new time.
+typedef enum {
+    /// pushes function(a * time + b)
+    TA_OP_CURVE = 0,
+    /// pushes the Bézier curve `operand` at a * time + b
+    TA_OP_BEZIER,
+    /// pushes the position of a * time + b in its repetition
+    TA_OP_TIME_REPEAT,
+    /// pops the time
+    TA_OP_TIME_POP,
+    /// value = a * value + b
+    TA_OP_VALUE_AFFINE,
+    /// value = clamp(value, a, b)
+    TA_OP_VALUE_CLAMP,
+    /// pops second and first, pushes (1 - a) * first + a * second
+    TA_OP_BLEND,
+    /// pops second and first, pushes first if a * time + b < c, second
+    /// otherwise
+    TA_OP_SELECT,
+} TimelineAnimationEasingOp;
+
+typedef struct {
+    TimelineAnimationEasingProgram *program;
+    int timeDepth;
+    int valueDepth;
+} TimelineAnimationEasingCompiler;
+
+// MARK: - Building
+
+void TimelineAnimationEasingExpressionInit(TimelineAnimationEasingExpression *expression)
+{
+    expression->count = 0;
+}
+
+static inline int TimelineAnimationEasingIsValid(const TimelineAnimationEasingExpression *expression,
+                                                 TimelineAnimationEasingNode node)
+{
+    return node >= 0 && node < expression->count;
+}
+
+static TimelineAnimationEasingNode TimelineAnimationEasingAdd(TimelineAnimationEasingExpression *expression,
+                                                              TimelineAnimationEasingNodeKind kind,
+                                                              TimelineAnimationEasingNode first,
+                                                              TimelineAnimationEasingNode second,
+                                                              double a,
+                                                              double b)
+{
+    if (expression->count >= TimelineAnimationEasingExpressionCapacity) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    TimelineAnimationEasingExpressionNode *const node = &expression->nodes[expression->count];
+    memset(node, 0, sizeof(*node));
+    node->kind = kind;
+    node->first = first;
+    node->second = second;
+    node->a = a;
+    node->b = b;
+    return expression->count++;
+}
+
+TimelineAnimationEasingNode TimelineAnimationEasingCurve(TimelineAnimationEasingExpression *expression,
+                                                         TimelineAnimationSpecialTimingFunction function)
+{
+    if (function == NULL) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    const TimelineAnimationEasingNode node = TimelineAnimationEasingAdd(expression, TA_NODE_CURVE,
+                                                                        TimelineAnimationEasingNodeInvalid,
+                                                                        TimelineAnimationEasingNodeInvalid,
+                                                                        0.0, 0.0);
+    if (node != TimelineAnimationEasingNodeInvalid) {
+        expression->nodes[node].function = function;
+    }
+    return node;
+}
+
+TimelineAnimationEasingNode TimelineAnimationEasingBezier(TimelineAnimationEasingExpression *expression,
+                                                          TimelineAnimationCubicBezierControlPoints points)
+{
+    // beyond [0, 1] the curve would not be a function of time
+    if (!(points.x1 >= 0.0f && points.x1 <= 1.0f && points.x2 >= 0.0f && points.x2 <= 1.0f)
+        || isnan(points.y1) || isnan(points.y2)) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    const TimelineAnimationEasingNode node = TimelineAnimationEasingAdd(expression, TA_NODE_BEZIER,
+                                                                        TimelineAnimationEasingNodeInvalid,
+                                                                        TimelineAnimationEasingNodeInvalid,
+                                                                        0.0, 0.0);
+    if (node != TimelineAnimationEasingNodeInvalid) {
+        expression->nodes[node].points = points;
+    }
+    return node;
+}
+
+TimelineAnimationEasingNode TimelineAnimationEasingReverse(TimelineAnimationEasingExpression *expression,
+                                                           TimelineAnimationEasingNode node)
+{
+    if (!TimelineAnimationEasingIsValid(expression, node)) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    return TimelineAnimationEasingAdd(expression, TA_NODE_REVERSE, node, TimelineAnimationEasingNodeInvalid, 0.0, 0.0);
+}
+
+TimelineAnimationEasingNode TimelineAnimationEasingMirror(TimelineAnimationEasingExpression *expression,
+                                                          TimelineAnimationEasingNode node)
+{
+    if (!TimelineAnimationEasingIsValid(expression, node)) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    return TimelineAnimationEasingAdd(expression, TA_NODE_MIRROR, node, TimelineAnimationEasingNodeInvalid, 0.0, 0.0);
+}
+
+TimelineAnimationEasingNode TimelineAnimationEasingConcatenate(TimelineAnimationEasingExpression *expression,
+                                                               TimelineAnimationEasingNode first,
+                                                               TimelineAnimationEasingNode second,
+                                                               double split,
+                                                               double value)
+{
+    if (!TimelineAnimationEasingIsValid(expression, first)
+        || !TimelineAnimationEasingIsValid(expression, second)
+        || !(split > 0.0 && split < 1.0)
+        || !isfinite(value)) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    return TimelineAnimationEasingAdd(expression, TA_NODE_CONCATENATE, first, second, split, value);
+}
+
+TimelineAnimationEasingNode TimelineAnimationEasingBlend(TimelineAnimationEasingExpression *expression,
+                                                         TimelineAnimationEasingNode first,
+                                                         TimelineAnimationEasingNode second,
+                                                         double weight)
+{
+    if (!TimelineAnimationEasingIsValid(expression, first)
+        || !TimelineAnimationEasingIsValid(expression, second)
+        || !isfinite(weight)) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    return TimelineAnimationEasingAdd(expression, TA_NODE_BLEND, first, second, weight, 0.0);
+}
+
+TimelineAnimationEasingNode TimelineAnimationEasingClamp(TimelineAnimationEasingExpression *expression,
+                                                         TimelineAnimationEasingNode node,
+                                                         double minimum,
+                                                         double maximum)
+{
+    if (!TimelineAnimationEasingIsValid(expression, node) || !(minimum <= maximum)) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    return TimelineAnimationEasingAdd(expression, TA_NODE_CLAMP, node, TimelineAnimationEasingNodeInvalid, minimum, maximum);
+}
+
+TimelineAnimationEasingNode TimelineAnimationEasingRepeat(TimelineAnimationEasingExpression *expression,
+                                                          TimelineAnimationEasingNode node,
+                                                          double count)
+{
+    if (!TimelineAnimationEasingIsValid(expression, node) || !(count > 0.0) || !isfinite(count)) {
+        return TimelineAnimationEasingNodeInvalid;
+    }
+    return TimelineAnimationEasingAdd(expression, TA_NODE_REPEAT, node, TimelineAnimationEasingNodeInvalid, count, 0.0);
+}
+
+// MARK: - Compiling
+
+static int TimelineAnimationEasingEmit(TimelineAnimationEasingCompiler *compiler,
+                                       TimelineAnimationEasingOp op,
+                                       double a,
+                                       double b,
+                                       double c)
+{
+    TimelineAnimationEasingProgram *const program = compiler->program;
+    if (program->count >= TimelineAnimationEasingProgramCapacity) {
+        return 0;
+    }
+    switch (op) {
+        case TA_OP_CURVE:
+        case TA_OP_BEZIER:
+            compiler->valueDepth += 1;
+            break;
+        case TA_OP_TIME_REPEAT:
+            compiler->timeDepth += 1;
+            break;
+        case TA_OP_TIME_POP:
+            compiler->timeDepth -= 1;
+            break;
+        case TA_OP_BLEND:
+        case TA_OP_SELECT:
+            compiler->valueDepth -= 1;
+            break;
+        case TA_OP_VALUE_AFFINE:
+        case TA_OP_VALUE_CLAMP:
+            break;
+    }
+    // the bottom of the time stack is the input, it is not stored
+    if (compiler->timeDepth > TimelineAnimationEasingProgramStackDepth
+        || compiler->valueDepth > TimelineAnimationEasingProgramStackDepth) {
+        return 0;
+    }
+    TimelineAnimationEasingInstruction *const instruction = &program->instructions[program->count++];
+    memset(instruction, 0, sizeof(*instruction));
+    instruction->op = op;
+    instruction->a = a;
+    instruction->b = b;
+    instruction->c = c;
+    return 1;
+}
+
+// Compiles `index` as read at time a * time + b.
+static int TimelineAnimationEasingCompileNode(TimelineAnimationEasingCompiler *compiler,
+                                              const TimelineAnimationEasingExpression *expression,
+                                              TimelineAnimationEasingNode index,
+                                              double a,
+                                              double b)
+{
+    TimelineAnimationEasingProgram *const program = compiler->program;
+    const TimelineAnimationEasingExpressionNode *const node = &expression->nodes[index];
+    switch ((TimelineAnimationEasingNodeKind)node->kind) {
+        case TA_NODE_CURVE: {
+            if (!TimelineAnimationEasingEmit(compiler, TA_OP_CURVE, a, b, 0.0)) {
+                return 0;
+            }
+            TimelineAnimationEasingInstruction *const instruction = &program->instructions[program->count - 1];
+            instruction->function = node->function;
+            instruction->batch = TimelineAnimationSpecialTimingBatchFunctionFor(node->function);
+            return 1;
+        }
+
+        case TA_NODE_BEZIER:
+            if (program->bezierCount >= TimelineAnimationEasingProgramBezierCapacity
+                || !TimelineAnimationEasingEmit(compiler, TA_OP_BEZIER, a, b, 0.0)) {
+                return 0;
+            }
+            TimelineAnimationCubicBezierInit(&program->beziers[program->bezierCount], node->points, 1);
+            program->instructions[program->count - 1].operand = program->bezierCount++;
+            return 1;
+
+        case TA_NODE_REVERSE:
+            return TimelineAnimationEasingCompileNode(compiler, expression, node->first, -a, 1.0 - b);
+
+        case TA_NODE_MIRROR:
+            return TimelineAnimationEasingCompileNode(compiler, expression, node->first, -a, 1.0 - b)
+                && TimelineAnimationEasingEmit(compiler, TA_OP_VALUE_AFFINE, -1.0, 1.0, 0.0);
+
+        case TA_NODE_CONCATENATE: {
+            // both halves run over the whole chunk and the select keeps the
+            // relevant one, cheaper than splitting the chunk for curves this
+            // short
+            const double split = node->a;
+            const double value = node->b;
+            const double firstScale = 1.0 / split;
+            const double secondScale = 1.0 / (1.0 - split);
+            const double secondOffset = -split / (1.0 - split);
+            return TimelineAnimationEasingCompileNode(compiler, expression, node->first, a * firstScale, b * firstScale)
+                && TimelineAnimationEasingEmit(compiler, TA_OP_VALUE_AFFINE, value, 0.0, 0.0)
+                && TimelineAnimationEasingCompileNode(compiler, expression, node->second,
+                                                      a * secondScale, b * secondScale + secondOffset)
+                && TimelineAnimationEasingEmit(compiler, TA_OP_VALUE_AFFINE, 1.0 - value, value, 0.0)
+                && TimelineAnimationEasingEmit(compiler, TA_OP_SELECT, a, b, split);
+        }
+
+        case TA_NODE_BLEND:
+            return TimelineAnimationEasingCompileNode(compiler, expression, node->first, a, b)
+                && TimelineAnimationEasingCompileNode(compiler, expression, node->second, a, b)
+                && TimelineAnimationEasingEmit(compiler, TA_OP_BLEND, node->a, 0.0, 0.0);
+
+        case TA_NODE_CLAMP:
+            return TimelineAnimationEasingCompileNode(compiler, expression, node->first, a, b)
+                && TimelineAnimationEasingEmit(compiler, TA_OP_VALUE_CLAMP, node->a, node->b, 0.0);
+
+        case TA_NODE_REPEAT:
+            // the repetition is not affine, the time is materialised
+            return TimelineAnimationEasingEmit(compiler, TA_OP_TIME_REPEAT, node->a * a, node->a * b, 0.0)
+                && TimelineAnimationEasingCompileNode(compiler, expression, node->first, 1.0, 0.0)
+                && TimelineAnimationEasingEmit(compiler, TA_OP_TIME_POP, 0.0, 0.0, 0.0);
+    }
+    return 0;
+}
+
+int TimelineAnimationEasingCompile(const TimelineAnimationEasingExpression *expression,
+                                   TimelineAnimationEasingNode root,
+                                   TimelineAnimationEasingProgram *program)
+{
+    program->count = 0;
+    program->bezierCount = 0;
+    if (!TimelineAnimationEasingIsValid(expression, root)) {
+        return 0;
+    }
+    TimelineAnimationEasingCompiler compiler = { program, 0, 0 };
+    if (!TimelineAnimationEasingCompileNode(&compiler, expression, root, 1.0, 0.0)) {
+        program->count = 0;
+        program->bezierCount = 0;
+        return 0;
+    }
+    return 1;
+}
+
+// MARK: - Evaluating
+
+static inline int TimelineAnimationEasingIsIdentity(const TimelineAnimationEasingInstruction *instruction)
+{
+    return instruction->a == 1.0 && instruction->b == 0.0;
+}
+
+static inline double TimelineAnimationEasingRepetition(double u)
+{
+    // the ends of the repetitions map to 1, so that the last one ends on the
+    // last value
+    return (u > 0.0) ? u - ceil(u) + 1.0 : u;
+}
+
+// Evaluates a whole chunk.
+static void TimelineAnimationEasingRun(const TimelineAnimationEasingProgram *program,
+                                       const double *in,
+                                       double *out)
+{
+    double times[TimelineAnimationEasingProgramStackDepth][TA_EXPRESSION_CHUNK];
+    double values[TimelineAnimationEasingProgramStackDepth][TA_EXPRESSION_CHUNK];
+    const double *time = in;
+    int timeDepth = 0;
+    int valueDepth = 0;
+
+    for (int i = 0; i < program->count; ++i) {
+        const TimelineAnimationEasingInstruction *const instruction = &program->instructions[i];
+        const double a = instruction->a;
+        const double b = instruction->b;
+        switch ((TimelineAnimationEasingOp)instruction->op) {
+            case TA_OP_CURVE:
+            case TA_OP_BEZIER: {
+                double *const value = values[valueDepth++];
+                const double *source = time;
+                // the curves run in place on their own time
+                if (!TimelineAnimationEasingIsIdentity(instruction)) {
+                    for (size_t j = 0; j < TA_EXPRESSION_CHUNK; ++j) {
+                        value[j] = a * time[j] + b;
+                    }
+                    source = value;
+                }
+                if (instruction->op == TA_OP_BEZIER) {
+                    TimelineAnimationCubicBezierSolveBatch(&program->beziers[instruction->operand], source, value,
+                                                           TA_EXPRESSION_CHUNK, TimelineAnimationCubicBezierDefaultEpsilon);
+                }
+                else if (instruction->batch) {
+                    instruction->batch(source, value, TA_EXPRESSION_CHUNK);
+                }
+                else {
+                    for (size_t j = 0; j < TA_EXPRESSION_CHUNK; ++j) {
+                        value[j] = instruction->function(source[j]);
+                    }
+                }
+                break;
+            }
+
+            case TA_OP_TIME_REPEAT: {
+                double *const next = times[timeDepth++];
+                for (size_t j = 0; j < TA_EXPRESSION_CHUNK; ++j) {
+                    next[j] = TimelineAnimationEasingRepetition(a * time[j] + b);
+                }
+                time = next;
+                break;
+            }
+
+            case TA_OP_TIME_POP:
+                timeDepth -= 1;
+                time = (timeDepth == 0) ? in : times[timeDepth - 1];
+                break;
+
+            case TA_OP_VALUE_AFFINE: {
+                double *const value = values[valueDepth - 1];
+                for (size_t j = 0; j < TA_EXPRESSION_CHUNK; ++j) {
+                    value[j] = a * value[j] + b;
+                }
+                break;
+            }
+
+            case TA_OP_VALUE_CLAMP: {
+                double *const value = values[valueDepth - 1];
+                for (size_t j = 0; j < TA_EXPRESSION_CHUNK; ++j) {
+                    const double v = (value[j] < a) ? a : value[j];
+                    value[j] = (v > b) ? b : v;
+                }
+                break;
+            }
+
+            case TA_OP_BLEND: {
+                const double *const second = values[--valueDepth];
+                double *const first = values[valueDepth - 1];
+                for (size_t j = 0; j < TA_EXPRESSION_CHUNK; ++j) {
+                    first[j] = (1.0 - a) * first[j] + a * second[j];
+                }
+                break;
+            }
+
+            case TA_OP_SELECT: {
+                const double c = instruction->c;
+                const double *const second = values[--valueDepth];
+                double *const first = values[valueDepth - 1];
+                for (size_t j = 0; j < TA_EXPRESSION_CHUNK; ++j) {
+                    first[j] = (a * time[j] + b < c) ? first[j] : second[j];
+                }
+                break;
+            }
+        }
+    }
+    memcpy(out, values[0], sizeof(values[0]));
+}
+
+double TimelineAnimationEasingProgramEvaluate(const TimelineAnimationEasingProgram *program, double p)
+{
+    // the same instructions, one value at a time
+    double times[TimelineAnimationEasingProgramStackDepth + 1];
+    double values[TimelineAnimationEasingProgramStackDepth];
+    int timeDepth = 0;
+    int valueDepth = 0;
+    times[0] = p;
+
+    if (program->count == 0) {
+        return p;
+    }
+    for (int i = 0; i < program->count; ++i) {
+        const TimelineAnimationEasingInstruction *const instruction = &program->instructions[i];
+        const double a = instruction->a;
+        const double b = instruction->b;
+        const double t = times[timeDepth];
+        switch ((TimelineAnimationEasingOp)instruction->op) {
+            case TA_OP_CURVE:
+                values[valueDepth++] = instruction->function(a * t + b);
+                break;
+
+            case TA_OP_BEZIER:
+                values[valueDepth++] = TimelineAnimationCubicBezierSolve(&program->beziers[instruction->operand], a * t + b,
+                                                                         TimelineAnimationCubicBezierDefaultEpsilon);
+                break;
+
+            case TA_OP_TIME_REPEAT:
+                times[++timeDepth] = TimelineAnimationEasingRepetition(a * t + b);
+                break;
+
+            case TA_OP_TIME_POP:
+                timeDepth -= 1;
+                break;
+
+            case TA_OP_VALUE_AFFINE:
+                values[valueDepth - 1] = a * values[valueDepth - 1] + b;
+                break;
+
+            case TA_OP_VALUE_CLAMP: {
+                const double v = (values[valueDepth - 1] < a) ? a : values[valueDepth - 1];
+                values[valueDepth - 1] = (v > b) ? b : v;
+                break;
+            }
+
+            case TA_OP_BLEND:
+                valueDepth -= 1;
+                values[valueDepth - 1] = (1.0 - a) * values[valueDepth - 1] + a * values[valueDepth];
+                break;
+
+            case TA_OP_SELECT:
+                valueDepth -= 1;
+                values[valueDepth - 1] = (a * t + b < instruction->c) ? values[valueDepth - 1] : values[valueDepth];
+                break;
+        }
+    }
+    return values[0];
+}
+
+void TimelineAnimationEasingProgramEvaluateBatch(const TimelineAnimationEasingProgram *program,
+                                                 const double *in,
+                                                 double *out,
+                                                 size_t n)
+{
+    // an empty program, from a failed compilation, is the identity
+    if (program->count == 0) {
+        if (out != in) {
+            memmove(out, in, sizeof(double) * n);
+        }
+        return;
+    }
+    // a lone curve needs no stack
+    const TimelineAnimationEasingInstruction *const first = &program->instructions[0];
+    if (program->count == 1 && first->op == TA_OP_CURVE && first->batch && TimelineAnimationEasingIsIdentity(first)) {
+        first->batch(in, out, n);
+        return;
+    }
+
+    size_t i = 0;
+    for (; i + TA_EXPRESSION_CHUNK <= n; i += TA_EXPRESSION_CHUNK) {
+        TimelineAnimationEasingRun(program, in + i, out + i);
+    }
+    if (i < n) {
+        // pads with the last value, which the curves are defined at
+        double padded[TA_EXPRESSION_CHUNK];
+        double result[TA_EXPRESSION_CHUNK];
+        const size_t count = n - i;
+        memcpy(padded, in + i, sizeof(double) * count);
+        for (size_t j = count; j < TA_EXPRESSION_CHUNK; ++j) {
+            padded[j] = in[n - 1];
+        }
+        TimelineAnimationEasingRun(program, padded, result);
+        memcpy(out + i, result, sizeof(double) * count);
+    }
+}
@@ -0,0 +1,161 @@
+/*!
+ *  @file TimelineAnimationEasingExpression.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_EASING_EXPRESSION_H
+#define TIMELINE_ANIMATIONS_EASING_EXPRESSION_H
+
+#include <stddef.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+#include "TimelineAnimationCubicBezier.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // Easing expressions compose the timing functions and Bézier curves into
+    // new curves, without writing a C function for each of them:
+    //
+    //     TimelineAnimationEasingExpression expression;
+    //     TimelineAnimationEasingExpressionInit(&expression);
+    //     const TimelineAnimationEasingNode in = TimelineAnimationEasingCurve(&expression, BackEaseIn);
+    //     const TimelineAnimationEasingNode out = TimelineAnimationEasingCurve(&expression, BounceEaseOut);
+    //     const TimelineAnimationEasingNode root = TimelineAnimationEasingConcatenate(&expression, in, out, 0.3, 0.5);
+    //
+    //     TimelineAnimationEasingProgram program;
+    //     if (TimelineAnimationEasingCompile(&expression, root, &program)) {
+    //         TimelineAnimationEasingProgramEvaluateBatch(&program, times, values, count);
+    //     }
+    //
+    // The expression is only needed to compile. The program is a flat array
+    // of instructions, it does not allocate and can be copied, stored and
+    // used from any thread.
+
+    /// The most nodes an expression can hold.
+    #define TimelineAnimationEasingExpressionCapacity 64
+
+    /// The most instructions a program can hold.
+    #define TimelineAnimationEasingProgramCapacity 128
+
+    /// The most Bézier curves a program can hold.
+    #define TimelineAnimationEasingProgramBezierCapacity 8
+
+    /// The deepest a program can nest its curves.
+    #define TimelineAnimationEasingProgramStackDepth 16
+
+    /// A node of an expression. Nodes are indices into their expression,
+    /// TimelineAnimationEasingNodeInvalid when they could not be created.
+    /// Combining an invalid node gives an invalid node, so only the root needs
+    /// to be checked.
+    typedef int TimelineAnimationEasingNode;
+
+    #define TimelineAnimationEasingNodeInvalid (-1)
+
+    /// Private, use the functions below.
+    typedef struct {
+        int kind;
+        TimelineAnimationEasingNode first, second;
+        double a, b;
+        TimelineAnimationSpecialTimingFunction function;
+        TimelineAnimationCubicBezierControlPoints points;
+    } TimelineAnimationEasingExpressionNode;
+
+    /// The nodes of a curve under construction. Nodes can only refer to nodes
+    /// created before them, and can be shared.
+    typedef struct {
+        TimelineAnimationEasingExpressionNode nodes[TimelineAnimationEasingExpressionCapacity];
+        int count;
+    } TimelineAnimationEasingExpression;
+
+    /// Private, use the functions below.
+    typedef struct {
+        int op;
+        int operand;
+        double a, b, c;
+        TimelineAnimationSpecialTimingFunction function;
+        /// The batch version of `function`, looked up once at compile time.
+        void (*batch)(const double *in, double *out, size_t n);
+    } TimelineAnimationEasingInstruction;
+
+    /// A compiled expression.
+    typedef struct {
+        TimelineAnimationEasingInstruction instructions[TimelineAnimationEasingProgramCapacity];
+        int count;
+        TimelineAnimationCubicBezier beziers[TimelineAnimationEasingProgramBezierCapacity];
+        int bezierCount;
+    } TimelineAnimationEasingProgram;
+
+    /// Empties `expression`.
+    void TimelineAnimationEasingExpressionInit(TimelineAnimationEasingExpression *expression);
+
+    /// `function`, as is.
+    TimelineAnimationEasingNode TimelineAnimationEasingCurve(TimelineAnimationEasingExpression *expression,
+                                                             TimelineAnimationSpecialTimingFunction function);
+
+    /// The Bézier curve of `points`, as CAMediaTimingFunction draws it.
+    TimelineAnimationEasingNode TimelineAnimationEasingBezier(TimelineAnimationEasingExpression *expression,
+                                                              TimelineAnimationCubicBezierControlPoints points);
+
+    /// `node` played backwards: node(1 - p).
+    TimelineAnimationEasingNode TimelineAnimationEasingReverse(TimelineAnimationEasingExpression *expression,
+                                                               TimelineAnimationEasingNode node);
+
+    /// `node` rotated around (0.5, 0.5): 1 - node(1 - p). It turns an ease in
+    /// into the matching ease out.
+    TimelineAnimationEasingNode TimelineAnimationEasingMirror(TimelineAnimationEasingExpression *expression,
+                                                              TimelineAnimationEasingNode node);
+
+    /// `first` then `second`. Until `split`, in (0, 1), `first` is squeezed
+    /// to go from 0 to `value`, then `second` from `value` to 1.
+    TimelineAnimationEasingNode TimelineAnimationEasingConcatenate(TimelineAnimationEasingExpression *expression,
+                                                                   TimelineAnimationEasingNode first,
+                                                                   TimelineAnimationEasingNode second,
+                                                                   double split,
+                                                                   double value);
+
+    /// (1 - weight) * first(p) + weight * second(p).
+    TimelineAnimationEasingNode TimelineAnimationEasingBlend(TimelineAnimationEasingExpression *expression,
+                                                             TimelineAnimationEasingNode first,
+                                                             TimelineAnimationEasingNode second,
+                                                             double weight);
+
+    /// `node` kept within [minimum, maximum], to tame the overshoot of the
+    /// Back and Elastic curves.
+    TimelineAnimationEasingNode TimelineAnimationEasingClamp(TimelineAnimationEasingExpression *expression,
+                                                             TimelineAnimationEasingNode node,
+                                                             double minimum,
+                                                             double maximum);
+
+    /// `node` played `count` times over [0, 1]. Each repetition starts at
+    /// node(0) and ends at node(1), so node(1) is also the last value.
+    TimelineAnimationEasingNode TimelineAnimationEasingRepeat(TimelineAnimationEasingExpression *expression,
+                                                              TimelineAnimationEasingNode node,
+                                                              double count);
+
+    /// Compiles the curve of `root` in `program`. Returns 0 if `root` is
+    /// invalid or the curve does not fit in a program.
+    int TimelineAnimationEasingCompile(const TimelineAnimationEasingExpression *expression,
+                                       TimelineAnimationEasingNode root,
+                                       TimelineAnimationEasingProgram *program);
+
+    /// Evaluates `program` at `p`.
+    double TimelineAnimationEasingProgramEvaluate(const TimelineAnimationEasingProgram *program, double p);
+
+    /// Evaluates `program` for `n` progress values. `in` and `out` may be the
+    /// same buffer. The curves are evaluated with the batch kernels of
+    /// TimelineAnimationSpecialTimingFunctionBatch.h.
+    void TimelineAnimationEasingProgramEvaluateBatch(const TimelineAnimationEasingProgram *program,
+                                                     const double *in,
+                                                     double *out,
+                                                     size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,98 @@
+/*!
+ *  @file TimelineAnimationKeyframeCache.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+@import Foundation;
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The kind of value a cached keyframe array holds.
+typedef NS_ENUM(NSUInteger, TimelineAnimationKeyframeValueType) {
+    TimelineAnimationKeyframeValueTypeNumber = 0,
+    TimelineAnimationKeyframeValueTypePoint,
+    TimelineAnimationKeyframeValueTypeSize,
+    TimelineAnimationKeyframeValueTypeRect,
+    TimelineAnimationKeyframeValueTypeTransform,
+    /// Not values but the cubic Bézier fit of a curve, as `@[keyTimes,
+    /// timingFunctions, progress]`, progress being an NSData of doubles.
+    /// `from[0]` and `to[0]` hold the tolerance, `keyframeCount` is 0.
+    TimelineAnimationKeyframeValueTypeBezierFit,
+    /// The Catmull-Rom spline keyframes of a curve, or its linearly
+    /// interpolated ones when they are fewer, as `@[keyTimes, progress,
+    /// calculationMode]`. `from[0]` and `to[0]` hold the maximum error,
+    /// `keyframeCount` is 0.
+    TimelineAnimationKeyframeValueTypeSpline,
+};
+
+/// The most components a cached value can have, those of an affine transform.
+#define TimelineAnimationKeyframeCacheMaximumComponents 6
+
+/// Identifies the keyframe values of a special easing animation.
+typedef struct {
+    TimelineAnimationSpecialTimingFunction function;
+    TimelineAnimationKeyframeValueType type;
+    /// The components of the value, as many as `type` has, the rest 0.
+    double from[TimelineAnimationKeyframeCacheMaximumComponents];
+    double to[TimelineAnimationKeyframeCacheMaximumComponents];
+    size_t keyframeCount;
+} TimelineAnimationKeyframeCacheKey;
+
+/// A thread-safe cache of the keyframe values arrays of
+/// CAKeyframeAnimation+SpecialEasing, so that the same animation built again
+/// does not compute and box its values again, nor fit its curve again.
+///
+/// The least recently used arrays are evicted once the estimated memory of
+/// the cached arrays goes over `memoryBudget`. On iOS the cache empties itself
+/// on memory warnings.
+@interface TimelineAnimationKeyframeCache : NSObject
+
+/// The cache the keyframe animation factories use, with a budget of 1MB.
+/// Set its `memoryBudget` to 0 to turn it off.
++ (instancetype)sharedCache;
+
+- (instancetype)initWithMemoryBudget:(NSUInteger)memoryBudget NS_DESIGNATED_INITIALIZER;
+
+/// The most memory, in bytes, the cached arrays are estimated to take. Lowering
+/// it evicts right away.
+@property (atomic, readwrite) NSUInteger memoryBudget;
+/// The memory, in bytes, the cached arrays are estimated to take: the array
+/// and its boxed values.
+@property (atomic, readonly) NSUInteger memoryUsage;
+/// The number of cached arrays.
+@property (atomic, readonly) NSUInteger count;
+
+/// Lookups that found their values.
+@property (atomic, readonly) NSUInteger hits;
+/// Lookups that did not.
+@property (atomic, readonly) NSUInteger misses;
+/// Arrays evicted to stay within the budget.
+@property (atomic, readonly) NSUInteger evictions;
+
+/// The cached values of `key`, or nil.
+- (nullable NSArray *)valuesForKey:(TimelineAnimationKeyframeCacheKey)key;
+
+/// Caches `values` under `key`, unless they alone are over the budget.
+- (void)setValues:(NSArray *)values forKey:(TimelineAnimationKeyframeCacheKey)key;
+
+/// The cached values of `key`, or the values `generator` returns, which are
+/// then cached. `generator` runs outside of the lock.
+- (NSArray *)valuesForKey:(TimelineAnimationKeyframeCacheKey)key
+                generator:(NSArray *(NS_NOESCAPE ^)(void))generator;
+
+/// Empties the cache, to be called under memory pressure.
+- (void)purge;
+
+/// Zeroes `hits`, `misses` and `evictions`.
+- (void)resetStatistics;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,421 @@
+/*!
+ *  @file TimelineAnimationKeyframeCache.m
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#import "TimelineAnimationKeyframeCache.h"
+#include <pthread.h>
+#include <string.h>
+@import CoreGraphics;
+#if TARGET_OS_IPHONE
+@import UIKit;
+#endif
+
+/// The budget of the shared cache, 1MB.
+#define TA_KEYFRAME_CACHE_SHARED_BUDGET (1024 * 1024)
+
+static NSUInteger TimelineAnimationKeyframeCacheComponents(TimelineAnimationKeyframeValueType type) {
+    switch (type) {
+        case TimelineAnimationKeyframeValueTypeNumber:
+        case TimelineAnimationKeyframeValueTypeBezierFit:
+        case TimelineAnimationKeyframeValueTypeSpline:
+            return 1;
+        case TimelineAnimationKeyframeValueTypePoint:
+        case TimelineAnimationKeyframeValueTypeSize:
+            return 2;
+        case TimelineAnimationKeyframeValueTypeRect:
+            return 4;
+        case TimelineAnimationKeyframeValueTypeTransform:
+            return TimelineAnimationKeyframeCacheMaximumComponents;
+    }
+    return TimelineAnimationKeyframeCacheMaximumComponents;
+}
+
+/// The estimated memory of a boxed key time, timing function and array.
+#define TA_KEYFRAME_CACHE_NUMBER_COST 16
+#define TA_KEYFRAME_CACHE_TIMING_FUNCTION_COST 48
+#define TA_KEYFRAME_CACHE_ARRAY_COST 32
+
+/// The estimated memory of the cached `values` of `type`: a pointer and a box
+/// for each, the box being an object header and the value, a transform being
+/// boxed as a CATransform3D. A fit or spline costs its arrays and progress
+/// bytes.
+static NSUInteger TimelineAnimationKeyframeCacheCost(TimelineAnimationKeyframeValueType type, NSArray *values) {
+    NSUInteger box = 0;
+    switch (type) {
+        case TimelineAnimationKeyframeValueTypeNumber:
+            box = 16;
+            break;
+        case TimelineAnimationKeyframeValueTypePoint:
+        case TimelineAnimationKeyframeValueTypeSize:
+            box = 16 + 2 * sizeof(CGFloat);
+            break;
+        case TimelineAnimationKeyframeValueTypeRect:
+            box = 16 + 4 * sizeof(CGFloat);
+            break;
+        case TimelineAnimationKeyframeValueTypeTransform:
+            box = 16 + 16 * sizeof(CGFloat);
+            break;
+        case TimelineAnimationKeyframeValueTypeBezierFit: {
+            NSArray *const keyTimes = values[0];
+            NSArray *const timingFunctions = values[1];
+            NSData *const progress = values[2];
+            return 4 * TA_KEYFRAME_CACHE_ARRAY_COST
+                + keyTimes.count * (sizeof(void *) + TA_KEYFRAME_CACHE_NUMBER_COST)
+                + timingFunctions.count * (sizeof(void *) + TA_KEYFRAME_CACHE_TIMING_FUNCTION_COST)
+                + progress.length;
+        }
+        case TimelineAnimationKeyframeValueTypeSpline: {
+            NSArray *const keyTimes = values[0];
+            NSData *const progress = values[1];
+            return 3 * TA_KEYFRAME_CACHE_ARRAY_COST
+                + keyTimes.count * (sizeof(void *) + TA_KEYFRAME_CACHE_NUMBER_COST)
+                + progress.length;
+        }
+    }
+    return TA_KEYFRAME_CACHE_ARRAY_COST + values.count * (sizeof(void *) + box);
+}
+
+// MARK: - Key
+
+/// A `TimelineAnimationKeyframeCacheKey` the dictionary can hold.
+@interface TimelineAnimationKeyframeCacheKeyObject : NSObject <NSCopying> {
+    @public
+    TimelineAnimationKeyframeCacheKey _key;
+    NSUInteger _hash;
+}
+@end
+
+@implementation TimelineAnimationKeyframeCacheKeyObject
+
+- (instancetype)initWithKey:(TimelineAnimationKeyframeCacheKey)key {
+    self = [super init];
+    if (self) {
+        const NSUInteger components = TimelineAnimationKeyframeCacheComponents(key.type);
+        // only the components of the type count, and 0 is +0
+        for (NSUInteger i = 0; i < TimelineAnimationKeyframeCacheMaximumComponents; ++i) {
+            key.from[i] = (i < components) ? key.from[i] + 0.0 : 0.0;
+            key.to[i] = (i < components) ? key.to[i] + 0.0 : 0.0;
+        }
+        _key = key;
+
+        // FNV-1a over the fields
+        uint64_t hash = 14695981039346656037ULL;
+#define TA_KEYFRAME_CACHE_HASH(value) do { \
+            uint64_t bits = 0; \
+            memcpy(&bits, &(value), sizeof(value)); \
+            hash = (hash ^ bits) * 1099511628211ULL; \
+        } while (0)
+        TA_KEYFRAME_CACHE_HASH(key.function);
+        TA_KEYFRAME_CACHE_HASH(key.type);
+        TA_KEYFRAME_CACHE_HASH(key.keyframeCount);
+        for (NSUInteger i = 0; i < components; ++i) {
+            TA_KEYFRAME_CACHE_HASH(key.from[i]);
+            TA_KEYFRAME_CACHE_HASH(key.to[i]);
+        }
+#undef TA_KEYFRAME_CACHE_HASH
+        _hash = (NSUInteger)(hash ^ (hash >> 32));
+    }
+    return self;
+}
+
+- (NSUInteger)hash {
+    return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+    if (object == self) {
+        return YES;
+    }
+    if (![object isKindOfClass:[TimelineAnimationKeyframeCacheKeyObject class]]) {
+        return NO;
+    }
+    const TimelineAnimationKeyframeCacheKey *const other = &((TimelineAnimationKeyframeCacheKeyObject *)object)->_key;
+    if (other->function != _key.function
+        || other->type != _key.type
+        || other->keyframeCount != _key.keyframeCount) {
+        return NO;
+    }
+    for (NSUInteger i = 0; i < TimelineAnimationKeyframeCacheMaximumComponents; ++i) {
+        if (other->from[i] != _key.from[i] || other->to[i] != _key.to[i]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
+
+// MARK: - Entry
+
+/// A node of the recency list, the most recently used first.
+@interface TimelineAnimationKeyframeCacheEntry : NSObject {
+    @public
+    TimelineAnimationKeyframeCacheKeyObject *_key;
+    NSArray *_values;
+    NSUInteger _cost;
+    __unsafe_unretained TimelineAnimationKeyframeCacheEntry *_previous;
+    __unsafe_unretained TimelineAnimationKeyframeCacheEntry *_next;
+}
+@end
+
+@implementation TimelineAnimationKeyframeCacheEntry
+@end
+
+// MARK: - Cache
+
+@implementation TimelineAnimationKeyframeCache {
+    pthread_mutex_t _lock;
+    /// Owns the entries, the list does not.
+    NSMutableDictionary<TimelineAnimationKeyframeCacheKeyObject *, TimelineAnimationKeyframeCacheEntry *> *_entries;
+    __unsafe_unretained TimelineAnimationKeyframeCacheEntry *_head;
+    __unsafe_unretained TimelineAnimationKeyframeCacheEntry *_tail;
+    NSUInteger _memoryBudget;
+    NSUInteger _memoryUsage;
+    NSUInteger _hits;
+    NSUInteger _misses;
+    NSUInteger _evictions;
+}
+
++ (instancetype)sharedCache {
+    static TimelineAnimationKeyframeCache *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        cache = [[TimelineAnimationKeyframeCache alloc] initWithMemoryBudget:TA_KEYFRAME_CACHE_SHARED_BUDGET];
+    });
+    return cache;
+}
+
+- (instancetype)initWithMemoryBudget:(NSUInteger)memoryBudget {
+    self = [super init];
+    if (self) {
+        pthread_mutex_init(&_lock, NULL);
+        _entries = [[NSMutableDictionary alloc] init];
+        _memoryBudget = memoryBudget;
+#if TARGET_OS_IPHONE
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(purge)
+                                                     name:UIApplicationDidReceiveMemoryWarningNotification
+                                                   object:nil];
+#endif
+    }
+    return self;
+}
+
+- (void)dealloc {
+#if TARGET_OS_IPHONE
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+#endif
+    pthread_mutex_destroy(&_lock);
+}
+
+// MARK: Recency list, under the lock
+
+- (void)__unlinkEntry:(TimelineAnimationKeyframeCacheEntry *)entry {
+    if (entry->_previous != nil) {
+        entry->_previous->_next = entry->_next;
+    }
+    else {
+        _head = entry->_next;
+    }
+    if (entry->_next != nil) {
+        entry->_next->_previous = entry->_previous;
+    }
+    else {
+        _tail = entry->_previous;
+    }
+    entry->_previous = nil;
+    entry->_next = nil;
+}
+
+- (void)__pushEntry:(TimelineAnimationKeyframeCacheEntry *)entry {
+    entry->_previous = nil;
+    entry->_next = _head;
+    if (_head != nil) {
+        _head->_previous = entry;
+    }
+    _head = entry;
+    if (_tail == nil) {
+        _tail = entry;
+    }
+}
+
+- (void)__removeEntry:(TimelineAnimationKeyframeCacheEntry *)entry {
+    [self __unlinkEntry:entry];
+    _memoryUsage -= entry->_cost;
+    [_entries removeObjectForKey:entry->_key];
+}
+
+/// Evicts the least recently used entries until the cache is within budget.
+/// The evicted values are returned to be released outside of the lock.
+- (NSMutableArray *)__trim {
+    NSMutableArray *evicted = nil;
+    while (_memoryUsage > _memoryBudget && _tail != nil) {
+        TimelineAnimationKeyframeCacheEntry *const entry = _tail;
+        if (evicted == nil) {
+            evicted = [[NSMutableArray alloc] init];
+        }
+        [evicted addObject:entry];
+        [self __removeEntry:entry];
+        ++_evictions;
+    }
+    return evicted;
+}
+
+// MARK: Lookup
+
+- (nullable NSArray *)__valuesForKeyObject:(TimelineAnimationKeyframeCacheKeyObject *)keyObject {
+    NSArray *values = nil;
+    pthread_mutex_lock(&_lock);
+    TimelineAnimationKeyframeCacheEntry *const entry = _entries[keyObject];
+    if (entry != nil) {
+        if (entry != _head) {
+            [self __unlinkEntry:entry];
+            [self __pushEntry:entry];
+        }
+        values = entry->_values;
+        ++_hits;
+    }
+    else {
+        ++_misses;
+    }
+    pthread_mutex_unlock(&_lock);
+    return values;
+}
+
+- (void)__setValues:(NSArray *)values forKeyObject:(TimelineAnimationKeyframeCacheKeyObject *)keyObject {
+    const NSUInteger cost = TimelineAnimationKeyframeCacheCost(keyObject->_key.type, values);
+
+    TimelineAnimationKeyframeCacheEntry *const entry = [[TimelineAnimationKeyframeCacheEntry alloc] init];
+    entry->_key = keyObject;
+    entry->_values = [values copy];
+    entry->_cost = cost;
+
+    pthread_mutex_lock(&_lock);
+    TimelineAnimationKeyframeCacheEntry *const previous = _entries[keyObject];
+    if (previous != nil) {
+        [self __removeEntry:previous];
+    }
+    NSMutableArray *evicted = nil;
+    if (cost <= _memoryBudget) {
+        _entries[keyObject] = entry;
+        [self __pushEntry:entry];
+        _memoryUsage += cost;
+        evicted = [self __trim];
+    }
+    pthread_mutex_unlock(&_lock);
+    // `previous` and `evicted` are released here, outside of the lock
+    (void)previous;
+    (void)evicted;
+}
+
+- (nullable NSArray *)valuesForKey:(TimelineAnimationKeyframeCacheKey)key {
+    TimelineAnimationKeyframeCacheKeyObject *const keyObject = [[TimelineAnimationKeyframeCacheKeyObject alloc] initWithKey:key];
+    return [self __valuesForKeyObject:keyObject];
+}
+
+- (void)setValues:(NSArray *)values forKey:(TimelineAnimationKeyframeCacheKey)key {
+    NSParameterAssert(values != nil);
+    TimelineAnimationKeyframeCacheKeyObject *const keyObject = [[TimelineAnimationKeyframeCacheKeyObject alloc] initWithKey:key];
+    [self __setValues:values forKeyObject:keyObject];
+}
+
+- (NSArray *)valuesForKey:(TimelineAnimationKeyframeCacheKey)key
+                generator:(NSArray *(NS_NOESCAPE ^)(void))generator {
+    NSParameterAssert(generator != nil);
+    TimelineAnimationKeyframeCacheKeyObject *const keyObject = [[TimelineAnimationKeyframeCacheKeyObject alloc] initWithKey:key];
+    NSArray *values = [self __valuesForKeyObject:keyObject];
+    if (values != nil) {
+        return values;
+    }
+    values = generator();
+    // an empty array is how the builders fail, do not remember it
+    if (values.count != 0) {
+        [self __setValues:values forKeyObject:keyObject];
+    }
+    return values;
+}
+
+// MARK: Maintenance
+
+- (void)purge {
+    pthread_mutex_lock(&_lock);
+    NSMutableDictionary *const entries = _entries;
+    _entries = [[NSMutableDictionary alloc] init];
+    _head = nil;
+    _tail = nil;
+    _memoryUsage = 0;
+    pthread_mutex_unlock(&_lock);
+    // the values are released here, outside of the lock
+    (void)entries;
+}
+
+- (void)resetStatistics {
+    pthread_mutex_lock(&_lock);
+    _hits = 0;
+    _misses = 0;
+    _evictions = 0;
+    pthread_mutex_unlock(&_lock);
+}
+
+// MARK: Properties
+
+- (NSUInteger)memoryBudget {
+    pthread_mutex_lock(&_lock);
+    const NSUInteger memoryBudget = _memoryBudget;
+    pthread_mutex_unlock(&_lock);
+    return memoryBudget;
+}
+
+- (void)setMemoryBudget:(NSUInteger)memoryBudget {
+    pthread_mutex_lock(&_lock);
+    _memoryBudget = memoryBudget;
+    NSMutableArray *const evicted = [self __trim];
+    pthread_mutex_unlock(&_lock);
+    (void)evicted;
+}
+
+- (NSUInteger)memoryUsage {
+    pthread_mutex_lock(&_lock);
+    const NSUInteger memoryUsage = _memoryUsage;
+    pthread_mutex_unlock(&_lock);
+    return memoryUsage;
+}
+
+- (NSUInteger)count {
+    pthread_mutex_lock(&_lock);
+    const NSUInteger count = _entries.count;
+    pthread_mutex_unlock(&_lock);
+    return count;
+}
+
+- (NSUInteger)hits {
+    pthread_mutex_lock(&_lock);
+    const NSUInteger hits = _hits;
+    pthread_mutex_unlock(&_lock);
+    return hits;
+}
+
+- (NSUInteger)misses {
+    pthread_mutex_lock(&_lock);
+    const NSUInteger misses = _misses;
+    pthread_mutex_unlock(&_lock);
+    return misses;
+}
+
+- (NSUInteger)evictions {
+    pthread_mutex_lock(&_lock);
+    const NSUInteger evictions = _evictions;
+    pthread_mutex_unlock(&_lock);
+    return evictions;
+}
+
+@end
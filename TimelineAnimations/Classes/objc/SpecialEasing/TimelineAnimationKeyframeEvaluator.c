@@ -0,0 +1,166 @@
+/*!
+ *  @file TimelineAnimationKeyframeEvaluator.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "TimelineAnimationKeyframeEvaluator.h"
+#include "TimelineAnimationKeyframeSpline.h"
+
+// The key times of the paced calculation: the distance travelled up to each
+// keyframe over the whole distance, or evenly spaced if the values are all
+// the same.
+static void TimelineAnimationKeyframeEvaluatorPacedTimes(const double *values,
+                                                         size_t keyframeCount,
+                                                         size_t components,
+                                                         double *times)
+{
+    times[0] = 0.0;
+    for (size_t k = 1; k < keyframeCount; ++k) {
+        double squared = 0.0;
+        for (size_t c = 0; c < components; ++c) {
+            const double difference = values[c * keyframeCount + k] - values[c * keyframeCount + k - 1];
+            squared += difference * difference;
+        }
+        times[k] = times[k - 1] + sqrt(squared);
+    }
+    const double distance = times[keyframeCount - 1];
+    for (size_t k = 1; k < keyframeCount; ++k) {
+        times[k] = (distance > 0.0) ? times[k] / distance : (double)k / (double)(keyframeCount - 1);
+    }
+    times[keyframeCount - 1] = 1.0;
+}
+
+int TimelineAnimationKeyframeEvaluatorInit(TimelineAnimationKeyframeEvaluator *evaluator,
+                                           TimelineAnimationKeyframeCalculation calculation,
+                                           const double *keyTimes,
+                                           const double *values,
+                                           size_t keyframeCount,
+                                           size_t components,
+                                           const double *tension,
+                                           const double *continuity,
+                                           const double *bias)
+{
+    const TimelineAnimationKeyframeEvaluator empty = { 0 };
+    *evaluator = empty;
+    if (keyframeCount == 0 || components == 0) {
+        return 0;
+    }
+    evaluator->calculation = calculation;
+    evaluator->values = values;
+    evaluator->keyframeCount = keyframeCount;
+    evaluator->components = components;
+    evaluator->tension = tension;
+    evaluator->continuity = continuity;
+    evaluator->bias = bias;
+    evaluator->timeCount = (calculation == TimelineAnimationKeyframeCalculationDiscrete) ? keyframeCount + 1 : keyframeCount;
+
+    if (keyTimes != NULL && calculation != TimelineAnimationKeyframeCalculationPaced) {
+        evaluator->times = keyTimes;
+        return 1;
+    }
+    double *const times = (double *)malloc(sizeof(double) * evaluator->timeCount);
+    if (times == NULL) {
+        return 0;
+    }
+    if (calculation == TimelineAnimationKeyframeCalculationPaced) {
+        TimelineAnimationKeyframeEvaluatorPacedTimes(values, keyframeCount, components, times);
+    }
+    else {
+        const size_t segments = evaluator->timeCount - 1;
+        for (size_t k = 0; k < evaluator->timeCount; ++k) {
+            times[k] = (segments > 0) ? (double)k / (double)segments : 0.0;
+        }
+    }
+    evaluator->times = times;
+    evaluator->ownedTimes = times;
+    return 1;
+}
+
+void TimelineAnimationKeyframeEvaluatorDestroy(TimelineAnimationKeyframeEvaluator *evaluator)
+{
+    free(evaluator->ownedTimes);
+    evaluator->ownedTimes = NULL;
+    evaluator->times = NULL;
+}
+
+size_t TimelineAnimationKeyframeEvaluatorSegment(TimelineAnimationKeyframeEvaluator *evaluator, double time)
+{
+    if (evaluator->timeCount < 2) {
+        return 0;
+    }
+    const double *const times = evaluator->times;
+    const size_t last = evaluator->timeCount - 2;
+    size_t k = evaluator->segment;
+    if (time >= times[k]) {
+        // the same segment, or the next one, as when playing
+        if (k == last || time < times[k + 1]) {
+            return k;
+        }
+        ++k;
+        if (k == last || time < times[k + 1]) {
+            evaluator->segment = k;
+            return k;
+        }
+    }
+    else if (k == 0) {
+        return 0;
+    }
+    // the last segment starting at or before `time`, searched for over all of
+    // them rather than on the side of the cursor, so that seeks go through the
+    // same key times and find them cached. Halving the range without
+    // branching on the comparison, which a random time would mispredict half
+    // of the time.
+    const double *base = times;
+    size_t length = last + 1;
+    while (length > 1) {
+        const size_t half = length / 2;
+        base = (base[half] <= time) ? base + half : base;
+        length -= half;
+    }
+    k = (size_t)(base - times);
+    evaluator->segment = k;
+    return k;
+}
+
+void TimelineAnimationKeyframeEvaluate(TimelineAnimationKeyframeEvaluator *evaluator, double time, double *value)
+{
+    const double *const values = evaluator->values;
+    const size_t count = evaluator->keyframeCount;
+    const size_t components = evaluator->components;
+    if (evaluator->timeCount < 2) {
+        for (size_t c = 0; c < components; ++c) {
+            value[c] = values[c * count];
+        }
+        return;
+    }
+
+    const size_t k = TimelineAnimationKeyframeEvaluatorSegment(evaluator, time);
+    if (evaluator->calculation == TimelineAnimationKeyframeCalculationDiscrete) {
+        for (size_t c = 0; c < components; ++c) {
+            value[c] = values[c * count + k];
+        }
+        return;
+    }
+
+    const double *const times = evaluator->times;
+    const double duration = times[k + 1] - times[k];
+    double s = (duration > 0.0) ? (time - times[k]) / duration : 1.0;
+    s = fmin(fmax(s, 0.0), 1.0);
+    if (evaluator->calculation == TimelineAnimationKeyframeCalculationCubic) {
+        for (size_t c = 0; c < components; ++c) {
+            value[c] = TimelineAnimationKeyframeSplineSegment(times, values + c * count, count, evaluator->tension,
+                                                              evaluator->continuity, evaluator->bias, k, s);
+        }
+        return;
+    }
+    for (size_t c = 0; c < components; ++c) {
+        const double from = values[c * count + k];
+        value[c] = from + (values[c * count + k + 1] - from) * s;
+    }
+}
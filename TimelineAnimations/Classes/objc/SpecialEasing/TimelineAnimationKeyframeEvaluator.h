@@ -0,0 +1,99 @@
+/*!
+ *  @file TimelineAnimationKeyframeEvaluator.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_KEYFRAME_EVALUATOR_H
+#define TIMELINE_ANIMATIONS_KEYFRAME_EVALUATOR_H
+
+#include <stddef.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // The value of a keyframe animation at a time, as CAKeyframeAnimation
+    // interpolates its values, for scrubbing and playing animations without
+    // a render server.
+    //
+    // A value has a component per number it holds, 1 for a number, 2 for a
+    // point or a size, 4 for a rect, 6 for an affine transform and 16 for a
+    // CATransform3D, each interpolated alone. The values are planar, as the
+    // keyframes of TimelineAnimationKeyframes.h: component c of keyframe k at
+    // values[c * keyframeCount + k].
+    //
+    // The evaluator keeps the segment the last time fell in. The next time is
+    // looked for there and in the segment after it first, so playing forwards
+    // costs about the same whatever the number of keyframes; any other time
+    // is found by binary search. It is meant for one animation played on one
+    // thread.
+
+    typedef enum {
+        /// kCAAnimationLinear: straight between keyframes, at the key times.
+        TimelineAnimationKeyframeCalculationLinear,
+        /// kCAAnimationDiscrete: each value held from its key time to the
+        /// next one; there is a key time more than values.
+        TimelineAnimationKeyframeCalculationDiscrete,
+        /// kCAAnimationPaced: straight between keyframes, at a constant
+        /// speed; the key times are ignored.
+        TimelineAnimationKeyframeCalculationPaced,
+        /// kCAAnimationCubic: the spline of TimelineAnimationKeyframeSpline.h,
+        /// at the key times.
+        TimelineAnimationKeyframeCalculationCubic,
+    } TimelineAnimationKeyframeCalculation;
+
+    typedef struct {
+        TimelineAnimationKeyframeCalculation calculation;
+        const double *values;
+        size_t keyframeCount;
+        size_t components;
+        const double *tension;
+        const double *continuity;
+        const double *bias;
+        /// The segment boundaries, the key times or those made up for them.
+        const double *times;
+        size_t timeCount;
+        /// `times` when the evaluator made them up, to be freed.
+        double *ownedTimes;
+        /// The segment the last time fell in.
+        size_t segment;
+    } TimelineAnimationKeyframeEvaluator;
+
+    /// Sets up `evaluator` for the `keyframeCount` values, which it keeps
+    /// pointers to, as it does to `keyTimes`, `tension`, `continuity` and
+    /// `bias`: they must outlive it. `keyTimes` are ascending from 0 to 1,
+    /// one per value, or one more for the discrete calculation, or NULL for
+    /// evenly spaced keyframes. `tension`, `continuity` and `bias` have a value
+    /// per keyframe, or are NULL for 0, and are used by the cubic calculation
+    /// only. Returns 0 if there are no values or memory runs out.
+    int TimelineAnimationKeyframeEvaluatorInit(TimelineAnimationKeyframeEvaluator *evaluator,
+                                               TimelineAnimationKeyframeCalculation calculation,
+                                               const double *keyTimes,
+                                               const double *values,
+                                               size_t keyframeCount,
+                                               size_t components,
+                                               const double *tension,
+                                               const double *continuity,
+                                               const double *bias);
+
+    /// Frees what TimelineAnimationKeyframeEvaluatorInit() allocated.
+    void TimelineAnimationKeyframeEvaluatorDestroy(TimelineAnimationKeyframeEvaluator *evaluator);
+
+    /// The segment `time` falls in, from the one of the last time: k such
+    /// that times[k] <= time < times[k + 1], clamped to the first and last
+    /// segments.
+    size_t TimelineAnimationKeyframeEvaluatorSegment(TimelineAnimationKeyframeEvaluator *evaluator, double time);
+
+    /// Writes the `components` of the value at `time`, from 0 to 1 and
+    /// clamped, in `value`.
+    void TimelineAnimationKeyframeEvaluate(TimelineAnimationKeyframeEvaluator *evaluator, double time, double *value);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* TIMELINE_ANIMATIONS_KEYFRAME_EVALUATOR_H */
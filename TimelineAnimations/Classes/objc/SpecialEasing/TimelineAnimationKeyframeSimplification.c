@@ -0,0 +1,125 @@
+/*!
+ *  @file TimelineAnimationKeyframeSimplification.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "TimelineAnimationKeyframeSimplification.h"
+
+static inline double TimelineAnimationKeyframeSimplificationTime(const double *keyTimes,
+                                                                 size_t keyframeCount,
+                                                                 size_t frame)
+{
+    return (keyTimes != NULL) ? keyTimes[frame] : (double)frame / (double)(keyframeCount - 1);
+}
+
+// The distance of keyframe `frame` from the chord between keyframes `start`
+// and `end`, at its key time.
+static double TimelineAnimationKeyframeSimplificationDistance(const double *keyTimes,
+                                                              const double *values,
+                                                              size_t keyframeCount,
+                                                              size_t dimensions,
+                                                              size_t start,
+                                                              size_t end,
+                                                              size_t frame)
+{
+    const double t0 = TimelineAnimationKeyframeSimplificationTime(keyTimes, keyframeCount, start);
+    const double t1 = TimelineAnimationKeyframeSimplificationTime(keyTimes, keyframeCount, end);
+    const double t = TimelineAnimationKeyframeSimplificationTime(keyTimes, keyframeCount, frame);
+    // keyframes at the same time, a jump, are interpolated from the first
+    const double u = (t1 > t0) ? (t - t0) / (t1 - t0) : 0.0;
+    double distance = 0.0;
+    for (size_t component = 0; component < dimensions; ++component) {
+        const double *const plane = values + component * keyframeCount;
+        const double chord = plane[start] + u * (plane[end] - plane[start]);
+        distance = fmax(distance, fabs(plane[frame] - chord));
+    }
+    return distance;
+}
+
+size_t TimelineAnimationKeyframeSimplify(const double *keyTimes,
+                                         const double *values,
+                                         size_t keyframeCount,
+                                         size_t dimensions,
+                                         double tolerance,
+                                         size_t *indices)
+{
+    if (keyframeCount == 0 || !(tolerance >= 0.0)) {
+        return 0;
+    }
+    if (keyframeCount <= 2) {
+        for (size_t frame = 0; frame < keyframeCount; ++frame) {
+            indices[frame] = frame;
+        }
+        return keyframeCount;
+    }
+
+    unsigned char *const kept = (unsigned char *)calloc(keyframeCount, sizeof(unsigned char));
+    // the pending (start, end) pairs; each split adds at most one, so there
+    // are never more than keyframeCount of them
+    size_t *const stack = (size_t *)malloc(sizeof(size_t) * 2 * keyframeCount);
+    if (kept == NULL || stack == NULL) {
+        free(stack);
+        free(kept);
+        return 0;
+    }
+    kept[0] = 1;
+    kept[keyframeCount - 1] = 1;
+
+    size_t pending = 0;
+    stack[pending++] = 0;
+    stack[pending++] = keyframeCount - 1;
+    while (pending != 0) {
+        const size_t end = stack[--pending];
+        const size_t start = stack[--pending];
+        double farthest = -1.0;
+        size_t split = start;
+        for (size_t frame = start + 1; frame < end; ++frame) {
+            const double distance = TimelineAnimationKeyframeSimplificationDistance(keyTimes, values, keyframeCount,
+                                                                                    dimensions, start, end, frame);
+            if (distance > farthest) {
+                farthest = distance;
+                split = frame;
+            }
+        }
+        if (split != start && farthest > tolerance) {
+            kept[split] = 1;
+            stack[pending++] = start;
+            stack[pending++] = split;
+            stack[pending++] = split;
+            stack[pending++] = end;
+        }
+    }
+
+    size_t count = 0;
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+        if (kept[frame]) {
+            indices[count++] = frame;
+        }
+    }
+    free(stack);
+    free(kept);
+    return count;
+}
+
+double TimelineAnimationKeyframeSimplificationError(const double *keyTimes,
+                                                   const double *values,
+                                                   size_t keyframeCount,
+                                                   size_t dimensions,
+                                                   const size_t *indices,
+                                                   size_t keptCount)
+{
+    double error = 0.0;
+    for (size_t k = 0; k + 1 < keptCount; ++k) {
+        for (size_t frame = indices[k] + 1; frame < indices[k + 1]; ++frame) {
+            error = fmax(error, TimelineAnimationKeyframeSimplificationDistance(keyTimes, values, keyframeCount,
+                                                                                dimensions, indices[k], indices[k + 1], frame));
+        }
+    }
+    return error;
+}
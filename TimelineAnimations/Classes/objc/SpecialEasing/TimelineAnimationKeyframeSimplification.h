@@ -0,0 +1,59 @@
+/*!
+ *  @file TimelineAnimationKeyframeSimplification.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_KEYFRAME_SIMPLIFICATION_H
+#define TIMELINE_ANIMATIONS_KEYFRAME_SIMPLIFICATION_H
+
+#include <stddef.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // Removes the keyframes of a linearly interpolated keyframe animation
+    // that the others interpolate within a tolerance, with the
+    // Ramer-Douglas-Peucker algorithm. The distance of a keyframe from the
+    // chord between two kept keyframes is measured at its key time, as the
+    // largest difference of any component, so the simplified animation is
+    // within the tolerance of the original at every time, not only at the
+    // keyframes.
+    //
+    // Free of Foundation, so that asset keyframes can be simplified offline.
+    // The values are planar, as in TimelineAnimationKeyframes.h: component
+    // `c` of keyframe `frame` is values[c * keyframeCount + frame].
+
+    /// Writes the indices of the keyframes to keep in `indices`, ascending,
+    /// which must have room for `keyframeCount`, and returns how many. The
+    /// first and last keyframes are always kept.
+    /// `keyTimes` are ascending, or NULL for evenly spaced keyframes.
+    /// Returns 0 if `keyframeCount` is 0, `tolerance` is negative or memory
+    /// runs out.
+    size_t TimelineAnimationKeyframeSimplify(const double *keyTimes,
+                                             const double *values,
+                                             size_t keyframeCount,
+                                             size_t dimensions,
+                                             double tolerance,
+                                             size_t *indices);
+
+    /// The largest difference, over every component, between the keyframes
+    /// and the linear interpolation of the `keptCount` ones at `indices`.
+    /// As both are linear between keyframes, it is the largest difference at
+    /// any time.
+    double TimelineAnimationKeyframeSimplificationError(const double *keyTimes,
+                                                       const double *values,
+                                                       size_t keyframeCount,
+                                                       size_t dimensions,
+                                                       const size_t *indices,
+                                                       size_t keptCount);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* TIMELINE_ANIMATIONS_KEYFRAME_SIMPLIFICATION_H */
@@ -0,0 +1,238 @@
+/*!
+ *  @file TimelineAnimationKeyframeSpline.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "TimelineAnimationKeyframeSpline.h"
+#include "TimelineAnimationSpecialTimingFunctionBatch.h"
+
+// The times the spline is compared with the curve at, and the keyframes are
+// chosen from: an even grid, whose steps are halved while the curve changes
+// by more than TA_SPLINE_GRID_STEEP_CHANGE over them, where it is about
+// vertical, as Circular is
+#define TA_SPLINE_GRID 4096
+#define TA_SPLINE_GRID_STEEP_CHANGE (1.0 / 256.0)
+#define TA_SPLINE_GRID_MAXIMUM_HALVINGS 16
+
+typedef struct {
+    double *times;
+    double *values;
+    size_t count;
+    size_t capacity;
+} TimelineAnimationKeyframeSplineGrid;
+
+static int TimelineAnimationKeyframeSplineGridAppend(TimelineAnimationKeyframeSplineGrid *grid, double time, double value)
+{
+    if (grid->count == grid->capacity) {
+        const size_t capacity = grid->capacity * 2;
+        double *const times = (double *)realloc(grid->times, sizeof(double) * capacity);
+        if (times == NULL) {
+            return 0;
+        }
+        grid->times = times;
+        double *const values = (double *)realloc(grid->values, sizeof(double) * capacity);
+        if (values == NULL) {
+            return 0;
+        }
+        grid->values = values;
+        grid->capacity = capacity;
+    }
+    grid->times[grid->count] = time;
+    grid->values[grid->count] = value;
+    ++grid->count;
+    return 1;
+}
+
+// Appends the times inside the step from `start` to `end`, and `end`.
+static int TimelineAnimationKeyframeSplineGridRefine(TimelineAnimationKeyframeSplineGrid *grid,
+                                                     TimelineAnimationSpecialTimingFunction function,
+                                                     double start,
+                                                     double startValue,
+                                                     double end,
+                                                     double endValue,
+                                                     unsigned int halvings)
+{
+    if (halvings < TA_SPLINE_GRID_MAXIMUM_HALVINGS && fabs(endValue - startValue) > TA_SPLINE_GRID_STEEP_CHANGE) {
+        const double middle = 0.5 * (start + end);
+        const double middleValue = function(middle);
+        return TimelineAnimationKeyframeSplineGridRefine(grid, function, start, startValue, middle, middleValue, halvings + 1)
+            && TimelineAnimationKeyframeSplineGridRefine(grid, function, middle, middleValue, end, endValue, halvings + 1);
+    }
+    return TimelineAnimationKeyframeSplineGridAppend(grid, end, endValue);
+}
+
+static inline double TimelineAnimationKeyframeSplineParameter(const double *parameters, size_t frame)
+{
+    return (parameters != NULL) ? parameters[frame] : 0.0;
+}
+
+double TimelineAnimationKeyframeSplineSegment(const double *keyTimes,
+                                              const double *values,
+                                              size_t keyframeCount,
+                                              const double *tension,
+                                              const double *continuity,
+                                              const double *bias,
+                                              size_t k,
+                                              double s)
+{
+    const size_t last = keyframeCount - 1;
+    // the ends are repeated
+    const double p0 = values[(k > 0) ? k - 1 : 0];
+    const double p1 = values[k];
+    const double p2 = values[k + 1];
+    const double p3 = values[(k + 2 <= last) ? k + 2 : last];
+
+    const double d0 = (k > 0) ? keyTimes[k] - keyTimes[k - 1] : keyTimes[k + 1] - keyTimes[k];
+    const double d1 = keyTimes[k + 1] - keyTimes[k];
+    const double d2 = (k + 2 <= last) ? keyTimes[k + 2] - keyTimes[k + 1] : d1;
+
+    // leaving keyframe k
+    const double t1 = TimelineAnimationKeyframeSplineParameter(tension, k);
+    const double c1 = TimelineAnimationKeyframeSplineParameter(continuity, k);
+    const double b1 = TimelineAnimationKeyframeSplineParameter(bias, k);
+    double out = 0.5 * (1.0 - t1) * ((1.0 + c1) * (1.0 + b1) * (p1 - p0) + (1.0 - c1) * (1.0 - b1) * (p2 - p1));
+    out *= (d0 + d1 > 0.0) ? 2.0 * d1 / (d0 + d1) : 1.0;
+
+    // arriving at keyframe k + 1
+    const double t2 = TimelineAnimationKeyframeSplineParameter(tension, k + 1);
+    const double c2 = TimelineAnimationKeyframeSplineParameter(continuity, k + 1);
+    const double b2 = TimelineAnimationKeyframeSplineParameter(bias, k + 1);
+    double in = 0.5 * (1.0 - t2) * ((1.0 - c2) * (1.0 + b2) * (p2 - p1) + (1.0 + c2) * (1.0 - b2) * (p3 - p2));
+    in *= (d1 + d2 > 0.0) ? 2.0 * d1 / (d1 + d2) : 1.0;
+
+    // cubic Hermite
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    return (2.0 * s3 - 3.0 * s2 + 1.0) * p1
+        + (s3 - 2.0 * s2 + s) * out
+        + (-2.0 * s3 + 3.0 * s2) * p2
+        + (s3 - s2) * in;
+}
+
+double TimelineAnimationKeyframeSplineEvaluate(const double *keyTimes,
+                                               const double *values,
+                                               size_t keyframeCount,
+                                               const double *tension,
+                                               const double *continuity,
+                                               const double *bias,
+                                               double time)
+{
+    if (keyframeCount == 1 || !(time > keyTimes[0])) {
+        return values[0];
+    }
+    if (time >= keyTimes[keyframeCount - 1]) {
+        return values[keyframeCount - 1];
+    }
+    // the last keyframe at or before `time`
+    size_t low = 0;
+    size_t high = keyframeCount - 1;
+    while (high - low > 1) {
+        const size_t middle = low + (high - low) / 2;
+        if (keyTimes[middle] <= time) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+    const double duration = keyTimes[low + 1] - keyTimes[low];
+    const double s = (duration > 0.0) ? (time - keyTimes[low]) / duration : 1.0;
+    return TimelineAnimationKeyframeSplineSegment(keyTimes, values, keyframeCount, tension, continuity, bias, low, s);
+}
+
+size_t TimelineAnimationKeyframeSplineProgress(TimelineAnimationSpecialTimingFunction function,
+                                               double maximumError,
+                                               size_t capacity,
+                                               double *keyTimes,
+                                               double *progress)
+{
+    const size_t even = TA_SPLINE_GRID;
+    double *const evenValues = (double *)malloc(sizeof(double) * (even + 1));
+    TimelineAnimationKeyframeSplineGrid steps = {
+        (double *)malloc(sizeof(double) * (even + 1)), (double *)malloc(sizeof(double) * (even + 1)), 0, even + 1,
+    };
+    unsigned char *chosen = NULL;
+    size_t count = 0;
+    if (evenValues == NULL || steps.times == NULL || steps.values == NULL || capacity < 2) {
+        goto done;
+    }
+    for (size_t i = 0; i <= even; ++i) {
+        evenValues[i] = (double)i / even;
+    }
+    TimelineAnimationSpecialTimingFunctionEvaluateBatch(function, evenValues, evenValues, even + 1);
+    TimelineAnimationKeyframeSplineGridAppend(&steps, 0.0, evenValues[0]);
+    for (size_t i = 0; i < even; ++i) {
+        if (!TimelineAnimationKeyframeSplineGridRefine(&steps, function, (double)i / even, evenValues[i],
+                                                       (double)(i + 1) / even, evenValues[i + 1], 0)) {
+            goto done;
+        }
+    }
+    const double *const times = steps.times;
+    const double *const grid = steps.values;
+    const size_t n = steps.count - 1;
+    chosen = (unsigned char *)calloc(n + 1, sizeof(unsigned char));
+    if (chosen == NULL) {
+        goto done;
+    }
+
+    // the ends and where the curve turns, which the spline cannot overshoot
+    // then, are keyframes from the start
+    chosen[0] = 1;
+    chosen[n] = 1;
+    for (size_t i = 1; i < n; ++i) {
+        if ((grid[i] - grid[i - 1]) * (grid[i + 1] - grid[i]) < 0.0) {
+            chosen[i] = 1;
+        }
+    }
+
+    while (1) {
+        count = 0;
+        for (size_t i = 0; i <= n; ++i) {
+            if (chosen[i]) {
+                if (count == capacity) {
+                    count = 0;
+                    goto done;
+                }
+                keyTimes[count] = times[i];
+                progress[count] = grid[i];
+                ++count;
+            }
+        }
+
+        // the grid time farthest from the spline
+        double worst = 0.0;
+        size_t worstIndex = 0;
+        size_t segment = 0;
+        for (size_t i = 1; i < n; ++i) {
+            if (chosen[i]) {
+                ++segment;
+                continue;
+            }
+            const double s = (times[i] - keyTimes[segment]) / (keyTimes[segment + 1] - keyTimes[segment]);
+            const double value = TimelineAnimationKeyframeSplineSegment(keyTimes, progress, count, NULL, NULL, NULL,
+                                                                        segment, s);
+            const double error = fabs(value - grid[i]);
+            if (error > worst) {
+                worst = error;
+                worstIndex = i;
+            }
+        }
+        if (worst <= maximumError) {
+            break;
+        }
+        chosen[worstIndex] = 1;
+    }
+
+done:
+    free(chosen);
+    free(steps.values);
+    free(steps.times);
+    free(evenValues);
+    return count;
+}
@@ -0,0 +1,87 @@
+/*!
+ *  @file TimelineAnimationKeyframeSpline.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_KEYFRAME_SPLINE_H
+#define TIMELINE_ANIMATIONS_KEYFRAME_SPLINE_H
+
+#include <stddef.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // The keyframe interpolation of the cubic calculation modes of
+    // CAKeyframeAnimation, a Kochanek-Bartels spline through the values,
+    // Catmull-Rom when the tension, continuity and bias values are 0:
+    //
+    // - between keyframes k and k + 1, the value is the cubic Hermite curve
+    //   between them, its parameter going linearly with time from key time k
+    //   to k + 1
+    // - the tangent leaving keyframe k is
+    //       (1-T)(1+C)(1+B)/2 (P[k] - P[k-1]) + (1-T)(1-C)(1-B)/2 (P[k+1] - P[k])
+    //   and the one arriving at it
+    //       (1-T)(1-C)(1+B)/2 (P[k] - P[k-1]) + (1-T)(1+C)(1-B)/2 (P[k+1] - P[k])
+    //   both scaled for unevenly spaced key times, by 2 d[k] / (d[k-1] + d[k])
+    //   and 2 d[k-1] / (d[k-1] + d[k]) respectively, d[k] being the time
+    //   from keyframe k to k + 1
+    // - the first and last keyframes are repeated to have a neighbour
+    //
+    // Every component of a value is interpolated alone, so the spline through
+    // from + progress * (to - from) is from + spline(progress) * (to - from),
+    // and keyframes chosen for the progress hold for any number, point, size
+    // or rect.
+
+    /// The value of the spline through the `keyframeCount` keyframes at
+    /// `time`, clamped to the key times, which are ascending. `tension`,
+    /// `continuity` and `bias` have a value per keyframe, or are NULL for 0,
+    /// as the `tensionValues`, `continuityValues` and `biasValues` of the
+    /// animation.
+    double TimelineAnimationKeyframeSplineEvaluate(const double *keyTimes,
+                                                   const double *values,
+                                                   size_t keyframeCount,
+                                                   const double *tension,
+                                                   const double *continuity,
+                                                   const double *bias,
+                                                   double time);
+
+    /// The value of the spline between keyframes `k` and `k + 1` at `s`, from
+    /// 0 at keyframe `k` to 1 at `k + 1`, for callers that already know the
+    /// segment.
+    double TimelineAnimationKeyframeSplineSegment(const double *keyTimes,
+                                                  const double *values,
+                                                  size_t keyframeCount,
+                                                  const double *tension,
+                                                  const double *continuity,
+                                                  const double *bias,
+                                                  size_t k,
+                                                  double s);
+
+    /// The most keyframes TimelineAnimationKeyframeSplineProgress() is given
+    /// room for by the keyframe animations.
+    #define TimelineAnimationKeyframeSplineCapacity 256
+
+    /// Chooses as few keyframes of `function` as it finds whose Catmull-Rom
+    /// spline is within `maximumError` of it: starting from its ends and
+    /// extrema, the time the spline is farthest from the curve is added as a
+    /// keyframe until it is close enough. The error is measured at 4096
+    /// evenly spaced times, and more where the curve is about vertical. Writes the key times, from 0 to 1, and the
+    /// progress at them, and returns how many; 0 if more than `capacity` are
+    /// needed or memory runs out.
+    size_t TimelineAnimationKeyframeSplineProgress(TimelineAnimationSpecialTimingFunction function,
+                                                   double maximumError,
+                                                   size_t capacity,
+                                                   double *keyTimes,
+                                                   double *progress);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* TIMELINE_ANIMATIONS_KEYFRAME_SPLINE_H */
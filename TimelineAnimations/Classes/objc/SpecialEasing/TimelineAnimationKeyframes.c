@@ -0,0 +1,287 @@
+/*!
+ *  @file TimelineAnimationKeyframes.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "TimelineAnimationKeyframes.h"
+#include "TimelineAnimationSpecialTimingFunctionBatch.h"
+#include "TimelineAnimationTransformInterpolation.h"
+
+void TimelineAnimationKeyframeProgress(TimelineAnimationSpecialTimingFunction function,
+                                       size_t keyframeCount,
+                                       double *progress)
+{
+    // from the index, not accumulated, so that the last keyframe is at 1; a
+    // single keyframe is at 0, as the per-frame loop used to put it
+    const double last = (double)(keyframeCount - 1);
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+        progress[frame] = (last > 0) ? (double)frame / last : 0.0;
+    }
+    TimelineAnimationSpecialTimingFunctionEvaluateBatch(function, progress, progress, keyframeCount);
+}
+
+void TimelineAnimationKeyframeProgressF(TimelineAnimationSpecialTimingFunctionF function,
+                                        size_t keyframeCount,
+                                        float *progress)
+{
+    const double last = (double)(keyframeCount - 1);
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+        progress[frame] = (last > 0) ? (float)((double)frame / last) : 0.0f;
+    }
+    TimelineAnimationSpecialTimingFunctionEvaluateBatchF(function, progress, progress, keyframeCount);
+}
+
+int TimelineAnimationKeyframeNumbers(TimelineAnimationSpecialTimingFunction function,
+                                     double from,
+                                     double to,
+                                     size_t keyframeCount,
+                                     float *values)
+{
+    // the curve stays in double precision, the error of a float curve would be
+    // scaled by `to - from` before the values are rounded to float
+    const double diff = (to - from);
+    if (keyframeCount == 0) {
+        return 1;
+    }
+    double *const progress = (double *)malloc(sizeof(double) * keyframeCount);
+    if (progress == NULL) {
+        return 0;
+    }
+    TimelineAnimationKeyframeProgress(function, keyframeCount, progress);
+    for (size_t frame = 0; frame < keyframeCount; ++frame) {
+        values[frame] = (float)(from + progress[frame] * diff);
+    }
+    free(progress);
+    return 1;
+}
+
+// MARK: - Values
+
+// Loops of a constant length are vectorised at -O2 and -Os, so the planes are
+// written in blocks of this many keyframes, and the rest one by one.
+#define TA_KEYFRAME_BLOCK 32
+
+static inline void TimelineAnimationKeyframeLerpBlock(const double *restrict in,
+                                                      double *restrict out,
+                                                      double start,
+                                                      double diff)
+{
+    for (size_t j = 0; j < TA_KEYFRAME_BLOCK; ++j) {
+        out[j] = start + in[j] * diff;
+    }
+}
+
+// plane = start + progress * diff, `progress` and `plane` being the same
+// buffer or not overlapping.
+static void TimelineAnimationKeyframeLerp(const double *progress,
+                                          double *plane,
+                                          size_t keyframeCount,
+                                          double start,
+                                          double diff)
+{
+    size_t frame = 0;
+    if (progress == plane) {
+        for (; frame + TA_KEYFRAME_BLOCK <= keyframeCount; frame += TA_KEYFRAME_BLOCK) {
+            double *const block = plane + frame;
+            for (size_t j = 0; j < TA_KEYFRAME_BLOCK; ++j) {
+                block[j] = start + block[j] * diff;
+            }
+        }
+    }
+    else {
+        for (; frame + TA_KEYFRAME_BLOCK <= keyframeCount; frame += TA_KEYFRAME_BLOCK) {
+            TimelineAnimationKeyframeLerpBlock(progress + frame, plane + frame, start, diff);
+        }
+    }
+    for (; frame < keyframeCount; ++frame) {
+        plane[frame] = start + progress[frame] * diff;
+    }
+}
+
+void TimelineAnimationKeyframeInterpolate(const double *progress,
+                                          size_t keyframeCount,
+                                          const double *from,
+                                          const double *to,
+                                          size_t dimensions,
+                                          double *values)
+{
+    // the last plane last, in case it holds the progress
+    for (size_t component = 0; component < dimensions; ++component) {
+        TimelineAnimationKeyframeLerp(progress, values + component * keyframeCount, keyframeCount,
+                                      from[component], to[component] - from[component]);
+    }
+}
+
+void TimelineAnimationKeyframeVectors(TimelineAnimationSpecialTimingFunction function,
+                                      const double *from,
+                                      const double *to,
+                                      size_t dimensions,
+                                      size_t keyframeCount,
+                                      double *values)
+{
+    double *const progress = values + (dimensions - 1) * keyframeCount;
+    TimelineAnimationKeyframeProgress(function, keyframeCount, progress);
+    TimelineAnimationKeyframeInterpolate(progress, keyframeCount, from, to, dimensions, values);
+}
+
+void TimelineAnimationKeyframeInterpolateAffineTransform(const double *progress,
+                                                         size_t keyframeCount,
+                                                         const double from[TimelineAnimationKeyframeAffineComponents],
+                                                         const double to[TimelineAnimationKeyframeAffineComponents],
+                                                         double *values)
+{
+    TimelineAnimationTransformInterpolateAffine(progress, keyframeCount, from, to, values);
+}
+
+void TimelineAnimationKeyframeAffineTransforms(TimelineAnimationSpecialTimingFunction function,
+                                               const double from[TimelineAnimationKeyframeAffineComponents],
+                                               const double to[TimelineAnimationKeyframeAffineComponents],
+                                               size_t keyframeCount,
+                                               double *values)
+{
+    double *const progress = values + (TimelineAnimationKeyframeAffineComponents - 1) * keyframeCount;
+    TimelineAnimationKeyframeProgress(function, keyframeCount, progress);
+    TimelineAnimationKeyframeInterpolateAffineTransform(progress, keyframeCount, from, to, values);
+}
+
+// MARK: - Adaptive keyframes
+
+// The curve is sampled evenly this many times, then more finely where it
+// jumps, turns vertical or bends sharply, see TimelineAnimationKeyframeRefine().
+#define TA_ADAPTIVE_GRID 4096
+
+// How many times a grid interval can be halved, down to 2^-32.
+#define TA_ADAPTIVE_DEPTH 20
+
+typedef struct {
+    double *times;
+    double *values;
+    size_t count;
+    size_t capacity;
+} TimelineAnimationKeyframeSamples;
+
+static int TimelineAnimationKeyframeSamplesAppend(TimelineAnimationKeyframeSamples *samples, double time, double value)
+{
+    if (samples->count == samples->capacity) {
+        const size_t capacity = samples->capacity * 2;
+        double *const times = (double *)realloc(samples->times, sizeof(double) * capacity);
+        if (times == NULL) {
+            return 0;
+        }
+        samples->times = times;
+        double *const values = (double *)realloc(samples->values, sizeof(double) * capacity);
+        if (values == NULL) {
+            return 0;
+        }
+        samples->values = values;
+        samples->capacity = capacity;
+    }
+    samples->times[samples->count] = time;
+    samples->values[samples->count] = value;
+    ++samples->count;
+    return 1;
+}
+
+// Appends the samples of (start, end], halving the interval for as long as
+// the curve strays from its chord by more than `threshold` at the middle.
+static int TimelineAnimationKeyframeRefine(TimelineAnimationSpecialTimingFunction function,
+                                           double start, double startValue,
+                                           double end, double endValue,
+                                           double threshold, int depth,
+                                           TimelineAnimationKeyframeSamples *samples)
+{
+    const double middle = 0.5 * (start + end);
+    const double middleValue = function(middle);
+    if (depth < TA_ADAPTIVE_DEPTH && fabs(middleValue - 0.5 * (startValue + endValue)) > threshold) {
+        return TimelineAnimationKeyframeRefine(function, start, startValue, middle, middleValue, threshold, depth + 1, samples)
+            && TimelineAnimationKeyframeRefine(function, middle, middleValue, end, endValue, threshold, depth + 1, samples);
+    }
+    return TimelineAnimationKeyframeSamplesAppend(samples, end, endValue);
+}
+
+size_t TimelineAnimationKeyframeAdaptiveProgress(TimelineAnimationSpecialTimingFunction function,
+                                                 double maximumError,
+                                                 size_t capacity,
+                                                 double *keyTimes,
+                                                 double *progress)
+{
+    // Between two samples the curve stays within a sixteenth of the error of
+    // their chord, so the keyframes are chosen within the other fifteen.
+    const double threshold = maximumError * 0.0625;
+    const double tolerance = maximumError - threshold;
+
+    const size_t n = TA_ADAPTIVE_GRID;
+    double *const grid = (double *)malloc(sizeof(double) * (n + 1));
+    TimelineAnimationKeyframeSamples samples = {
+        (double *)malloc(sizeof(double) * 2 * (n + 1)),
+        (double *)malloc(sizeof(double) * 2 * (n + 1)),
+        0,
+        2 * (n + 1),
+    };
+    size_t count = 0;
+    if (grid == NULL || samples.times == NULL || samples.values == NULL) {
+        goto done;
+    }
+    for (size_t i = 0; i <= n; ++i) {
+        grid[i] = (double)i / n;
+    }
+    TimelineAnimationSpecialTimingFunctionEvaluateBatch(function, grid, grid, n + 1);
+    TimelineAnimationKeyframeSamplesAppend(&samples, 0.0, grid[0]);
+    for (size_t i = 0; i < n; ++i) {
+        if (!TimelineAnimationKeyframeRefine(function, (double)i / n, grid[i], (double)(i + 1) / n, grid[i + 1],
+                                             threshold, 0, &samples)) {
+            goto done;
+        }
+    }
+
+    // Greedily, each keyframe is followed by the farthest sample the chord to
+    // which passes within `tolerance` of every sample in between. Those
+    // samples bound the slope of the chord from below and above, so the
+    // bounds are narrowed as the chord grows, until no chord can pass any more.
+    const double *const times = samples.times;
+    const double *const values = samples.values;
+    const size_t last = samples.count - 1;
+    size_t start = 0;
+    while (1) {
+        if (count == capacity) {
+            count = 0;
+            goto done;
+        }
+        keyTimes[count] = times[start];
+        progress[count] = values[start];
+        ++count;
+        if (start == last) {
+            break;
+        }
+
+        double lower = -INFINITY;
+        double upper = INFINITY;
+        size_t end = start + 1;
+        for (size_t i = start + 1; i <= last; ++i) {
+            const double run = times[i] - times[start];
+            const double rise = values[i] - values[start];
+            const double slope = rise / run;
+            if (slope >= lower && slope <= upper) {
+                end = i;
+            }
+            lower = fmax(lower, (rise - tolerance) / run);
+            upper = fmin(upper, (rise + tolerance) / run);
+            if (lower > upper) {
+                break;
+            }
+        }
+        start = end;
+    }
+
+done:
+    free(samples.values);
+    free(samples.times);
+    free(grid);
+    return count;
+}
@@ -0,0 +1,114 @@
+/*!
+ *  @file TimelineAnimationKeyframes.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_KEYFRAMES_H
+#define TIMELINE_ANIMATIONS_KEYFRAMES_H
+
+#include <stddef.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // The numeric part of CAKeyframeAnimation+SpecialEasing, free of
+    // Foundation so that it builds and can be measured on any platform.
+    //
+    // Keyframe `frame` is at time frame / (keyframeCount - 1), so the first
+    // and last keyframes are at exactly 0 and 1; a single keyframe is at 0,
+    // the value of the curve at its start. Values with several
+    // components are written planar, one contiguous plane per component:
+    // component `c` of keyframe `frame` is values[c * keyframeCount + frame].
+
+    /// Writes the progress of `function` at `keyframeCount` evenly spaced
+    /// times in `progress`, with the batch kernels.
+    void TimelineAnimationKeyframeProgress(TimelineAnimationSpecialTimingFunction function,
+                                           size_t keyframeCount,
+                                           double *progress);
+
+    /// Single precision version of TimelineAnimationKeyframeProgress().
+    void TimelineAnimationKeyframeProgressF(TimelineAnimationSpecialTimingFunctionF function,
+                                            size_t keyframeCount,
+                                            float *progress);
+
+    /// Writes the `keyframeCount` values of a scalar going from `from` to `to`
+    /// along `function` in `values`, as the keyframe animations box them. The
+    /// curve is evaluated in double precision and only the values are rounded.
+    /// Returns 0 if memory runs out.
+    int TimelineAnimationKeyframeNumbers(TimelineAnimationSpecialTimingFunction function,
+                                         double from,
+                                         double to,
+                                         size_t keyframeCount,
+                                         float *values);
+
+    /// Writes the keyframes of a value of `dimensions` components going from
+    /// `from` to `to` along `progress` in `values`, planar. `progress` may be
+    /// the last plane of `values`. Points and sizes have 2 components, rects 4.
+    void TimelineAnimationKeyframeInterpolate(const double *progress,
+                                              size_t keyframeCount,
+                                              const double *from,
+                                              const double *to,
+                                              size_t dimensions,
+                                              double *values);
+
+    /// Writes the `keyframeCount` keyframes of a value of `dimensions`
+    /// components going from `from` to `to` along `function` in `values`,
+    /// planar, `dimensions * keyframeCount` doubles.
+    void TimelineAnimationKeyframeVectors(TimelineAnimationSpecialTimingFunction function,
+                                          const double *from,
+                                          const double *to,
+                                          size_t dimensions,
+                                          size_t keyframeCount,
+                                          double *values);
+
+    /// The number of components of an affine transform: a, b, c, d, tx, ty.
+    #define TimelineAnimationKeyframeAffineComponents 6
+
+    /// Writes the keyframes of an affine transform going from `from` to `to`
+    /// along `progress` in `values`, planar in the order of
+    /// CGAffineTransform. The transforms are decomposed and their parts
+    /// interpolated, see TimelineAnimationTransformInterpolateAffine().
+    /// `progress` may be the last plane of `values`.
+    void TimelineAnimationKeyframeInterpolateAffineTransform(const double *progress,
+                                                             size_t keyframeCount,
+                                                             const double from[TimelineAnimationKeyframeAffineComponents],
+                                                             const double to[TimelineAnimationKeyframeAffineComponents],
+                                                             double *values);
+
+    /// Writes the `keyframeCount` keyframes of an affine transform going from
+    /// `from` to `to` along `function` in `values`, planar,
+    /// `TimelineAnimationKeyframeAffineComponents * keyframeCount` doubles.
+    void TimelineAnimationKeyframeAffineTransforms(TimelineAnimationSpecialTimingFunction function,
+                                                   const double from[TimelineAnimationKeyframeAffineComponents],
+                                                   const double to[TimelineAnimationKeyframeAffineComponents],
+                                                   size_t keyframeCount,
+                                                   double *values);
+
+    /// Enough keyframes for TimelineAnimationKeyframeAdaptiveProgress() and any
+    /// curve of TimelineAnimationSpecialTimingFunction.h, down to a maximum
+    /// error of 1e-5.
+    #define TimelineAnimationKeyframeAdaptiveCapacity 4096
+
+    /// Places keyframes where `function` bends instead of evenly: as few as
+    /// possible so that interpolating them linearly, as Core Animation does,
+    /// stays within `maximumError` of the curve, in progress units. Writes
+    /// their key times and progress in `keyTimes` and `progress`, the first at
+    /// 0 and the last at 1, and returns their count. Returns 0 if there would be
+    /// more than `capacity`, or if memory runs out.
+    size_t TimelineAnimationKeyframeAdaptiveProgress(TimelineAnimationSpecialTimingFunction function,
+                                                     double maximumError,
+                                                     size_t capacity,
+                                                     double *keyTimes,
+                                                     double *progress);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -314,3 +314,290 @@ double SlowMotion(const double p) {
     }
     return r;
 }
+
+// MARK: - Single precision
+//
+// The same curves computed in float. Every constant is a float so that
+// nothing is promoted to double.
+
+#define TA_PI_F ((float)M_PI)
+#define TA_PI_2_F ((float)M_PI_2)
+
+float LinearInterpolationF(float p)
+{
+	return p;
+}
+
+float QuadraticEaseInF(float p)
+{
+	return p * p;
+}
+
+float QuadraticEaseOutF(float p)
+{
+	return -(p * (p - 2));
+}
+
+float QuadraticEaseInOutF(float p)
+{
+	if(p < 0.5f)
+	{
+		return 2 * p * p;
+	}
+	else
+	{
+		return (-2 * p * p) + (4 * p) - 1;
+	}
+}
+
+float CubicEaseInF(float p)
+{
+	return p * p * p;
+}
+
+float CubicEaseOutF(float p)
+{
+	float f = (p - 1);
+	return f * f * f + 1;
+}
+
+float CubicEaseInOutF(float p)
+{
+	if(p < 0.5f)
+	{
+		return 4 * p * p * p;
+	}
+	else
+	{
+		float f = ((2 * p) - 2);
+		return 0.5f * f * f * f + 1;
+	}
+}
+
+float QuarticEaseInF(float p)
+{
+	return p * p * p * p;
+}
+
+float QuarticEaseOutF(float p)
+{
+	float f = (p - 1);
+	return f * f * f * (1 - p) + 1;
+}
+
+float QuarticEaseInOutF(float p)
+{
+	if(p < 0.5f)
+	{
+		return 8 * p * p * p * p;
+	}
+	else
+	{
+		float f = (p - 1);
+		return -8 * f * f * f * f + 1;
+	}
+}
+
+float QuinticEaseInF(float p)
+{
+	return p * p * p * p * p;
+}
+
+float QuinticEaseOutF(float p)
+{
+	float f = (p - 1);
+	return f * f * f * f * f + 1;
+}
+
+float QuinticEaseInOutF(float p)
+{
+	if(p < 0.5f)
+	{
+		return 16 * p * p * p * p * p;
+	}
+	else
+	{
+		float f = ((2 * p) - 2);
+		return 0.5f * f * f * f * f * f + 1;
+	}
+}
+
+float SineEaseInF(float p)
+{
+	return sinf((p - 1) * TA_PI_2_F) + 1;
+}
+
+float SineEaseOutF(float p)
+{
+	return sinf(p * TA_PI_2_F);
+}
+
+float SineEaseInOutF(float p)
+{
+	return 0.5f * (1 - cosf(p * TA_PI_F));
+}
+
+float CircularEaseInF(float p)
+{
+	return 1 - sqrtf(1 - (p * p));
+}
+
+float CircularEaseOutF(float p)
+{
+	return sqrtf((2 - p) * p);
+}
+
+float CircularEaseInOutF(float p)
+{
+	if(p < 0.5f)
+	{
+		return 0.5f * (1 - sqrtf(1 - 4 * (p * p)));
+	}
+	else
+	{
+		return 0.5f * (sqrtf(-((2 * p) - 3) * ((2 * p) - 1)) + 1);
+	}
+}
+
+float ExponentialEaseInF(float p)
+{
+	return (p == 0.0f) ? p : exp2f(10 * (p - 1));
+}
+
+float ExponentialEaseOutF(float p)
+{
+	return (p == 1.0f) ? p : 1 - exp2f(-10 * p);
+}
+
+float ExponentialEaseInOutF(float p)
+{
+	if(p == 0.0f || p == 1.0f) return p;
+	
+	if(p < 0.5f)
+	{
+		return 0.5f * exp2f((20 * p) - 10);
+	}
+	else
+	{
+		return -0.5f * exp2f((-20 * p) + 10) + 1;
+	}
+}
+
+float ElasticEaseInF(float p)
+{
+	return sinf(13 * TA_PI_2_F * p) * exp2f(10 * (p - 1));
+}
+
+float ElasticEaseOutF(float p)
+{
+	return sinf(-13 * TA_PI_2_F * (p + 1)) * exp2f(-10 * p) + 1;
+}
+
+float ElasticEaseInOutF(float p)
+{
+	if(p < 0.5f)
+	{
+		return 0.5f * sinf(13 * TA_PI_2_F * (2 * p)) * exp2f(10 * ((2 * p) - 1));
+	}
+	else
+	{
+		return 0.5f * (sinf(-13 * TA_PI_2_F * ((2 * p - 1) + 1)) * exp2f(-10 * (2 * p - 1)) + 2);
+	}
+}
+
+float BackEaseInF(float p)
+{
+	return p * p * p - p * sinf(p * TA_PI_F);
+}
+
+float BackEaseOutF(float p)
+{
+	float f = (1 - p);
+	return 1 - (f * f * f - f * sinf(f * TA_PI_F));
+}
+
+float BackEaseInOutF(float p)
+{
+	if(p < 0.5f)
+	{
+		float f = 2 * p;
+		return 0.5f * (f * f * f - f * sinf(f * TA_PI_F));
+	}
+	else
+	{
+		float f = (1 - (2*p - 1));
+		return 0.5f * (1 - (f * f * f - f * sinf(f * TA_PI_F))) + 0.5f;
+	}
+}
+
+float BounceEaseInF(float p)
+{
+	return 1 - BounceEaseOutF(1 - p);
+}
+
+float BounceEaseOutF(float p)
+{
+	if(p < 4/11.0f)
+	{
+		return (121 * p * p)/16.0f;
+	}
+	else if(p < 8/11.0f)
+	{
+		return (363/40.0f * p * p) - (99/10.0f * p) + 17/5.0f;
+	}
+	else if(p < 9/10.0f)
+	{
+		return (4356/361.0f * p * p) - (35442/1805.0f * p) + 16061/1805.0f;
+	}
+	else
+	{
+		return (54/5.0f * p * p) - (513/25.0f * p) + 268/25.0f;
+	}
+}
+
+float BounceEaseInOutF(float p)
+{
+	if(p < 0.5f)
+	{
+		return 0.5f * BounceEaseInF(p*2);
+	}
+	else
+	{
+		return 0.5f * BounceEaseOutF(p * 2 - 1) + 0.5f;
+	}
+}
+
+float SlowMotionF(const float p) {
+    const float p1 = 0.25f;
+    const float p2 = 0.7f;
+    const float p3 = p1 + p2;
+    
+    const float r = p + (0.5f - p) * p;
+    if (p < p1) {
+        const float e = 1 - (p / p1);
+        return r - (e * e * e * e * r);
+    } else if (p > p3) {
+        const float e = (p - p3) / p1;
+        return r + (p - r) * (e * e * e * e);
+    }
+    return r;
+}
+
+TimelineAnimationSpecialTimingFunctionF TimelineAnimationSpecialTimingFunctionSinglePrecision(TimelineAnimationSpecialTimingFunction function)
+{
+#define TA_MATCH(name) if (function == name) { return name##F; }
+	TA_MATCH(LinearInterpolation)
+	TA_MATCH(QuadraticEaseIn) TA_MATCH(QuadraticEaseOut) TA_MATCH(QuadraticEaseInOut)
+	TA_MATCH(CubicEaseIn) TA_MATCH(CubicEaseOut) TA_MATCH(CubicEaseInOut)
+	TA_MATCH(QuarticEaseIn) TA_MATCH(QuarticEaseOut) TA_MATCH(QuarticEaseInOut)
+	TA_MATCH(QuinticEaseIn) TA_MATCH(QuinticEaseOut) TA_MATCH(QuinticEaseInOut)
+	TA_MATCH(SineEaseIn) TA_MATCH(SineEaseOut) TA_MATCH(SineEaseInOut)
+	TA_MATCH(CircularEaseIn) TA_MATCH(CircularEaseOut) TA_MATCH(CircularEaseInOut)
+	TA_MATCH(ExponentialEaseIn) TA_MATCH(ExponentialEaseOut) TA_MATCH(ExponentialEaseInOut)
+	TA_MATCH(BackEaseIn) TA_MATCH(BackEaseOut) TA_MATCH(BackEaseInOut)
+	TA_MATCH(ElasticEaseIn) TA_MATCH(ElasticEaseOut) TA_MATCH(ElasticEaseInOut)
+	TA_MATCH(BounceEaseIn) TA_MATCH(BounceEaseOut) TA_MATCH(BounceEaseInOut)
+	TA_MATCH(SlowMotion)
+#undef TA_MATCH
+	return (TimelineAnimationSpecialTimingFunctionF)0;
+}
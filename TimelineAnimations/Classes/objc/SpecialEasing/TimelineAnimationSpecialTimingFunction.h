@@ -71,6 +71,61 @@ extern "C" {
     
     double SlowMotion(double p);
     
+    // Single precision versions of the curves above, for callers that end up
+    // with a float anyway. They stay within 1.1e-7 of the double versions for
+    // the polynomial curves and SlowMotion, 1.2e-7 for Sine and Exponential,
+    // 3e-7 for Back, 8.5e-7 for Circular, 1.1e-6 for Elastic and 3.1e-6 for
+    // Bounce, which Tools/TimelineAnimationULPCheck.c checks.
+    typedef float (*TimelineAnimationSpecialTimingFunctionF)(float);
+    
+    float LinearInterpolationF(float p);
+    
+    float QuadraticEaseInF(float p);
+    float QuadraticEaseOutF(float p);
+    float QuadraticEaseInOutF(float p);
+    
+    float CubicEaseInF(float p);
+    float CubicEaseOutF(float p);
+    float CubicEaseInOutF(float p);
+    
+    float QuarticEaseInF(float p);
+    float QuarticEaseOutF(float p);
+    float QuarticEaseInOutF(float p);
+    
+    float QuinticEaseInF(float p);
+    float QuinticEaseOutF(float p);
+    float QuinticEaseInOutF(float p);
+    
+    float SineEaseInF(float p);
+    float SineEaseOutF(float p);
+    float SineEaseInOutF(float p);
+    
+    float CircularEaseInF(float p);
+    float CircularEaseOutF(float p);
+    float CircularEaseInOutF(float p);
+    
+    float ExponentialEaseInF(float p);
+    float ExponentialEaseOutF(float p);
+    float ExponentialEaseInOutF(float p);
+    
+    float BackEaseInF(float p);
+    float BackEaseOutF(float p);
+    float BackEaseInOutF(float p);
+    
+    float ElasticEaseInF(float p);
+    float ElasticEaseOutF(float p);
+    float ElasticEaseInOutF(float p);
+    
+    float BounceEaseInF(float p);
+    float BounceEaseOutF(float p);
+    float BounceEaseInOutF(float p);
+    
+    float SlowMotionF(float p);
+    
+    // Returns the single precision version of `function`, or NULL if it is
+    // not one of the curves above.
+    TimelineAnimationSpecialTimingFunctionF TimelineAnimationSpecialTimingFunctionSinglePrecision(TimelineAnimationSpecialTimingFunction function);
+    
 #ifdef __cplusplus
 }
 #endif
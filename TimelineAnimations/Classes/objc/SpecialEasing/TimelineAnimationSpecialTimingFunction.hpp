@@ -0,0 +1,471 @@
+/*!
+ *  @file TimelineAnimationSpecialTimingFunction.hpp
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_EASING_HPP
+#define TIMELINE_ANIMATIONS_EASING_HPP
+
+#if defined __cplusplus
+
+// Header-only C++17 version of TimelineAnimationSpecialTimingFunction.h.
+//
+// Every curve is a functor, so that a sampling loop instantiated for it
+// inlines the curve and can be vectorised by the compiler, something a call
+// through a TimelineAnimationSpecialTimingFunction pointer never allows.
+// For `double` the functors repeat the arithmetic of the C functions
+// operation by operation and return the same values, as long as both are
+// built with the same floating point contraction (-ffp-contract).
+//
+// The polynomial, Bounce and SlowMotion curves are constexpr. The curves
+// that need sin, sqrt or pow cannot be, as <cmath> is not constexpr in C++17.
+
+#include <cmath>
+#include <cstddef>
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#if defined __OBJC__
+#import "EasingTimingHandler.h"
+#endif
+
+namespace TimelineAnimations {
+namespace Easing {
+
+    namespace Constants {
+        constexpr double pi = 3.14159265358979323846264338327950288;
+        constexpr double pi_2 = 1.57079632679489661923132169163975144;
+    }
+
+    // Linear interpolation (no easing)
+    struct LinearInterpolation {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            return p;
+        }
+    };
+
+    // Quadratic easing; p^2
+    struct QuadraticEaseIn {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            return p * p;
+        }
+    };
+
+    struct QuadraticEaseOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            return -(p * (p - T(2)));
+        }
+    };
+
+    struct QuadraticEaseInOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T in = T(2) * p * p;
+            const T out = (T(-2) * p * p) + (T(4) * p) - T(1);
+            return (p < T(0.5)) ? in : out;
+        }
+    };
+
+    // Cubic easing; p^3
+    struct CubicEaseIn {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            return p * p * p;
+        }
+    };
+
+    struct CubicEaseOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T f = (p - T(1));
+            return f * f * f + T(1);
+        }
+    };
+
+    struct CubicEaseInOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T in = T(4) * p * p * p;
+            const T f = ((T(2) * p) - T(2));
+            const T out = T(0.5) * f * f * f + T(1);
+            return (p < T(0.5)) ? in : out;
+        }
+    };
+
+    // Quartic easing; p^4
+    struct QuarticEaseIn {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            return p * p * p * p;
+        }
+    };
+
+    struct QuarticEaseOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T f = (p - T(1));
+            return f * f * f * (T(1) - p) + T(1);
+        }
+    };
+
+    struct QuarticEaseInOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T in = T(8) * p * p * p * p;
+            const T f = (p - T(1));
+            const T out = T(-8) * f * f * f * f + T(1);
+            return (p < T(0.5)) ? in : out;
+        }
+    };
+
+    // Quintic easing; p^5
+    struct QuinticEaseIn {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            return p * p * p * p * p;
+        }
+    };
+
+    struct QuinticEaseOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T f = (p - T(1));
+            return f * f * f * f * f + T(1);
+        }
+    };
+
+    struct QuinticEaseInOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T in = T(16) * p * p * p * p * p;
+            const T f = ((T(2) * p) - T(2));
+            const T out = T(0.5) * f * f * f * f * f + T(1);
+            return (p < T(0.5)) ? in : out;
+        }
+    };
+
+    // Sine wave easing; sin(p * PI/2)
+    struct SineEaseIn {
+        template <typename T> T operator()(const T p) const noexcept {
+            return std::sin((p - T(1)) * T(Constants::pi_2)) + T(1);
+        }
+    };
+
+    struct SineEaseOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            return std::sin(p * T(Constants::pi_2));
+        }
+    };
+
+    struct SineEaseInOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            return T(0.5) * (T(1) - std::cos(p * T(Constants::pi)));
+        }
+    };
+
+    // Circular easing; sqrt(1 - p^2)
+    struct CircularEaseIn {
+        template <typename T> T operator()(const T p) const noexcept {
+            return T(1) - std::sqrt(T(1) - (p * p));
+        }
+    };
+
+    struct CircularEaseOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            return std::sqrt((T(2) - p) * p);
+        }
+    };
+
+    struct CircularEaseInOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            if (p < T(0.5)) {
+                return T(0.5) * (T(1) - std::sqrt(T(1) - T(4) * (p * p)));
+            }
+            return T(0.5) * (std::sqrt(-((T(2) * p) - T(3)) * ((T(2) * p) - T(1))) + T(1));
+        }
+    };
+
+    // Exponential easing, base 2
+    struct ExponentialEaseIn {
+        template <typename T> T operator()(const T p) const noexcept {
+            return (p == T(0)) ? p : std::pow(T(2), T(10) * (p - T(1)));
+        }
+    };
+
+    struct ExponentialEaseOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            return (p == T(1)) ? p : T(1) - std::pow(T(2), T(-10) * p);
+        }
+    };
+
+    struct ExponentialEaseInOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            if (p == T(0) || p == T(1)) {
+                return p;
+            }
+            if (p < T(0.5)) {
+                return T(0.5) * std::pow(T(2), (T(20) * p) - T(10));
+            }
+            return T(-0.5) * std::pow(T(2), (T(-20) * p) + T(10)) + T(1);
+        }
+    };
+
+    // Overshooting cubic easing;
+    struct BackEaseIn {
+        template <typename T> T operator()(const T p) const noexcept {
+            return p * p * p - p * std::sin(p * T(Constants::pi));
+        }
+    };
+
+    struct BackEaseOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            const T f = (T(1) - p);
+            return T(1) - (f * f * f - f * std::sin(f * T(Constants::pi)));
+        }
+    };
+
+    struct BackEaseInOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            if (p < T(0.5)) {
+                const T f = T(2) * p;
+                return T(0.5) * (f * f * f - f * std::sin(f * T(Constants::pi)));
+            }
+            const T f = (T(1) - (T(2) * p - T(1)));
+            return T(0.5) * (T(1) - (f * f * f - f * std::sin(f * T(Constants::pi)))) + T(0.5);
+        }
+    };
+
+    // Exponentially-damped sine wave easing
+    struct ElasticEaseIn {
+        template <typename T> T operator()(const T p) const noexcept {
+            return std::sin(T(13) * T(Constants::pi_2) * p) * std::pow(T(2), T(10) * (p - T(1)));
+        }
+    };
+
+    struct ElasticEaseOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            return std::sin(T(-13) * T(Constants::pi_2) * (p + T(1))) * std::pow(T(2), T(-10) * p) + T(1);
+        }
+    };
+
+    struct ElasticEaseInOut {
+        template <typename T> T operator()(const T p) const noexcept {
+            if (p < T(0.5)) {
+                return T(0.5) * std::sin(T(13) * T(Constants::pi_2) * (T(2) * p)) * std::pow(T(2), T(10) * ((T(2) * p) - T(1)));
+            }
+            return T(0.5) * (std::sin(T(-13) * T(Constants::pi_2) * ((T(2) * p - T(1)) + T(1))) * std::pow(T(2), T(-10) * (T(2) * p - T(1))) + T(2));
+        }
+    };
+
+    // Exponentially-decaying bounce easing
+    struct BounceEaseOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T a = (T(121) * p * p) / T(16.0);
+            const T b = (T(363/40.0) * p * p) - (T(99/10.0) * p) + T(17/5.0);
+            const T c = (T(4356/361.0) * p * p) - (T(35442/1805.0) * p) + T(16061/1805.0);
+            const T d = (T(54/5.0) * p * p) - (T(513/25.0) * p) + T(268/25.0);
+            return (p < T(4/11.0)) ? a : (p < T(8/11.0)) ? b : (p < T(9/10.0)) ? c : d;
+        }
+    };
+
+    struct BounceEaseIn {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            return T(1) - BounceEaseOut()(T(1) - p);
+        }
+    };
+
+    struct BounceEaseInOut {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T in = T(0.5) * BounceEaseIn()(p * T(2));
+            const T out = T(0.5) * BounceEaseOut()(p * T(2) - T(1)) + T(0.5);
+            return (p < T(0.5)) ? in : out;
+        }
+    };
+
+    struct SlowMotion {
+        template <typename T> constexpr T operator()(const T p) const noexcept {
+            const T p1 = T(0.25);
+            const T p3 = p1 + T(0.7);
+            const T r = p + (T(0.5) - p) * p;
+            const T e = T(1) - (p / p1);
+            const T begin = r - (e * e * e * e * r);
+            const T e1 = (p - p3) / p1;
+            const T end = r + (p - r) * (e1 * e1 * e1 * e1);
+            return (p < p1) ? begin : (p > p3) ? end : r;
+        }
+    };
+
+    // MARK: - Sampling
+
+    /// Evaluates `Curve` for `n` progress values. `in` and `out` may be the
+    /// same buffer.
+    template <typename Curve, typename T>
+    inline void evaluate(const T *in, T *out, const std::size_t n) noexcept {
+        constexpr Curve curve{};
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = curve(in[i]);
+        }
+    }
+
+    /// Fills `out` with `count` values of `Curve` at evenly spaced progress,
+    /// `i / (count - 1)`, so that the first and the last are exactly at 0 and 1.
+    template <typename Curve, typename T>
+    inline void sample(T *out, const std::size_t count) noexcept {
+        constexpr Curve curve{};
+        if (count == 1) {
+            out[0] = curve(T(0));
+            return;
+        }
+        const T last = T(count - 1);
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = curve(T(i) / last);
+        }
+    }
+
+    /// Fills `out` with `count` values between `from` and `to`, eased by
+    /// `Curve` at evenly spaced progress.
+    template <typename Curve, typename T>
+    inline void interpolate(const T from, const T to, T *out, const std::size_t count) noexcept {
+        constexpr Curve curve{};
+        if (count == 1) {
+            out[0] = from + curve(T(0)) * (to - from);
+            return;
+        }
+        const T last = T(count - 1);
+        const T diff = (to - from);
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = from + curve(T(i) / last) * diff;
+        }
+    }
+
+    // MARK: - Dispatch
+
+    /// Mirrors ECustomTimingFunction of EasingTimingHandler.h, which cannot be
+    /// included from plain C++.
+    enum class CustomTimingFunction : std::size_t {
+        Default = 0,
+        Linear,
+        EaseIn,
+        EaseOut,
+        EaseInOut,
+        SineIn,
+        SineOut,
+        SineInOut,
+        QuadIn,
+        QuadOut,
+        QuadInOut,
+        CubicIn,
+        CubicOut,
+        CubicInOut,
+        QuartIn,
+        QuartOut,
+        QuartInOut,
+        QuintIn,
+        QuintOut,
+        QuintInOut,
+        ExpoIn,
+        ExpoOut,
+        ExpoInOut,
+        CircIn,
+        CircOut,
+        CircInOut,
+        BackIn,
+        BackOut,
+        BackInOut,
+        ElasticIn,
+        ElasticOut,
+        ElasticInOut,
+        BounceIn,
+        BounceOut,
+        BounceInOut,
+        Count
+    };
+
+    /// The instantiations of one curve.
+    struct Entry {
+        /// The C function of the curve.
+        TimelineAnimationSpecialTimingFunction function;
+        void (*evaluate)(const double *in, double *out, std::size_t n);
+        void (*sample)(double *out, std::size_t count);
+        void (*interpolate)(double from, double to, double *out, std::size_t count);
+    };
+
+    namespace Detail {
+        template <typename Curve>
+        constexpr Entry entry(const TimelineAnimationSpecialTimingFunction function) noexcept {
+            return Entry{
+                function,
+                &evaluate<Curve, double>,
+                &sample<Curve, double>,
+                &interpolate<Curve, double>,
+            };
+        }
+
+        // Default and the EaseIn/Out/InOut values are Core Animation curves,
+        // they have no function
+        constexpr Entry none{ nullptr, nullptr, nullptr, nullptr };
+
+        constexpr Entry entries[std::size_t(CustomTimingFunction::Count)] = {
+            none,
+            entry<Easing::LinearInterpolation>(::LinearInterpolation),
+            none,
+            none,
+            none,
+            entry<Easing::SineEaseIn>(::SineEaseIn),
+            entry<Easing::SineEaseOut>(::SineEaseOut),
+            entry<Easing::SineEaseInOut>(::SineEaseInOut),
+            entry<Easing::QuadraticEaseIn>(::QuadraticEaseIn),
+            entry<Easing::QuadraticEaseOut>(::QuadraticEaseOut),
+            entry<Easing::QuadraticEaseInOut>(::QuadraticEaseInOut),
+            entry<Easing::CubicEaseIn>(::CubicEaseIn),
+            entry<Easing::CubicEaseOut>(::CubicEaseOut),
+            entry<Easing::CubicEaseInOut>(::CubicEaseInOut),
+            entry<Easing::QuarticEaseIn>(::QuarticEaseIn),
+            entry<Easing::QuarticEaseOut>(::QuarticEaseOut),
+            entry<Easing::QuarticEaseInOut>(::QuarticEaseInOut),
+            entry<Easing::QuinticEaseIn>(::QuinticEaseIn),
+            entry<Easing::QuinticEaseOut>(::QuinticEaseOut),
+            entry<Easing::QuinticEaseInOut>(::QuinticEaseInOut),
+            entry<Easing::ExponentialEaseIn>(::ExponentialEaseIn),
+            entry<Easing::ExponentialEaseOut>(::ExponentialEaseOut),
+            entry<Easing::ExponentialEaseInOut>(::ExponentialEaseInOut),
+            entry<Easing::CircularEaseIn>(::CircularEaseIn),
+            entry<Easing::CircularEaseOut>(::CircularEaseOut),
+            entry<Easing::CircularEaseInOut>(::CircularEaseInOut),
+            entry<Easing::BackEaseIn>(::BackEaseIn),
+            entry<Easing::BackEaseOut>(::BackEaseOut),
+            entry<Easing::BackEaseInOut>(::BackEaseInOut),
+            entry<Easing::ElasticEaseIn>(::ElasticEaseIn),
+            entry<Easing::ElasticEaseOut>(::ElasticEaseOut),
+            entry<Easing::ElasticEaseInOut>(::ElasticEaseInOut),
+            entry<Easing::BounceEaseIn>(::BounceEaseIn),
+            entry<Easing::BounceEaseOut>(::BounceEaseOut),
+            entry<Easing::BounceEaseInOut>(::BounceEaseInOut),
+        };
+    }
+
+    /// Returns the instantiations for `timingFunction`. The members are null
+    /// for the Core Animation curves and for out of range values.
+    constexpr const Entry &entryFor(const CustomTimingFunction timingFunction) noexcept {
+        return (std::size_t(timingFunction) < std::size_t(CustomTimingFunction::Count))
+        ? Detail::entries[std::size_t(timingFunction)]
+        : Detail::none;
+    }
+
+#if defined __OBJC__
+    constexpr const Entry &entryFor(const ECustomTimingFunction timingFunction) noexcept {
+        return entryFor(CustomTimingFunction(timingFunction));
+    }
+
+    static_assert(std::size_t(CustomTimingFunction::Linear) == ECustomTimingFunctionLinear, "out of sync with ECustomTimingFunction");
+    static_assert(std::size_t(CustomTimingFunction::SineIn) == ECustomTimingFunctionSineIn, "out of sync with ECustomTimingFunction");
+    static_assert(std::size_t(CustomTimingFunction::ExpoIn) == ECustomTimingFunctionExpoIn, "out of sync with ECustomTimingFunction");
+    static_assert(std::size_t(CustomTimingFunction::CircIn) == ECustomTimingFunctionCircIn, "out of sync with ECustomTimingFunction");
+    static_assert(std::size_t(CustomTimingFunction::BackIn) == ECustomTimingFunctionBackIn, "out of sync with ECustomTimingFunction");
+    static_assert(std::size_t(CustomTimingFunction::ElasticIn) == ECustomTimingFunctionElasticIn, "out of sync with ECustomTimingFunction");
+    static_assert(std::size_t(CustomTimingFunction::BounceInOut) == ECustomTimingFunctionBounceInOut, "out of sync with ECustomTimingFunction");
+#endif
+
+    static_assert(QuadraticEaseInOut()(0.25) == 0.125, "the polynomial curves are constexpr");
+    static_assert(BounceEaseOut()(0.0) == 0.0, "the bounce curves are constexpr");
+    static_assert(entryFor(CustomTimingFunction::Default).function == nullptr, "no function for the Core Animation curves");
+
+} // namespace Easing
+} // namespace TimelineAnimations
+
+#endif /* __cplusplus */
+
+#endif
@@ -0,0 +1,465 @@
+/*!
+ *  @file TimelineAnimationSpecialTimingFunctionBatch.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "TimelineAnimationSpecialTimingFunctionBatch.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define TA_HAS_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__arm64__)
+#define TA_HAS_NEON 1
+#include <arm_neon.h>
+#endif
+
+// Every curve has a vector kernel in TimelineAnimationSpecialTimingFunctionKernels.h
+#define TA_ALL_CURVES(X) \
+    X(LinearInterpolation) \
+    X(QuadraticEaseIn) X(QuadraticEaseOut) X(QuadraticEaseInOut) \
+    X(CubicEaseIn) X(CubicEaseOut) X(CubicEaseInOut) \
+    X(QuarticEaseIn) X(QuarticEaseOut) X(QuarticEaseInOut) \
+    X(QuinticEaseIn) X(QuinticEaseOut) X(QuinticEaseInOut) \
+    X(SineEaseIn) X(SineEaseOut) X(SineEaseInOut) \
+    X(CircularEaseIn) X(CircularEaseOut) X(CircularEaseInOut) \
+    X(ExponentialEaseIn) X(ExponentialEaseOut) X(ExponentialEaseInOut) \
+    X(BackEaseIn) X(BackEaseOut) X(BackEaseInOut) \
+    X(ElasticEaseIn) X(ElasticEaseOut) X(ElasticEaseInOut) \
+    X(BounceEaseIn) X(BounceEaseOut) X(BounceEaseInOut) \
+    X(SlowMotion)
+
+typedef struct {
+#define TA_FIELD(name) TimelineAnimationSpecialTimingBatchFunction name; TimelineAnimationSpecialTimingBatchFunctionF name##F;
+    TA_ALL_CURVES(TA_FIELD)
+#undef TA_FIELD
+} TimelineAnimationBatchKernels;
+
+// MARK: - Portable
+
+#define TA_PORTABLE_LOOP(name) \
+static void name##BatchPortable(const double *in, double *out, size_t n) \
+{ \
+    for (size_t i = 0; i < n; ++i) { \
+        out[i] = name(in[i]); \
+    } \
+} \
+static void name##BatchPortableF(const float *in, float *out, size_t n) \
+{ \
+    for (size_t i = 0; i < n; ++i) { \
+        out[i] = name##F(in[i]); \
+    } \
+}
+TA_ALL_CURVES(TA_PORTABLE_LOOP)
+#undef TA_PORTABLE_LOOP
+
+#define TA_ENTRY_PORTABLE(name) .name = name##BatchPortable, .name##F = name##BatchPortableF,
+
+static const TimelineAnimationBatchKernels TimelineAnimationBatchKernelsPortable = {
+    TA_ALL_CURVES(TA_ENTRY_PORTABLE)
+};
+
+// MARK: - SSE2 & AVX2
+
+#if TA_HAS_X86
+
+// TA_EXP2I adds 1.5 * 2^52 + 1023 (1.5 * 2^23 + 127 in float), which leaves
+// n plus the exponent bias in the low bits of the mantissa, and shifts them
+// into the exponent field
+#define TA_S double
+#define TA_V __m128d
+#define TA_W 2
+#define TA_TARGET __attribute__((target("sse2")))
+#define TA_FN(name) name##_sse2
+#define TA_SCALAR(name) name
+#define TA_SET1(x) _mm_set1_pd((double)(x))
+#define TA_LOAD(p) _mm_loadu_pd((p))
+#define TA_STORE(p, v) _mm_storeu_pd((p), (v))
+#define TA_ADD(a, b) _mm_add_pd((a), (b))
+#define TA_SUB(a, b) _mm_sub_pd((a), (b))
+#define TA_MUL(a, b) _mm_mul_pd((a), (b))
+#define TA_DIV(a, b) _mm_div_pd((a), (b))
+#define TA_SQRT(a) _mm_sqrt_pd((a))
+#define TA_LT(a, b) _mm_cmplt_pd((a), (b))
+#define TA_SELECT(m, a, b) _mm_or_pd(_mm_and_pd((m), (a)), _mm_andnot_pd((m), (b)))
+#define TA_EXP2I(n) _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(_mm_add_pd((n), _mm_set1_pd(0x1.8p52 + 1023))), 52))
+#include "TimelineAnimationSpecialTimingFunctionKernels.h"
+#undef TA_S
+#undef TA_V
+#undef TA_W
+#undef TA_TARGET
+#undef TA_FN
+#undef TA_SCALAR
+#undef TA_SET1
+#undef TA_LOAD
+#undef TA_STORE
+#undef TA_ADD
+#undef TA_SUB
+#undef TA_MUL
+#undef TA_DIV
+#undef TA_SQRT
+#undef TA_LT
+#undef TA_SELECT
+#undef TA_EXP2I
+
+#define TA_S float
+#define TA_V __m128
+#define TA_W 4
+#define TA_TARGET __attribute__((target("sse2")))
+#define TA_FN(name) name##_sse2f
+#define TA_SCALAR(name) name##F
+#define TA_SET1(x) _mm_set1_ps((float)(x))
+#define TA_LOAD(p) _mm_loadu_ps((p))
+#define TA_STORE(p, v) _mm_storeu_ps((p), (v))
+#define TA_ADD(a, b) _mm_add_ps((a), (b))
+#define TA_SUB(a, b) _mm_sub_ps((a), (b))
+#define TA_MUL(a, b) _mm_mul_ps((a), (b))
+#define TA_DIV(a, b) _mm_div_ps((a), (b))
+#define TA_SQRT(a) _mm_sqrt_ps((a))
+#define TA_LT(a, b) _mm_cmplt_ps((a), (b))
+#define TA_SELECT(m, a, b) _mm_or_ps(_mm_and_ps((m), (a)), _mm_andnot_ps((m), (b)))
+#define TA_EXP2I(n) _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm_add_ps((n), _mm_set1_ps(0x1.8p23f + 127))), 23))
+#include "TimelineAnimationSpecialTimingFunctionKernels.h"
+#undef TA_S
+#undef TA_V
+#undef TA_W
+#undef TA_TARGET
+#undef TA_FN
+#undef TA_SCALAR
+#undef TA_SET1
+#undef TA_LOAD
+#undef TA_STORE
+#undef TA_ADD
+#undef TA_SUB
+#undef TA_MUL
+#undef TA_DIV
+#undef TA_SQRT
+#undef TA_LT
+#undef TA_SELECT
+#undef TA_EXP2I
+
+#define TA_ENTRY_SSE2(name) .name = name##Batch_sse2, .name##F = name##Batch_sse2f,
+
+static const TimelineAnimationBatchKernels TimelineAnimationBatchKernelsSSE2 = {
+    TA_ALL_CURVES(TA_ENTRY_SSE2)
+};
+
+#define TA_S double
+#define TA_V __m256d
+#define TA_W 4
+#define TA_TARGET __attribute__((target("avx2")))
+#define TA_FN(name) name##_avx2
+#define TA_SCALAR(name) name
+#define TA_SET1(x) _mm256_set1_pd((double)(x))
+#define TA_LOAD(p) _mm256_loadu_pd((p))
+#define TA_STORE(p, v) _mm256_storeu_pd((p), (v))
+#define TA_ADD(a, b) _mm256_add_pd((a), (b))
+#define TA_SUB(a, b) _mm256_sub_pd((a), (b))
+#define TA_MUL(a, b) _mm256_mul_pd((a), (b))
+#define TA_DIV(a, b) _mm256_div_pd((a), (b))
+#define TA_SQRT(a) _mm256_sqrt_pd((a))
+#define TA_LT(a, b) _mm256_cmp_pd((a), (b), _CMP_LT_OQ)
+#define TA_SELECT(m, a, b) _mm256_blendv_pd((b), (a), (m))
+#define TA_EXP2I(n) _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(_mm256_add_pd((n), _mm256_set1_pd(0x1.8p52 + 1023))), 52))
+#include "TimelineAnimationSpecialTimingFunctionKernels.h"
+#undef TA_S
+#undef TA_V
+#undef TA_W
+#undef TA_TARGET
+#undef TA_FN
+#undef TA_SCALAR
+#undef TA_SET1
+#undef TA_LOAD
+#undef TA_STORE
+#undef TA_ADD
+#undef TA_SUB
+#undef TA_MUL
+#undef TA_DIV
+#undef TA_SQRT
+#undef TA_LT
+#undef TA_SELECT
+#undef TA_EXP2I
+
+#define TA_S float
+#define TA_V __m256
+#define TA_W 8
+#define TA_TARGET __attribute__((target("avx2")))
+#define TA_FN(name) name##_avx2f
+#define TA_SCALAR(name) name##F
+#define TA_SET1(x) _mm256_set1_ps((float)(x))
+#define TA_LOAD(p) _mm256_loadu_ps((p))
+#define TA_STORE(p, v) _mm256_storeu_ps((p), (v))
+#define TA_ADD(a, b) _mm256_add_ps((a), (b))
+#define TA_SUB(a, b) _mm256_sub_ps((a), (b))
+#define TA_MUL(a, b) _mm256_mul_ps((a), (b))
+#define TA_DIV(a, b) _mm256_div_ps((a), (b))
+#define TA_SQRT(a) _mm256_sqrt_ps((a))
+#define TA_LT(a, b) _mm256_cmp_ps((a), (b), _CMP_LT_OQ)
+#define TA_SELECT(m, a, b) _mm256_blendv_ps((b), (a), (m))
+#define TA_EXP2I(n) _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(_mm256_add_ps((n), _mm256_set1_ps(0x1.8p23f + 127))), 23))
+#include "TimelineAnimationSpecialTimingFunctionKernels.h"
+#undef TA_S
+#undef TA_V
+#undef TA_W
+#undef TA_TARGET
+#undef TA_FN
+#undef TA_SCALAR
+#undef TA_SET1
+#undef TA_LOAD
+#undef TA_STORE
+#undef TA_ADD
+#undef TA_SUB
+#undef TA_MUL
+#undef TA_DIV
+#undef TA_SQRT
+#undef TA_LT
+#undef TA_SELECT
+#undef TA_EXP2I
+
+#define TA_ENTRY_AVX2(name) .name = name##Batch_avx2, .name##F = name##Batch_avx2f,
+
+static const TimelineAnimationBatchKernels TimelineAnimationBatchKernelsAVX2 = {
+    TA_ALL_CURVES(TA_ENTRY_AVX2)
+};
+
+#endif /* TA_HAS_X86 */
+
+// MARK: - NEON
+
+#if TA_HAS_NEON
+
+#define TA_S double
+#define TA_V float64x2_t
+#define TA_W 2
+#define TA_TARGET
+#define TA_FN(name) name##_neon
+#define TA_SCALAR(name) name
+#define TA_SET1(x) vdupq_n_f64((double)(x))
+#define TA_LOAD(p) vld1q_f64((p))
+#define TA_STORE(p, v) vst1q_f64((p), (v))
+#define TA_ADD(a, b) vaddq_f64((a), (b))
+#define TA_SUB(a, b) vsubq_f64((a), (b))
+#define TA_MUL(a, b) vmulq_f64((a), (b))
+#define TA_DIV(a, b) vdivq_f64((a), (b))
+#define TA_SQRT(a) vsqrtq_f64((a))
+#define TA_LT(a, b) vcltq_f64((a), (b))
+#define TA_SELECT(m, a, b) vbslq_f64((m), (a), (b))
+#define TA_EXP2I(n) vreinterpretq_f64_u64(vshlq_n_u64(vreinterpretq_u64_f64(vaddq_f64((n), vdupq_n_f64(0x1.8p52 + 1023))), 52))
+#include "TimelineAnimationSpecialTimingFunctionKernels.h"
+#undef TA_S
+#undef TA_V
+#undef TA_W
+#undef TA_TARGET
+#undef TA_FN
+#undef TA_SCALAR
+#undef TA_SET1
+#undef TA_LOAD
+#undef TA_STORE
+#undef TA_ADD
+#undef TA_SUB
+#undef TA_MUL
+#undef TA_DIV
+#undef TA_SQRT
+#undef TA_LT
+#undef TA_SELECT
+#undef TA_EXP2I
+
+#define TA_S float
+#define TA_V float32x4_t
+#define TA_W 4
+#define TA_TARGET 
+#define TA_FN(name) name##_neonf
+#define TA_SCALAR(name) name##F
+#define TA_SET1(x) vdupq_n_f32((float)(x))
+#define TA_LOAD(p) vld1q_f32((p))
+#define TA_STORE(p, v) vst1q_f32((p), (v))
+#define TA_ADD(a, b) vaddq_f32((a), (b))
+#define TA_SUB(a, b) vsubq_f32((a), (b))
+#define TA_MUL(a, b) vmulq_f32((a), (b))
+#define TA_DIV(a, b) vdivq_f32((a), (b))
+#define TA_SQRT(a) vsqrtq_f32((a))
+#define TA_LT(a, b) vcltq_f32((a), (b))
+#define TA_SELECT(m, a, b) vbslq_f32((m), (a), (b))
+#define TA_EXP2I(n) vreinterpretq_f32_u32(vshlq_n_u32(vreinterpretq_u32_f32(vaddq_f32((n), vdupq_n_f32(0x1.8p23f + 127))), 23))
+#include "TimelineAnimationSpecialTimingFunctionKernels.h"
+#undef TA_S
+#undef TA_V
+#undef TA_W
+#undef TA_TARGET
+#undef TA_FN
+#undef TA_SCALAR
+#undef TA_SET1
+#undef TA_LOAD
+#undef TA_STORE
+#undef TA_ADD
+#undef TA_SUB
+#undef TA_MUL
+#undef TA_DIV
+#undef TA_SQRT
+#undef TA_LT
+#undef TA_SELECT
+#undef TA_EXP2I
+
+#define TA_ENTRY_NEON(name) .name = name##Batch_neon, .name##F = name##Batch_neonf,
+
+static const TimelineAnimationBatchKernels TimelineAnimationBatchKernelsNEON = {
+    TA_ALL_CURVES(TA_ENTRY_NEON)
+};
+
+#endif /* TA_HAS_NEON */
+
+// MARK: - Dispatch
+
+static int TimelineAnimationBatchSupportsISA(TimelineAnimationBatchISA isa)
+{
+    switch (isa) {
+        case TimelineAnimationBatchISAPortable:
+            return 1;
+#if TA_HAS_X86
+        case TimelineAnimationBatchISASSE2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse2");
+        case TimelineAnimationBatchISAAVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+#if TA_HAS_NEON
+        case TimelineAnimationBatchISANEON:
+            return 1;
+#endif
+        default:
+            return 0;
+    }
+}
+
+static const TimelineAnimationBatchKernels *TimelineAnimationBatchKernelsForISA(TimelineAnimationBatchISA isa)
+{
+    switch (isa) {
+#if TA_HAS_X86
+        case TimelineAnimationBatchISASSE2:
+            return &TimelineAnimationBatchKernelsSSE2;
+        case TimelineAnimationBatchISAAVX2:
+            return &TimelineAnimationBatchKernelsAVX2;
+#endif
+#if TA_HAS_NEON
+        case TimelineAnimationBatchISANEON:
+            return &TimelineAnimationBatchKernelsNEON;
+#endif
+        default:
+            return &TimelineAnimationBatchKernelsPortable;
+    }
+}
+
+// Written by the one-time selection and by TimelineAnimationBatchSetISA while
+// other threads may be evaluating batches, hence atomic. The kernel tables are
+// static constants, so a reader only ever needs the pointer itself.
+static pthread_once_t TimelineAnimationBatchOnce = PTHREAD_ONCE_INIT;
+static _Atomic(TimelineAnimationBatchISA) TimelineAnimationBatchISA_ = TimelineAnimationBatchISAPortable;
+static _Atomic(const TimelineAnimationBatchKernels *) TimelineAnimationBatchKernels_ = &TimelineAnimationBatchKernelsPortable;
+
+static void TimelineAnimationBatchStoreISA(TimelineAnimationBatchISA isa)
+{
+    atomic_store_explicit(&TimelineAnimationBatchKernels_, TimelineAnimationBatchKernelsForISA(isa), memory_order_relaxed);
+    atomic_store_explicit(&TimelineAnimationBatchISA_, isa, memory_order_relaxed);
+}
+
+static void TimelineAnimationBatchSelectISA(void)
+{
+    const TimelineAnimationBatchISA preferred[] = {
+        TimelineAnimationBatchISAAVX2,
+        TimelineAnimationBatchISASSE2,
+        TimelineAnimationBatchISANEON,
+    };
+    for (size_t i = 0; i < sizeof(preferred) / sizeof(preferred[0]); ++i) {
+        if (TimelineAnimationBatchSupportsISA(preferred[i])) {
+            TimelineAnimationBatchStoreISA(preferred[i]);
+            return;
+        }
+    }
+}
+
+static inline const TimelineAnimationBatchKernels *TimelineAnimationBatchCurrentKernels(void)
+{
+    pthread_once(&TimelineAnimationBatchOnce, TimelineAnimationBatchSelectISA);
+    return atomic_load_explicit(&TimelineAnimationBatchKernels_, memory_order_relaxed);
+}
+
+TimelineAnimationBatchISA TimelineAnimationBatchCurrentISA(void)
+{
+    pthread_once(&TimelineAnimationBatchOnce, TimelineAnimationBatchSelectISA);
+    return atomic_load_explicit(&TimelineAnimationBatchISA_, memory_order_relaxed);
+}
+
+int TimelineAnimationBatchSetISA(TimelineAnimationBatchISA isa)
+{
+    pthread_once(&TimelineAnimationBatchOnce, TimelineAnimationBatchSelectISA);
+    if (!TimelineAnimationBatchSupportsISA(isa)) {
+        return 0;
+    }
+    TimelineAnimationBatchStoreISA(isa);
+    return 1;
+}
+
+#define TA_PUBLIC_BATCH(name) \
+void name##Batch(const double *in, double *out, size_t n) \
+{ \
+    TimelineAnimationBatchCurrentKernels()->name(in, out, n); \
+} \
+void name##BatchF(const float *in, float *out, size_t n) \
+{ \
+    TimelineAnimationBatchCurrentKernels()->name##F(in, out, n); \
+}
+TA_ALL_CURVES(TA_PUBLIC_BATCH)
+#undef TA_PUBLIC_BATCH
+
+TimelineAnimationSpecialTimingBatchFunction TimelineAnimationSpecialTimingBatchFunctionFor(TimelineAnimationSpecialTimingFunction function)
+{
+#define TA_MATCH(name) if (function == name) { return name##Batch; }
+    TA_ALL_CURVES(TA_MATCH)
+#undef TA_MATCH
+    return (TimelineAnimationSpecialTimingBatchFunction)0;
+}
+
+void TimelineAnimationSpecialTimingFunctionEvaluateBatch(TimelineAnimationSpecialTimingFunction function,
+                                                         const double *in,
+                                                         double *out,
+                                                         size_t n)
+{
+    const TimelineAnimationSpecialTimingBatchFunction batch = TimelineAnimationSpecialTimingBatchFunctionFor(function);
+    if (batch) {
+        batch(in, out, n);
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = function(in[i]);
+    }
+}
+
+TimelineAnimationSpecialTimingBatchFunctionF TimelineAnimationSpecialTimingBatchFunctionForF(TimelineAnimationSpecialTimingFunctionF function)
+{
+#define TA_MATCH(name) if (function == name##F) { return name##BatchF; }
+    TA_ALL_CURVES(TA_MATCH)
+#undef TA_MATCH
+    return (TimelineAnimationSpecialTimingBatchFunctionF)0;
+}
+
+void TimelineAnimationSpecialTimingFunctionEvaluateBatchF(TimelineAnimationSpecialTimingFunctionF function,
+                                                          const float *in,
+                                                          float *out,
+                                                          size_t n)
+{
+    const TimelineAnimationSpecialTimingBatchFunctionF batch = TimelineAnimationSpecialTimingBatchFunctionForF(function);
+    if (batch) {
+        batch(in, out, n);
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = function(in[i]);
+    }
+}
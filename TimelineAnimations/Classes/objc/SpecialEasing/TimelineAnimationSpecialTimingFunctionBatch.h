@@ -0,0 +1,166 @@
+/*!
+ *  @file TimelineAnimationSpecialTimingFunctionBatch.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_EASING_BATCH_H
+#define TIMELINE_ANIMATIONS_EASING_BATCH_H
+
+#include <stddef.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    /// Evaluates a curve for `n` progress values. `in` and `out` may be the
+    /// same buffer, but must not otherwise overlap.
+    typedef void (*TimelineAnimationSpecialTimingBatchFunction)(const double *in, double *out, size_t n);
+
+    /// Single precision version of TimelineAnimationSpecialTimingBatchFunction,
+    /// with twice as many values per vector.
+    typedef void (*TimelineAnimationSpecialTimingBatchFunctionF)(const float *in, float *out, size_t n);
+
+    // With the SSE2, AVX2 and NEON kernels, the polynomial, Circular, Bounce
+    // and SlowMotion curves return exactly the values of the scalar functions.
+    // The Sine, Exponential, Back and Elastic curves replace sin and pow with
+    // the polynomials of TimelineAnimationSpecialTimingFunctionFast.h and stay
+    // within 2e-9, 2e-10, 2e-9 and 1.5e-9 of the double functions in double,
+    // and within 1.3e-7, 1.2e-7, 3e-7 and 1.2e-6 in float, which
+    // Tools/TimelineAnimationULPCheck.c checks. The portable kernels call the
+    // scalar functions.
+
+    /// The instruction set used by the batch kernels.
+    typedef enum {
+        TimelineAnimationBatchISAPortable = 0,
+        TimelineAnimationBatchISASSE2,
+        TimelineAnimationBatchISAAVX2,
+        TimelineAnimationBatchISANEON
+    } TimelineAnimationBatchISA;
+
+    /// The instruction set picked at runtime for the batch kernels.
+    TimelineAnimationBatchISA TimelineAnimationBatchCurrentISA(void);
+
+    /// Forces the batch kernels to a specific instruction set, for benchmarking.
+    /// Safe to call while other threads evaluate batches; a batch that is
+    /// already running finishes with the kernels it started with.
+    /// Returns 0 if the instruction set is not supported by the CPU.
+    int TimelineAnimationBatchSetISA(TimelineAnimationBatchISA isa);
+
+    /// Returns the batch version of one of the special timing functions, or
+    /// NULL if `function` is not one of them.
+    TimelineAnimationSpecialTimingBatchFunction TimelineAnimationSpecialTimingBatchFunctionFor(TimelineAnimationSpecialTimingFunction function);
+
+    /// Evaluates `function` for `n` progress values. Falls back to a scalar
+    /// loop for functions that are not part of this library.
+    void TimelineAnimationSpecialTimingFunctionEvaluateBatch(TimelineAnimationSpecialTimingFunction function,
+                                                             const double *in,
+                                                             double *out,
+                                                             size_t n);
+
+    /// Returns the batch version of one of the single precision timing
+    /// functions, or NULL if `function` is not one of them.
+    TimelineAnimationSpecialTimingBatchFunctionF TimelineAnimationSpecialTimingBatchFunctionForF(TimelineAnimationSpecialTimingFunctionF function);
+
+    /// Evaluates the single precision `function` for `n` progress values.
+    void TimelineAnimationSpecialTimingFunctionEvaluateBatchF(TimelineAnimationSpecialTimingFunctionF function,
+                                                              const float *in,
+                                                              float *out,
+                                                              size_t n);
+
+    // Linear interpolation (no easing)
+    void LinearInterpolationBatch(const double *in, double *out, size_t n);
+    void LinearInterpolationBatchF(const float *in, float *out, size_t n);
+
+    // Quadratic easing; p^2
+    void QuadraticEaseInBatch(const double *in, double *out, size_t n);
+    void QuadraticEaseInBatchF(const float *in, float *out, size_t n);
+    void QuadraticEaseOutBatch(const double *in, double *out, size_t n);
+    void QuadraticEaseOutBatchF(const float *in, float *out, size_t n);
+    void QuadraticEaseInOutBatch(const double *in, double *out, size_t n);
+    void QuadraticEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Cubic easing; p^3
+    void CubicEaseInBatch(const double *in, double *out, size_t n);
+    void CubicEaseInBatchF(const float *in, float *out, size_t n);
+    void CubicEaseOutBatch(const double *in, double *out, size_t n);
+    void CubicEaseOutBatchF(const float *in, float *out, size_t n);
+    void CubicEaseInOutBatch(const double *in, double *out, size_t n);
+    void CubicEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Quartic easing; p^4
+    void QuarticEaseInBatch(const double *in, double *out, size_t n);
+    void QuarticEaseInBatchF(const float *in, float *out, size_t n);
+    void QuarticEaseOutBatch(const double *in, double *out, size_t n);
+    void QuarticEaseOutBatchF(const float *in, float *out, size_t n);
+    void QuarticEaseInOutBatch(const double *in, double *out, size_t n);
+    void QuarticEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Quintic easing; p^5
+    void QuinticEaseInBatch(const double *in, double *out, size_t n);
+    void QuinticEaseInBatchF(const float *in, float *out, size_t n);
+    void QuinticEaseOutBatch(const double *in, double *out, size_t n);
+    void QuinticEaseOutBatchF(const float *in, float *out, size_t n);
+    void QuinticEaseInOutBatch(const double *in, double *out, size_t n);
+    void QuinticEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Sine wave easing; sin(p * PI/2)
+    void SineEaseInBatch(const double *in, double *out, size_t n);
+    void SineEaseInBatchF(const float *in, float *out, size_t n);
+    void SineEaseOutBatch(const double *in, double *out, size_t n);
+    void SineEaseOutBatchF(const float *in, float *out, size_t n);
+    void SineEaseInOutBatch(const double *in, double *out, size_t n);
+    void SineEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Circular easing; sqrt(1 - p^2)
+    void CircularEaseInBatch(const double *in, double *out, size_t n);
+    void CircularEaseInBatchF(const float *in, float *out, size_t n);
+    void CircularEaseOutBatch(const double *in, double *out, size_t n);
+    void CircularEaseOutBatchF(const float *in, float *out, size_t n);
+    void CircularEaseInOutBatch(const double *in, double *out, size_t n);
+    void CircularEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Exponential easing, base 2
+    void ExponentialEaseInBatch(const double *in, double *out, size_t n);
+    void ExponentialEaseInBatchF(const float *in, float *out, size_t n);
+    void ExponentialEaseOutBatch(const double *in, double *out, size_t n);
+    void ExponentialEaseOutBatchF(const float *in, float *out, size_t n);
+    void ExponentialEaseInOutBatch(const double *in, double *out, size_t n);
+    void ExponentialEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Overshooting cubic easing;
+    void BackEaseInBatch(const double *in, double *out, size_t n);
+    void BackEaseInBatchF(const float *in, float *out, size_t n);
+    void BackEaseOutBatch(const double *in, double *out, size_t n);
+    void BackEaseOutBatchF(const float *in, float *out, size_t n);
+    void BackEaseInOutBatch(const double *in, double *out, size_t n);
+    void BackEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Exponentially-damped sine wave easing
+    void ElasticEaseInBatch(const double *in, double *out, size_t n);
+    void ElasticEaseInBatchF(const float *in, float *out, size_t n);
+    void ElasticEaseOutBatch(const double *in, double *out, size_t n);
+    void ElasticEaseOutBatchF(const float *in, float *out, size_t n);
+    void ElasticEaseInOutBatch(const double *in, double *out, size_t n);
+    void ElasticEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    // Exponentially-decaying bounce easing
+    void BounceEaseInBatch(const double *in, double *out, size_t n);
+    void BounceEaseInBatchF(const float *in, float *out, size_t n);
+    void BounceEaseOutBatch(const double *in, double *out, size_t n);
+    void BounceEaseOutBatchF(const float *in, float *out, size_t n);
+    void BounceEaseInOutBatch(const double *in, double *out, size_t n);
+    void BounceEaseInOutBatchF(const float *in, float *out, size_t n);
+
+    void SlowMotionBatch(const double *in, double *out, size_t n);
+    void SlowMotionBatchF(const float *in, float *out, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,170 @@
+/*!
+ *  @file TimelineAnimationSpecialTimingFunctionFast.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "TimelineAnimationSpecialTimingFunctionFast.h"
+
+// Adding then subtracting 1.5 * 2^52 rounds to the nearest integer without
+// a call or a branch, for |x| < 2^51
+#define TA_ROUND_MAGIC 0x1.8p52
+
+// pi/2 split in two, so that x - k * pi/2 stays exact for the small k the
+// curves need
+#define TA_PI_2_HI 1.57079632673412561417e+00
+#define TA_PI_2_LO 6.07710050650619224932e-11
+#define TA_2_PI 0.63661977236758134308
+
+static inline double TimelineAnimationRound(double x)
+{
+    return (x + TA_ROUND_MAGIC) - TA_ROUND_MAGIC;
+}
+
+// sin(x + quadrant * pi/2). The argument is reduced to r in [-pi/4, pi/4],
+// where the Taylor polynomials of sin (degree 9) and cos (degree 10) are
+// within 2e-9 and 1.2e-10.
+static inline double TimelineAnimationFastSin(double x, int64_t quadrant)
+{
+    const double k = TimelineAnimationRound(x * TA_2_PI);
+    const double r = (x - k * TA_PI_2_HI) - k * TA_PI_2_LO;
+    const double r2 = r * r;
+
+    const double s = r + r * r2 * (-1.0 / 6.0 + r2 * (1.0 / 120.0 + r2 * (-1.0 / 5040.0 + r2 * (1.0 / 362880.0))));
+    const double c = 1.0 + r2 * (-1.0 / 2.0 + r2 * (1.0 / 24.0 + r2 * (-1.0 / 720.0 + r2 * (1.0 / 40320.0 + r2 * (-1.0 / 3628800.0)))));
+
+    const int64_t q = (int64_t)k + quadrant;
+    const double value = (q & 1) ? c : s;
+    return (q & 2) ? -value : value;
+}
+
+// 2^x. The argument is split in n + f, f in [-0.5, 0.5], 2^f comes from its
+// Taylor polynomial of degree 8, within 2e-10, and 2^n from the exponent bits.
+static inline double TimelineAnimationFastExp2(double x)
+{
+    x = (x < -1022.0) ? -1022.0 : x;
+    x = (x > 1023.0) ? 1023.0 : x;
+    const double n = TimelineAnimationRound(x);
+    const double f = (x - n) * M_LN2;
+
+    const double p = 1.0 + f * (1.0 + f * (1.0 / 2.0 + f * (1.0 / 6.0 + f * (1.0 / 24.0 + f * (1.0 / 120.0 + f * (1.0 / 720.0 + f * (1.0 / 5040.0 + f * (1.0 / 40320.0))))))));
+
+    const uint64_t bits = (uint64_t)((int64_t)n + 1023) << 52;
+    double scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+// MARK: - Sine
+
+double SineEaseInFast(double p)
+{
+    return TimelineAnimationFastSin((p - 1) * M_PI_2, 0) + 1;
+}
+
+double SineEaseOutFast(double p)
+{
+    return TimelineAnimationFastSin(p * M_PI_2, 0);
+}
+
+double SineEaseInOutFast(double p)
+{
+    // cos(x) is sin(x + pi/2)
+    return 0.5 * (1 - TimelineAnimationFastSin(p * M_PI, 1));
+}
+
+// MARK: - Exponential
+
+double ExponentialEaseInFast(double p)
+{
+    const double value = TimelineAnimationFastExp2(10 * (p - 1));
+    return (p == 0.0) ? p : value;
+}
+
+double ExponentialEaseOutFast(double p)
+{
+    const double value = 1 - TimelineAnimationFastExp2(-10 * p);
+    return (p == 1.0) ? p : value;
+}
+
+double ExponentialEaseInOutFast(double p)
+{
+    // both halves are 2^x, only the sign and the offset change
+    const int in = (p < 0.5);
+    const double exponent = in ? (20 * p) - 10 : (-20 * p) + 10;
+    const double half = 0.5 * TimelineAnimationFastExp2(exponent);
+    const double value = in ? half : 1 - half;
+    return (p == 0.0 || p == 1.0) ? p : value;
+}
+
+// MARK: - Elastic
+
+double ElasticEaseInFast(double p)
+{
+    return TimelineAnimationFastSin(13 * M_PI_2 * p, 0) * TimelineAnimationFastExp2(10 * (p - 1));
+}
+
+double ElasticEaseOutFast(double p)
+{
+    return TimelineAnimationFastSin(-13 * M_PI_2 * (p + 1), 0) * TimelineAnimationFastExp2(-10 * p) + 1;
+}
+
+double ElasticEaseInOutFast(double p)
+{
+    const int in = (p < 0.5);
+    const double q = 2 * p;
+    const double angle = in ? 13 * M_PI_2 * q : -13 * M_PI_2 * q;
+    const double exponent = in ? 10 * (q - 1) : -10 * (q - 1);
+    const double wave = TimelineAnimationFastSin(angle, 0) * TimelineAnimationFastExp2(exponent);
+    return in ? 0.5 * wave : 0.5 * (wave + 2);
+}
+
+// MARK: - Bounce
+
+// The four parabolas of BounceEaseOut, a * p^2 - b * p + c
+static const double TimelineAnimationBounceCoefficients[4][3] = {
+    { 121 / 16.0, 0, 0 },
+    { 363 / 40.0, 99 / 10.0, 17 / 5.0 },
+    { 4356 / 361.0, 35442 / 1805.0, 16061 / 1805.0 },
+    { 54 / 5.0, 513 / 25.0, 268 / 25.0 },
+};
+
+double BounceEaseOutFast(double p)
+{
+    const int segment = (p >= 4 / 11.0) + (p >= 8 / 11.0) + (p >= 9 / 10.0);
+    const double *const coefficients = TimelineAnimationBounceCoefficients[segment];
+    return (coefficients[0] * p - coefficients[1]) * p + coefficients[2];
+}
+
+double BounceEaseInFast(double p)
+{
+    return 1 - BounceEaseOutFast(1 - p);
+}
+
+double BounceEaseInOutFast(double p)
+{
+    // BounceEaseIn(2p) / 2 below one half, BounceEaseOut(2p - 1) / 2 + 1/2 above
+    const int in = (p < 0.5);
+    const double q = in ? 1 - 2 * p : 2 * p - 1;
+    const double value = BounceEaseOutFast(q);
+    return in ? 0.5 * (1 - value) : 0.5 * value + 0.5;
+}
+
+TimelineAnimationSpecialTimingFunction TimelineAnimationSpecialTimingFunctionFast(TimelineAnimationSpecialTimingFunction function)
+{
+#define TA_MATCH(name) if (function == name) { return name##Fast; }
+    TA_MATCH(SineEaseIn) TA_MATCH(SineEaseOut) TA_MATCH(SineEaseInOut)
+    TA_MATCH(ExponentialEaseIn) TA_MATCH(ExponentialEaseOut) TA_MATCH(ExponentialEaseInOut)
+    TA_MATCH(ElasticEaseIn) TA_MATCH(ElasticEaseOut) TA_MATCH(ElasticEaseInOut)
+    // BounceEaseIn and BounceEaseInOut measure no faster than the exact
+    // curves, whose branches predict well, so they keep those
+    TA_MATCH(BounceEaseOut)
+#undef TA_MATCH
+    return function;
+}
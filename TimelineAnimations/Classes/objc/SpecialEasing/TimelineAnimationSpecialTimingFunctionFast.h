@@ -0,0 +1,56 @@
+/*!
+ *  @file TimelineAnimationSpecialTimingFunctionFast.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_EASING_FAST_H
+#define TIMELINE_ANIMATIONS_EASING_FAST_H
+
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // Opt-in approximations of the slowest curves of
+    // TimelineAnimationSpecialTimingFunction.h. Instead of libm they use
+    // range-reduced polynomials of sin and exp2, and the Bounce curves pick
+    // their parabola from a table instead of branching on the progress.
+    //
+    // The maximum absolute error against the exact curves, measured over
+    // [0, 1] by Tools/TimelineAnimationFastMathBenchmark.c, is written next to
+    // each family.
+
+    // Sine wave easing; 1.8e-9
+    double SineEaseInFast(double p);
+    double SineEaseOutFast(double p);
+    double SineEaseInOutFast(double p);
+
+    // Exponential easing, base 2; 2e-10
+    double ExponentialEaseInFast(double p);
+    double ExponentialEaseOutFast(double p);
+    double ExponentialEaseInOutFast(double p);
+
+    // Exponentially-damped sine wave easing; 1.4e-9
+    double ElasticEaseInFast(double p);
+    double ElasticEaseOutFast(double p);
+    double ElasticEaseInOutFast(double p);
+
+    // Exponentially-decaying bounce easing; 3e-15, rounding only
+    double BounceEaseInFast(double p);
+    double BounceEaseOutFast(double p);
+    double BounceEaseInOutFast(double p);
+
+    // Returns the fast version of `function`, or `function` itself if it has
+    // none or if it is not faster, as for BounceEaseIn and BounceEaseInOut.
+    TimelineAnimationSpecialTimingFunction TimelineAnimationSpecialTimingFunctionFast(TimelineAnimationSpecialTimingFunction function);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
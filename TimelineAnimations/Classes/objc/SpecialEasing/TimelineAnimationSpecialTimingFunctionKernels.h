@@ -0,0 +1,360 @@
+/*!
+ *  @file TimelineAnimationSpecialTimingFunctionKernels.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+// Vector kernels of the special timing functions.
+//
+// This file has no include guard on purpose: it is included once per
+// instruction set and precision by TimelineAnimationSpecialTimingFunctionBatch.c,
+// after defining the following:
+//
+//  TA_S                the scalar type
+//  TA_V                the vector type
+//  TA_W                the number of lanes
+//  TA_TARGET           the function attributes of the instruction set
+//  TA_FN(name)         mangles `name` with the instruction set suffix
+//  TA_SCALAR(name)     the scalar function used for the remaining elements
+//  TA_SET1(x), TA_LOAD(p), TA_STORE(p, v)
+//  TA_ADD, TA_SUB, TA_MUL, TA_DIV, TA_SQRT
+//  TA_LT(a, b)         lane-wise a < b
+//  TA_SELECT(m, a, b)  lane-wise m ? a : b
+//  TA_EXP2I(n)         lane-wise 2^n, for integral n within the exponent range
+//
+// The kernels of the polynomial, Circular, Bounce and SlowMotion curves
+// repeat the arithmetic of their scalar counterparts in
+// TimelineAnimationSpecialTimingFunction.c operation by operation, so that
+// both paths agree, in double and in float. The Sine, Exponential, Back and
+// Elastic kernels replace sin and pow with the polynomials of
+// TimelineAnimationSpecialTimingFunctionFast.c, within the bounds of
+// TimelineAnimationSpecialTimingFunctionBatch.h.
+
+#define TA_KERNEL(name) static inline TA_TARGET TA_V TA_FN(name)(const TA_V p)
+
+// The float pi/2 split keeps 17 bits in the high part, so that k * TA_PI_2_HI
+// stays exact for the small k the curves need, as in double
+#define TA_DOUBLE (sizeof(TA_S) == sizeof(double))
+#define TA_ROUND_MAGIC (TA_DOUBLE ? 0x1.8p52 : 0x1.8p23)
+#define TA_PI_2_HI (TA_DOUBLE ? 1.57079632673412561417e+00 : 0x1.921fp0)
+#define TA_PI_2_LO (TA_DOUBLE ? 6.07710050650619224932e-11 : M_PI_2 - 0x1.921fp0)
+#define TA_EXP2_MIN (TA_DOUBLE ? -1022.0 : -126.0)
+#define TA_EXP2_MAX (TA_DOUBLE ? 1023.0 : 127.0)
+
+#define TA_KERNEL_LOOP(name) \
+static TA_TARGET void TA_FN(name##Batch)(const TA_S *in, TA_S *out, size_t n) \
+{ \
+    size_t i = 0; \
+    for (; i + TA_W <= n; i += TA_W) { \
+        TA_STORE(out + i, TA_FN(name)(TA_LOAD(in + i))); \
+    } \
+    for (; i < n; ++i) { \
+        out[i] = TA_SCALAR(name)(in[i]); \
+    } \
+}
+
+static inline TA_TARGET TA_V TA_FN(Round)(const TA_V x)
+{
+    return TA_SUB(TA_ADD(x, TA_SET1(TA_ROUND_MAGIC)), TA_SET1(TA_ROUND_MAGIC));
+}
+
+// sin(x + quadrant * pi/2), see TimelineAnimationFastSin. The quadrant is
+// taken modulo 4 in [-2, 2] without integer lanes: 0 is sin, +-1 cos, and
+// -1, +-2 flip the sign.
+static inline TA_TARGET TA_V TA_FN(Sin)(const TA_V x, const TA_S quadrant)
+{
+    const TA_V k = TA_FN(Round)(TA_MUL(x, TA_SET1(M_2_PI)));
+    const TA_V r = TA_SUB(TA_SUB(x, TA_MUL(k, TA_SET1(TA_PI_2_HI))), TA_MUL(k, TA_SET1(TA_PI_2_LO)));
+    const TA_V r2 = TA_MUL(r, r);
+
+    const TA_V sp = TA_ADD(TA_SET1(1.0 / 120.0), TA_MUL(r2, TA_ADD(TA_SET1(-1.0 / 5040.0), TA_MUL(r2, TA_SET1(1.0 / 362880.0)))));
+    const TA_V s = TA_ADD(r, TA_MUL(TA_MUL(r, r2), TA_ADD(TA_SET1(-1.0 / 6.0), TA_MUL(r2, sp))));
+    const TA_V cp = TA_ADD(TA_SET1(-1.0 / 720.0), TA_MUL(r2, TA_ADD(TA_SET1(1.0 / 40320.0), TA_MUL(r2, TA_SET1(-1.0 / 3628800.0)))));
+    const TA_V c = TA_ADD(TA_SET1(1), TA_MUL(r2, TA_ADD(TA_SET1(-1.0 / 2.0), TA_MUL(r2, TA_ADD(TA_SET1(1.0 / 24.0), TA_MUL(r2, cp))))));
+
+    const TA_V q = TA_ADD(k, TA_SET1(quadrant));
+    const TA_V j = TA_SUB(q, TA_MUL(TA_SET1(4), TA_FN(Round)(TA_MUL(q, TA_SET1(0.25)))));
+    const TA_V j2 = TA_MUL(j, j);
+    const TA_V value = TA_SELECT(TA_LT(j2, TA_SET1(0.5)), s, TA_SELECT(TA_LT(j2, TA_SET1(2.5)), c, s));
+    const TA_V sign = TA_SELECT(TA_LT(j, TA_SET1(-0.5)), TA_SET1(-1), TA_SELECT(TA_LT(TA_SET1(1.5), j), TA_SET1(-1), TA_SET1(1)));
+    return TA_MUL(value, sign);
+}
+
+// 2^x, see TimelineAnimationFastExp2
+static inline TA_TARGET TA_V TA_FN(Exp2)(TA_V x)
+{
+    x = TA_SELECT(TA_LT(x, TA_SET1(TA_EXP2_MIN)), TA_SET1(TA_EXP2_MIN), x);
+    x = TA_SELECT(TA_LT(TA_SET1(TA_EXP2_MAX), x), TA_SET1(TA_EXP2_MAX), x);
+    const TA_V n = TA_FN(Round)(x);
+    const TA_V f = TA_MUL(TA_SUB(x, n), TA_SET1(M_LN2));
+
+    const TA_V high = TA_ADD(TA_SET1(1.0 / 120.0), TA_MUL(f, TA_ADD(TA_SET1(1.0 / 720.0), TA_MUL(f, TA_ADD(TA_SET1(1.0 / 5040.0), TA_MUL(f, TA_SET1(1.0 / 40320.0)))))));
+    const TA_V p = TA_ADD(TA_SET1(1), TA_MUL(f, TA_ADD(TA_SET1(1), TA_MUL(f, TA_ADD(TA_SET1(1.0 / 2.0), TA_MUL(f, TA_ADD(TA_SET1(1.0 / 6.0), TA_MUL(f, TA_ADD(TA_SET1(1.0 / 24.0), TA_MUL(f, high))))))))));
+    return TA_MUL(p, TA_EXP2I(n));
+}
+
+// p == value ? p : otherwise, with the comparisons the kernels have
+static inline TA_TARGET TA_V TA_FN(Pin)(const TA_V p, const TA_S value, const TA_V otherwise)
+{
+    return TA_SELECT(TA_LT(p, TA_SET1(value)), otherwise, TA_SELECT(TA_LT(TA_SET1(value), p), otherwise, p));
+}
+
+TA_KERNEL(LinearInterpolation)
+{
+    return p;
+}
+
+TA_KERNEL(QuadraticEaseIn)
+{
+    return TA_MUL(p, p);
+}
+
+TA_KERNEL(QuadraticEaseOut)
+{
+    return TA_SUB(TA_SET1(0), TA_MUL(p, TA_SUB(p, TA_SET1(2))));
+}
+
+TA_KERNEL(QuadraticEaseInOut)
+{
+    const TA_V in = TA_MUL(TA_MUL(TA_SET1(2), p), p);
+    const TA_V out = TA_SUB(TA_ADD(TA_MUL(TA_MUL(TA_SET1(-2), p), p), TA_MUL(TA_SET1(4), p)), TA_SET1(1));
+    return TA_SELECT(TA_LT(p, TA_SET1(0.5)), in, out);
+}
+
+TA_KERNEL(CubicEaseIn)
+{
+    return TA_MUL(TA_MUL(p, p), p);
+}
+
+TA_KERNEL(CubicEaseOut)
+{
+    const TA_V f = TA_SUB(p, TA_SET1(1));
+    return TA_ADD(TA_MUL(TA_MUL(f, f), f), TA_SET1(1));
+}
+
+TA_KERNEL(CubicEaseInOut)
+{
+    const TA_V in = TA_MUL(TA_MUL(TA_MUL(TA_SET1(4), p), p), p);
+    const TA_V f = TA_SUB(TA_MUL(TA_SET1(2), p), TA_SET1(2));
+    const TA_V out = TA_ADD(TA_MUL(TA_MUL(TA_MUL(TA_SET1(0.5), f), f), f), TA_SET1(1));
+    return TA_SELECT(TA_LT(p, TA_SET1(0.5)), in, out);
+}
+
+TA_KERNEL(QuarticEaseIn)
+{
+    return TA_MUL(TA_MUL(TA_MUL(p, p), p), p);
+}
+
+TA_KERNEL(QuarticEaseOut)
+{
+    const TA_V f = TA_SUB(p, TA_SET1(1));
+    return TA_ADD(TA_MUL(TA_MUL(TA_MUL(f, f), f), TA_SUB(TA_SET1(1), p)), TA_SET1(1));
+}
+
+TA_KERNEL(QuarticEaseInOut)
+{
+    const TA_V in = TA_MUL(TA_MUL(TA_MUL(TA_MUL(TA_SET1(8), p), p), p), p);
+    const TA_V f = TA_SUB(p, TA_SET1(1));
+    const TA_V out = TA_ADD(TA_MUL(TA_MUL(TA_MUL(TA_MUL(TA_SET1(-8), f), f), f), f), TA_SET1(1));
+    return TA_SELECT(TA_LT(p, TA_SET1(0.5)), in, out);
+}
+
+TA_KERNEL(QuinticEaseIn)
+{
+    return TA_MUL(TA_MUL(TA_MUL(TA_MUL(p, p), p), p), p);
+}
+
+TA_KERNEL(QuinticEaseOut)
+{
+    const TA_V f = TA_SUB(p, TA_SET1(1));
+    return TA_ADD(TA_MUL(TA_MUL(TA_MUL(TA_MUL(f, f), f), f), f), TA_SET1(1));
+}
+
+TA_KERNEL(QuinticEaseInOut)
+{
+    const TA_V in = TA_MUL(TA_MUL(TA_MUL(TA_MUL(TA_MUL(TA_SET1(16), p), p), p), p), p);
+    const TA_V f = TA_SUB(TA_MUL(TA_SET1(2), p), TA_SET1(2));
+    const TA_V out = TA_ADD(TA_MUL(TA_MUL(TA_MUL(TA_MUL(TA_MUL(TA_SET1(0.5), f), f), f), f), f), TA_SET1(1));
+    return TA_SELECT(TA_LT(p, TA_SET1(0.5)), in, out);
+}
+
+TA_KERNEL(SineEaseIn)
+{
+    return TA_ADD(TA_FN(Sin)(TA_MUL(TA_SUB(p, TA_SET1(1)), TA_SET1(M_PI_2)), 0), TA_SET1(1));
+}
+
+TA_KERNEL(SineEaseOut)
+{
+    return TA_FN(Sin)(TA_MUL(p, TA_SET1(M_PI_2)), 0);
+}
+
+TA_KERNEL(SineEaseInOut)
+{
+    // cos(x) is sin(x + pi/2)
+    return TA_MUL(TA_SET1(0.5), TA_SUB(TA_SET1(1), TA_FN(Sin)(TA_MUL(p, TA_SET1(M_PI)), 1)));
+}
+
+TA_KERNEL(CircularEaseIn)
+{
+    return TA_SUB(TA_SET1(1), TA_SQRT(TA_SUB(TA_SET1(1), TA_MUL(p, p))));
+}
+
+TA_KERNEL(CircularEaseOut)
+{
+    return TA_SQRT(TA_MUL(TA_SUB(TA_SET1(2), p), p));
+}
+
+TA_KERNEL(CircularEaseInOut)
+{
+    // the unused branch takes the square root of a negative number, the
+    // resulting NaN lanes are discarded by the select
+    const TA_V in = TA_MUL(TA_SET1(0.5), TA_SUB(TA_SET1(1), TA_SQRT(TA_SUB(TA_SET1(1), TA_MUL(TA_SET1(4), TA_MUL(p, p))))));
+    const TA_V p2 = TA_MUL(TA_SET1(2), p);
+    const TA_V radicand = TA_MUL(TA_SUB(TA_SET1(0), TA_SUB(p2, TA_SET1(3))), TA_SUB(p2, TA_SET1(1)));
+    const TA_V out = TA_MUL(TA_SET1(0.5), TA_ADD(TA_SQRT(radicand), TA_SET1(1)));
+    return TA_SELECT(TA_LT(p, TA_SET1(0.5)), in, out);
+}
+
+TA_KERNEL(ExponentialEaseIn)
+{
+    return TA_FN(Pin)(p, 0, TA_FN(Exp2)(TA_MUL(TA_SET1(10), TA_SUB(p, TA_SET1(1)))));
+}
+
+TA_KERNEL(ExponentialEaseOut)
+{
+    return TA_FN(Pin)(p, 1, TA_SUB(TA_SET1(1), TA_FN(Exp2)(TA_MUL(TA_SET1(-10), p))));
+}
+
+TA_KERNEL(ExponentialEaseInOut)
+{
+    // both halves are 2^x, only the sign and the offset change
+    const TA_V in = TA_LT(p, TA_SET1(0.5));
+    const TA_V exponent = TA_SELECT(in, TA_SUB(TA_MUL(TA_SET1(20), p), TA_SET1(10)), TA_ADD(TA_MUL(TA_SET1(-20), p), TA_SET1(10)));
+    const TA_V half = TA_MUL(TA_SET1(0.5), TA_FN(Exp2)(exponent));
+    const TA_V value = TA_SELECT(in, half, TA_SUB(TA_SET1(1), half));
+    return TA_FN(Pin)(p, 0, TA_FN(Pin)(p, 1, value));
+}
+
+TA_KERNEL(BackEaseIn)
+{
+    return TA_SUB(TA_MUL(TA_MUL(p, p), p), TA_MUL(p, TA_FN(Sin)(TA_MUL(p, TA_SET1(M_PI)), 0)));
+}
+
+TA_KERNEL(BackEaseOut)
+{
+    const TA_V f = TA_SUB(TA_SET1(1), p);
+    return TA_SUB(TA_SET1(1), TA_FN(BackEaseIn)(f));
+}
+
+TA_KERNEL(BackEaseInOut)
+{
+    const TA_V in = TA_LT(p, TA_SET1(0.5));
+    const TA_V f = TA_SELECT(in, TA_MUL(TA_SET1(2), p), TA_SUB(TA_SET1(1), TA_SUB(TA_MUL(TA_SET1(2), p), TA_SET1(1))));
+    const TA_V g = TA_FN(BackEaseIn)(f);
+    return TA_SELECT(in, TA_MUL(TA_SET1(0.5), g), TA_ADD(TA_MUL(TA_SET1(0.5), TA_SUB(TA_SET1(1), g)), TA_SET1(0.5)));
+}
+
+TA_KERNEL(ElasticEaseIn)
+{
+    return TA_MUL(TA_FN(Sin)(TA_MUL(TA_SET1(13 * M_PI_2), p), 0), TA_FN(Exp2)(TA_MUL(TA_SET1(10), TA_SUB(p, TA_SET1(1)))));
+}
+
+TA_KERNEL(ElasticEaseOut)
+{
+    const TA_V wave = TA_FN(Sin)(TA_MUL(TA_SET1(-13 * M_PI_2), TA_ADD(p, TA_SET1(1))), 0);
+    return TA_ADD(TA_MUL(wave, TA_FN(Exp2)(TA_MUL(TA_SET1(-10), p))), TA_SET1(1));
+}
+
+TA_KERNEL(ElasticEaseInOut)
+{
+    const TA_V in = TA_LT(p, TA_SET1(0.5));
+    const TA_V q = TA_MUL(TA_SET1(2), p);
+    const TA_V angle = TA_SELECT(in, TA_MUL(TA_SET1(13 * M_PI_2), q), TA_MUL(TA_SET1(-13 * M_PI_2), q));
+    const TA_V exponent = TA_MUL(TA_SELECT(in, TA_SET1(10), TA_SET1(-10)), TA_SUB(q, TA_SET1(1)));
+    const TA_V wave = TA_MUL(TA_FN(Sin)(angle, 0), TA_FN(Exp2)(exponent));
+    return TA_SELECT(in, TA_MUL(TA_SET1(0.5), wave), TA_MUL(TA_SET1(0.5), TA_ADD(wave, TA_SET1(2))));
+}
+
+TA_KERNEL(BounceEaseOut)
+{
+    const TA_V a = TA_DIV(TA_MUL(TA_MUL(TA_SET1(121), p), p), TA_SET1(16.0));
+    const TA_V b = TA_ADD(TA_SUB(TA_MUL(TA_MUL(TA_SET1(363/40.0), p), p), TA_MUL(TA_SET1(99/10.0), p)), TA_SET1(17/5.0));
+    const TA_V c = TA_ADD(TA_SUB(TA_MUL(TA_MUL(TA_SET1(4356/361.0), p), p), TA_MUL(TA_SET1(35442/1805.0), p)), TA_SET1(16061/1805.0));
+    const TA_V d = TA_ADD(TA_SUB(TA_MUL(TA_MUL(TA_SET1(54/5.0), p), p), TA_MUL(TA_SET1(513/25.0), p)), TA_SET1(268/25.0));
+    const TA_V cd = TA_SELECT(TA_LT(p, TA_SET1(9/10.0)), c, d);
+    const TA_V bcd = TA_SELECT(TA_LT(p, TA_SET1(8/11.0)), b, cd);
+    return TA_SELECT(TA_LT(p, TA_SET1(4/11.0)), a, bcd);
+}
+
+TA_KERNEL(BounceEaseIn)
+{
+    return TA_SUB(TA_SET1(1), TA_FN(BounceEaseOut)(TA_SUB(TA_SET1(1), p)));
+}
+
+TA_KERNEL(BounceEaseInOut)
+{
+    const TA_V in = TA_MUL(TA_SET1(0.5), TA_FN(BounceEaseIn)(TA_MUL(p, TA_SET1(2))));
+    const TA_V out = TA_ADD(TA_MUL(TA_SET1(0.5), TA_FN(BounceEaseOut)(TA_SUB(TA_MUL(p, TA_SET1(2)), TA_SET1(1)))), TA_SET1(0.5));
+    return TA_SELECT(TA_LT(p, TA_SET1(0.5)), in, out);
+}
+
+TA_KERNEL(SlowMotion)
+{
+    const TA_V p1 = TA_SET1(0.25);
+    const TA_V p3 = TA_ADD(p1, TA_SET1(0.7));
+
+    const TA_V r = TA_ADD(p, TA_MUL(TA_SUB(TA_SET1(0.5), p), p));
+
+    const TA_V e = TA_SUB(TA_SET1(1), TA_DIV(p, p1));
+    const TA_V begin = TA_SUB(r, TA_MUL(TA_MUL(TA_MUL(TA_MUL(e, e), e), e), r));
+
+    const TA_V e1 = TA_DIV(TA_SUB(p, p3), p1);
+    const TA_V end = TA_ADD(r, TA_MUL(TA_SUB(p, r), TA_MUL(TA_MUL(TA_MUL(e1, e1), e1), e1)));
+
+    return TA_SELECT(TA_LT(p, p1), begin, TA_SELECT(TA_LT(p3, p), end, r));
+}
+
+TA_KERNEL_LOOP(LinearInterpolation)
+TA_KERNEL_LOOP(QuadraticEaseIn)
+TA_KERNEL_LOOP(QuadraticEaseOut)
+TA_KERNEL_LOOP(QuadraticEaseInOut)
+TA_KERNEL_LOOP(CubicEaseIn)
+TA_KERNEL_LOOP(CubicEaseOut)
+TA_KERNEL_LOOP(CubicEaseInOut)
+TA_KERNEL_LOOP(QuarticEaseIn)
+TA_KERNEL_LOOP(QuarticEaseOut)
+TA_KERNEL_LOOP(QuarticEaseInOut)
+TA_KERNEL_LOOP(QuinticEaseIn)
+TA_KERNEL_LOOP(QuinticEaseOut)
+TA_KERNEL_LOOP(QuinticEaseInOut)
+TA_KERNEL_LOOP(SineEaseIn)
+TA_KERNEL_LOOP(SineEaseOut)
+TA_KERNEL_LOOP(SineEaseInOut)
+TA_KERNEL_LOOP(CircularEaseIn)
+TA_KERNEL_LOOP(CircularEaseOut)
+TA_KERNEL_LOOP(CircularEaseInOut)
+TA_KERNEL_LOOP(ExponentialEaseIn)
+TA_KERNEL_LOOP(ExponentialEaseOut)
+TA_KERNEL_LOOP(ExponentialEaseInOut)
+TA_KERNEL_LOOP(BackEaseIn)
+TA_KERNEL_LOOP(BackEaseOut)
+TA_KERNEL_LOOP(BackEaseInOut)
+TA_KERNEL_LOOP(ElasticEaseIn)
+TA_KERNEL_LOOP(ElasticEaseOut)
+TA_KERNEL_LOOP(ElasticEaseInOut)
+TA_KERNEL_LOOP(BounceEaseIn)
+TA_KERNEL_LOOP(BounceEaseOut)
+TA_KERNEL_LOOP(BounceEaseInOut)
+TA_KERNEL_LOOP(SlowMotion)
+
+#undef TA_KERNEL_LOOP
+#undef TA_KERNEL
+#undef TA_DOUBLE
+#undef TA_ROUND_MAGIC
+#undef TA_PI_2_HI
+#undef TA_PI_2_LO
+#undef TA_EXP2_MIN
+#undef TA_EXP2_MAX
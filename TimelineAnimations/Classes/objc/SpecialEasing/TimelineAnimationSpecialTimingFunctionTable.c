@@ -0,0 +1,212 @@
+/*!
+ *  @file TimelineAnimationSpecialTimingFunctionTable.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "TimelineAnimationSpecialTimingFunctionTable.h"
+
+// Tables larger than this are slower than calling the function
+#define TA_TABLE_MAX_RESOLUTION ((size_t)1 << 20)
+
+// The number of points per interval at which the error is measured
+#define TA_TABLE_ERROR_SAMPLES 32
+
+// An interval is interpolated only if the measured error stays under this
+// fraction of the maximum error, which covers the error between the samples
+#define TA_TABLE_ERROR_MARGIN 0.75
+
+struct TimelineAnimationTable {
+    TimelineAnimationSpecialTimingFunction function;
+    size_t resolution;
+    TimelineAnimationTableInterpolation interpolation;
+    double maximumError;
+    double measuredError;
+    size_t exactIntervalCount;
+    // one bit per interval, set when the interval evaluates the function
+    uint8_t *exact;
+    // resolution + 3 entries; values[i + 1] is the function at i / resolution
+    // and the first and last entries extend the curve for the cubic
+    double *values;
+    struct TimelineAnimationTable *next;
+};
+
+static pthread_mutex_t TimelineAnimationTablesLock = PTHREAD_MUTEX_INITIALIZER;
+static TimelineAnimationTable *TimelineAnimationTables = NULL;
+
+static inline double TimelineAnimationTableInterpolate(const TimelineAnimationTable *table, size_t i, double u)
+{
+    const double *const v = table->values + 1;
+    switch (table->interpolation) {
+        case TimelineAnimationTableInterpolationCubic: {
+            const double p0 = v[(ptrdiff_t)i - 1];
+            const double p1 = v[i];
+            const double p2 = v[i + 1];
+            const double p3 = v[i + 2];
+            const double a = -0.5 * p0 + 1.5 * p1 - 1.5 * p2 + 0.5 * p3;
+            const double b = p0 - 2.5 * p1 + 2.0 * p2 - 0.5 * p3;
+            const double c = -0.5 * p0 + 0.5 * p2;
+            return ((a * u + b) * u + c) * u + p1;
+        }
+        case TimelineAnimationTableInterpolationLinear:
+        default:
+            return v[i] + (v[i + 1] - v[i]) * u;
+    }
+}
+
+static inline int TimelineAnimationTableIsExact(const TimelineAnimationTable *table, size_t i)
+{
+    return (table->exact[i >> 3] >> (i & 7)) & 1;
+}
+
+double TimelineAnimationTableEvaluate(const TimelineAnimationTable *table, double p)
+{
+    // also catches NaN
+    if (!(p > 0.0 && p < 1.0)) {
+        return table->function(p);
+    }
+    const double x = p * (double)table->resolution;
+    size_t i = (size_t)x;
+    if (i >= table->resolution) {
+        i = table->resolution - 1;
+    }
+    if (TimelineAnimationTableIsExact(table, i)) {
+        return table->function(p);
+    }
+    return TimelineAnimationTableInterpolate(table, i, x - (double)i);
+}
+
+void TimelineAnimationTableEvaluateBatch(const TimelineAnimationTable *table,
+                                         const double *in,
+                                         double *out,
+                                         size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = TimelineAnimationTableEvaluate(table, in[i]);
+    }
+}
+
+TimelineAnimationSpecialTimingFunction TimelineAnimationTableFunction(const TimelineAnimationTable *table)
+{
+    return table->function;
+}
+
+size_t TimelineAnimationTableResolution(const TimelineAnimationTable *table)
+{
+    return table->resolution;
+}
+
+double TimelineAnimationTableMeasuredError(const TimelineAnimationTable *table)
+{
+    return table->measuredError;
+}
+
+size_t TimelineAnimationTableExactIntervalCount(const TimelineAnimationTable *table)
+{
+    return table->exactIntervalCount;
+}
+
+// MARK: - Building
+
+static void TimelineAnimationTableDestroy(TimelineAnimationTable *table)
+{
+    free(table->values);
+    free(table->exact);
+    free(table);
+}
+
+static TimelineAnimationTable *TimelineAnimationTableCreate(TimelineAnimationSpecialTimingFunction function,
+                                                            size_t resolution,
+                                                            TimelineAnimationTableInterpolation interpolation,
+                                                            double maximumError)
+{
+    TimelineAnimationTable *const table = (TimelineAnimationTable *)calloc(1, sizeof(TimelineAnimationTable));
+    if (table == NULL) {
+        return NULL;
+    }
+    table->function = function;
+    table->resolution = resolution;
+    table->interpolation = interpolation;
+    table->maximumError = maximumError;
+    table->values = (double *)malloc(sizeof(double) * (resolution + 3));
+    table->exact = (uint8_t *)calloc((resolution + 7) / 8, sizeof(uint8_t));
+    if (table->values == NULL || table->exact == NULL) {
+        TimelineAnimationTableDestroy(table);
+        return NULL;
+    }
+
+    // The ends are sampled just inside [0, 1]: some curves special-case
+    // exactly 0 or 1 (ExponentialEaseIn jumps from 2^-10 to 0), and
+    // TimelineAnimationTableEvaluate answers the ends with the exact function.
+    double *const v = table->values + 1;
+    v[0] = function(nextafter(0.0, 1.0));
+    for (size_t i = 1; i < resolution; ++i) {
+        v[i] = function((double)i / (double)resolution);
+    }
+    v[resolution] = function(nextafter(1.0, 0.0));
+    v[-1] = 2.0 * v[0] - v[1];
+    v[resolution + 1] = 2.0 * v[resolution] - v[resolution - 1];
+
+    const double tolerance = maximumError * TA_TABLE_ERROR_MARGIN;
+    for (size_t i = 0; i < resolution; ++i) {
+        double error = 0.0;
+        for (size_t s = 1; s < TA_TABLE_ERROR_SAMPLES; ++s) {
+            const double u = (double)s / TA_TABLE_ERROR_SAMPLES;
+            const double p = ((double)i + u) / (double)resolution;
+            const double e = fabs(TimelineAnimationTableInterpolate(table, i, u) - function(p));
+            // NaN must mark the interval as exact as well
+            if (!(e <= error)) {
+                error = e;
+            }
+        }
+        if (!(error <= tolerance)) {
+            table->exact[i >> 3] |= (uint8_t)(1u << (i & 7));
+            table->exactIntervalCount += 1;
+        }
+        else if (error > table->measuredError) {
+            table->measuredError = error;
+        }
+    }
+    return table;
+}
+
+const TimelineAnimationTable *TimelineAnimationTableFor(TimelineAnimationSpecialTimingFunction function,
+                                                        size_t resolution,
+                                                        TimelineAnimationTableInterpolation interpolation,
+                                                        double maximumError)
+{
+    if (function == NULL ||
+        resolution < 2 ||
+        resolution > TA_TABLE_MAX_RESOLUTION ||
+        !(maximumError > 0.0)) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&TimelineAnimationTablesLock);
+    TimelineAnimationTable *table = TimelineAnimationTables;
+    while (table != NULL) {
+        if (table->function == function &&
+            table->resolution == resolution &&
+            table->interpolation == interpolation &&
+            table->maximumError == maximumError) {
+            break;
+        }
+        table = table->next;
+    }
+    if (table == NULL) {
+        table = TimelineAnimationTableCreate(function, resolution, interpolation, maximumError);
+        if (table != NULL) {
+            table->next = TimelineAnimationTables;
+            TimelineAnimationTables = table;
+        }
+    }
+    pthread_mutex_unlock(&TimelineAnimationTablesLock);
+    return table;
+}
@@ -0,0 +1,77 @@
+/*!
+ *  @file TimelineAnimationSpecialTimingFunctionTable.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_EASING_TABLE_H
+#define TIMELINE_ANIMATIONS_EASING_TABLE_H
+
+#include <stddef.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    /// How a table interpolates between two of its entries.
+    typedef enum {
+        TimelineAnimationTableInterpolationLinear = 0,
+        /// Catmull-Rom spline through the neighbouring entries.
+        TimelineAnimationTableInterpolationCubic
+    } TimelineAnimationTableInterpolation;
+
+    /// A sampled version of a timing function. Tables are immutable and
+    /// can be used from any thread.
+    typedef struct TimelineAnimationTable TimelineAnimationTable;
+
+    /// Returns the table of `function` with `resolution` intervals over
+    /// [0, 1]. Whatever the resolution, the difference between the table and
+    /// `function` is kept under `maximumError`: intervals where the
+    /// interpolation is not accurate enough evaluate `function` directly.
+    ///
+    /// Tables are built on first use and shared by all the callers asking for
+    /// the same function, resolution, interpolation and error. They live
+    /// until the process exits.
+    ///
+    /// Meant for the curves that call sin, pow or sqrt, that is the Sine,
+    /// Circular, Exponential and Elastic families, but any function works.
+    /// Returns NULL if the arguments are invalid or memory runs out.
+    const TimelineAnimationTable *TimelineAnimationTableFor(TimelineAnimationSpecialTimingFunction function,
+                                                            size_t resolution,
+                                                            TimelineAnimationTableInterpolation interpolation,
+                                                            double maximumError);
+
+    /// Evaluates the table at `p`. Values at or outside [0, 1] come from the
+    /// exact function.
+    double TimelineAnimationTableEvaluate(const TimelineAnimationTable *table, double p);
+
+    /// Evaluates the table for `n` progress values. `in` and `out` may be the
+    /// same buffer.
+    void TimelineAnimationTableEvaluateBatch(const TimelineAnimationTable *table,
+                                             const double *in,
+                                             double *out,
+                                             size_t n);
+
+    /// The function the table was built from.
+    TimelineAnimationSpecialTimingFunction TimelineAnimationTableFunction(const TimelineAnimationTable *table);
+
+    /// The number of intervals of the table.
+    size_t TimelineAnimationTableResolution(const TimelineAnimationTable *table);
+
+    /// The largest error measured over the interpolated intervals while the
+    /// table was built, never above the requested maximum error.
+    double TimelineAnimationTableMeasuredError(const TimelineAnimationTable *table);
+
+    /// The number of intervals that evaluate the exact function because
+    /// interpolating them would exceed the maximum error.
+    size_t TimelineAnimationTableExactIntervalCount(const TimelineAnimationTable *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,305 @@
+/*!
+ *  @file TimelineAnimationSpring.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include "TimelineAnimationSpring.h"
+
+// How far from 1 the damping ratio can be for the spring to be taken as
+// critically damped. The underdamped and overdamped solutions divide by the
+// distance to the critical damping.
+#define TA_SPRING_CRITICAL_EPSILON 1e-8
+
+// The keyframes are stepped by recurrence, and recomputed exactly every so
+// many keyframes so that the rounding errors do not add up.
+#define TA_SPRING_RESEED_INTERVAL 64
+
+int TimelineAnimationSpringInit(TimelineAnimationSpring *spring,
+                                double mass,
+                                double stiffness,
+                                double damping,
+                                double initialVelocity)
+{
+    if (!(mass > 0.0) || !(stiffness > 0.0) || !(damping >= 0.0) || !isfinite(initialVelocity)) {
+        return 0;
+    }
+    const double omega = sqrt(stiffness / mass);
+    const double zeta = damping / (2.0 * sqrt(mass * stiffness));
+    // x(0) = -1, x'(0) = initialVelocity
+    const double x0 = -1.0;
+    const double v0 = initialVelocity;
+
+    spring->naturalFrequency = omega;
+    spring->dampingRatio = zeta;
+
+    if (fabs(zeta - 1.0) <= TA_SPRING_CRITICAL_EPSILON) {
+        // x(t) = (a + b t) e^(-omega t)
+        spring->regime = TimelineAnimationSpringCriticallyDamped;
+        spring->decay = omega;
+        spring->frequency = 0.0;
+        spring->a = x0;
+        spring->b = v0 + omega * x0;
+    }
+    else if (zeta < 1.0) {
+        // x(t) = e^(-decay t) (a cos(frequency t) + b sin(frequency t))
+        spring->regime = TimelineAnimationSpringUnderdamped;
+        spring->decay = zeta * omega;
+        spring->frequency = omega * sqrt(1.0 - zeta * zeta);
+        spring->a = x0;
+        spring->b = (v0 + spring->decay * x0) / spring->frequency;
+    }
+    else {
+        // x(t) = a e^(-decay t) + b e^(-frequency t), decay the slower rate.
+        // The slower rate is written so that it does not cancel out for
+        // heavily damped springs.
+        spring->regime = TimelineAnimationSpringOverdamped;
+        const double root = sqrt(zeta * zeta - 1.0);
+        spring->decay = omega / (zeta + root);
+        spring->frequency = omega * (zeta + root);
+        spring->b = (v0 + spring->decay * x0) / (spring->decay - spring->frequency);
+        spring->a = x0 - spring->b;
+    }
+    return 1;
+}
+
+// MARK: - Evaluation
+
+// progress - 1
+static inline double TimelineAnimationSpringDisplacement(const TimelineAnimationSpring *spring, double t)
+{
+    switch (spring->regime) {
+        case TimelineAnimationSpringUnderdamped:
+            return exp(-spring->decay * t) * (spring->a * cos(spring->frequency * t) + spring->b * sin(spring->frequency * t));
+        case TimelineAnimationSpringCriticallyDamped:
+            return (spring->a + spring->b * t) * exp(-spring->decay * t);
+        default:
+            return spring->a * exp(-spring->decay * t) + spring->b * exp(-spring->frequency * t);
+    }
+}
+
+double TimelineAnimationSpringEvaluate(const TimelineAnimationSpring *spring, double time)
+{
+    return 1.0 + TimelineAnimationSpringDisplacement(spring, time);
+}
+
+void TimelineAnimationSpringEvaluateBatch(const TimelineAnimationSpring *spring,
+                                          const double *times,
+                                          double *progress,
+                                          size_t n)
+{
+    // the regime is chosen once for the whole batch, not once per time
+    const double decay = spring->decay;
+    const double frequency = spring->frequency;
+    const double a = spring->a;
+    const double b = spring->b;
+    switch (spring->regime) {
+        case TimelineAnimationSpringUnderdamped:
+            for (size_t i = 0; i < n; ++i) {
+                const double t = times[i];
+                progress[i] = 1.0 + exp(-decay * t) * (a * cos(frequency * t) + b * sin(frequency * t));
+            }
+            break;
+        case TimelineAnimationSpringCriticallyDamped:
+            for (size_t i = 0; i < n; ++i) {
+                const double t = times[i];
+                progress[i] = 1.0 + (a + b * t) * exp(-decay * t);
+            }
+            break;
+        default:
+            for (size_t i = 0; i < n; ++i) {
+                const double t = times[i];
+                progress[i] = 1.0 + a * exp(-decay * t) + b * exp(-frequency * t);
+            }
+            break;
+    }
+}
+
+void TimelineAnimationSpringKeyframeProgress(const TimelineAnimationSpring *spring,
+                                             double duration,
+                                             size_t keyframeCount,
+                                             double *progress)
+{
+    // At evenly spaced times the exponentials are a geometric progression
+    // and cos/sin a rotation, so only the reseeded keyframes call into libm.
+    const double dt = duration / (double)(keyframeCount - 1);
+    const double decay = spring->decay;
+    const double frequency = spring->frequency;
+    const double a = spring->a;
+    const double b = spring->b;
+    const double stepDecay = exp(-decay * dt);
+    const double stepFast = exp(-frequency * dt);
+    const double stepCos = cos(frequency * dt);
+    const double stepSin = sin(frequency * dt);
+
+    for (size_t start = 0; start < keyframeCount; start += TA_SPRING_RESEED_INTERVAL) {
+        size_t end = start + TA_SPRING_RESEED_INTERVAL;
+        end = (end > keyframeCount) ? keyframeCount : end;
+        const double t0 = (double)start * dt;
+
+        switch (spring->regime) {
+            case TimelineAnimationSpringUnderdamped: {
+                double envelope = exp(-decay * t0);
+                double c = cos(frequency * t0);
+                double s = sin(frequency * t0);
+                for (size_t frame = start; frame < end; ++frame) {
+                    progress[frame] = 1.0 + envelope * (a * c + b * s);
+                    const double nextC = c * stepCos - s * stepSin;
+                    s = s * stepCos + c * stepSin;
+                    c = nextC;
+                    envelope *= stepDecay;
+                }
+                break;
+            }
+            case TimelineAnimationSpringCriticallyDamped: {
+                double envelope = exp(-decay * t0);
+                for (size_t frame = start; frame < end; ++frame) {
+                    progress[frame] = 1.0 + (a + b * ((double)frame * dt)) * envelope;
+                    envelope *= stepDecay;
+                }
+                break;
+            }
+            default: {
+                double slow = exp(-decay * t0);
+                double fast = exp(-frequency * t0);
+                for (size_t frame = start; frame < end; ++frame) {
+                    progress[frame] = 1.0 + a * slow + b * fast;
+                    slow *= stepDecay;
+                    fast *= stepFast;
+                }
+                break;
+            }
+        }
+    }
+}
+
+// MARK: - Settling time
+
+// The time in [settled, unsettled] where |x| falls to `tolerance`, |x| being
+// monotonic over the interval.
+static double TimelineAnimationSpringSettle(const TimelineAnimationSpring *spring,
+                                            double unsettled,
+                                            double settled,
+                                            double tolerance)
+{
+    for (int iteration = 0; iteration < 128; ++iteration) {
+        const double middle = 0.5 * (unsettled + settled);
+        if (middle <= unsettled || middle >= settled) {
+            break;
+        }
+        if (fabs(TimelineAnimationSpringDisplacement(spring, middle)) > tolerance) {
+            unsettled = middle;
+        }
+        else {
+            settled = middle;
+        }
+    }
+    return settled;
+}
+
+// x = R e^(-decay t) cos(frequency t - phase). Its extrema are R cos(alpha)
+// e^(-decay t), alpha = atan(decay / frequency), so the last one above the
+// tolerance is known without sampling; |x| then falls monotonically until the
+// next zero.
+static double TimelineAnimationSpringUnderdampedSettlingTime(const TimelineAnimationSpring *spring, double tolerance)
+{
+    const double decay = spring->decay;
+    const double frequency = spring->frequency;
+    const double amplitude = hypot(spring->a, spring->b);
+    const double phase = atan2(spring->b, spring->a);
+    const double alpha = atan2(decay, frequency);
+    const double halfPeriod = M_PI / frequency;
+
+    double start = 0.0;
+    const double peak = amplitude * cos(alpha);
+    if (peak > tolerance) {
+        if (decay == 0.0) {
+            return INFINITY;
+        }
+        // extrema at (phase - alpha + n pi) / frequency
+        const double lastTime = log(peak / tolerance) / decay;
+        const double last = floor((lastTime * frequency - phase + alpha) / M_PI);
+        const double first = ceil((alpha - phase) / M_PI);
+        if (last >= first) {
+            start = (phase - alpha + last * M_PI) / frequency;
+        }
+    }
+    if (fabs(TimelineAnimationSpringDisplacement(spring, start)) <= tolerance) {
+        return start;
+    }
+    // zeros at (phase + pi/2 + n pi) / frequency
+    double zero = (phase + M_PI_2 + floor((start * frequency - phase - M_PI_2) / M_PI) * M_PI) / frequency;
+    while (zero <= start) {
+        zero += halfPeriod;
+    }
+    return TimelineAnimationSpringSettle(spring, start, zero, tolerance);
+}
+
+// x has at most one zero and one extremum, and |x| is monotonic between
+// them, so the tolerance is crossed last in the last interval starting above
+// it.
+static double TimelineAnimationSpringDampedSettlingTime(const TimelineAnimationSpring *spring, double tolerance)
+{
+    const double a = spring->a;
+    const double b = spring->b;
+    double candidates[3] = { 0.0, -1.0, -1.0 };
+    if (spring->regime == TimelineAnimationSpringCriticallyDamped) {
+        if (b != 0.0) {
+            candidates[1] = -a / b;
+            candidates[2] = 1.0 / spring->decay - a / b;
+        }
+    }
+    else if (a != 0.0) {
+        const double gap = spring->frequency - spring->decay;
+        if (-b / a > 0.0) {
+            candidates[1] = log(-b / a) / gap;
+        }
+        if (-spring->frequency * b / (spring->decay * a) > 0.0) {
+            candidates[2] = log(-spring->frequency * b / (spring->decay * a)) / gap;
+        }
+    }
+    // sort the three, the negative ones are before the release and dropped
+    for (int i = 1; i < 3; ++i) {
+        for (int j = i; j > 0 && candidates[j] < candidates[j - 1]; --j) {
+            const double swap = candidates[j];
+            candidates[j] = candidates[j - 1];
+            candidates[j - 1] = swap;
+        }
+    }
+    int count = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (candidates[i] >= 0.0) {
+            candidates[count++] = candidates[i];
+        }
+    }
+
+    const double last = candidates[count - 1];
+    if (fabs(TimelineAnimationSpringDisplacement(spring, last)) > tolerance) {
+        double settled = last + 1.0 / spring->decay;
+        while (fabs(TimelineAnimationSpringDisplacement(spring, settled)) > tolerance) {
+            settled = last + 2.0 * (settled - last);
+        }
+        return TimelineAnimationSpringSettle(spring, last, settled, tolerance);
+    }
+    for (int i = count - 1; i > 0; --i) {
+        if (fabs(TimelineAnimationSpringDisplacement(spring, candidates[i - 1])) > tolerance) {
+            return TimelineAnimationSpringSettle(spring, candidates[i - 1], candidates[i], tolerance);
+        }
+    }
+    return 0.0;
+}
+
+double TimelineAnimationSpringSettlingTime(const TimelineAnimationSpring *spring, double tolerance)
+{
+    if (!(tolerance > 0.0)) {
+        return INFINITY;
+    }
+    if (spring->regime == TimelineAnimationSpringUnderdamped) {
+        return TimelineAnimationSpringUnderdampedSettlingTime(spring, tolerance);
+    }
+    return TimelineAnimationSpringDampedSettlingTime(spring, tolerance);
+}
@@ -0,0 +1,98 @@
+/*!
+ *  @file TimelineAnimationSpring.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_SPRING_H
+#define TIMELINE_ANIMATIONS_SPRING_H
+
+#include <stddef.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // A damped spring pulling the progress from 0 to 1, as
+    // CASpringAnimation models it:
+    //
+    //     mass * x'' + damping * x' + stiffness * x = 0
+    //
+    // where x is progress - 1. Unlike the timing functions of
+    // TimelineAnimationSpecialTimingFunction.h a spring is evaluated at a time
+    // in seconds, not at a progress, and it knows when it has settled:
+    //
+    //     TimelineAnimationSpring spring;
+    //     if (TimelineAnimationSpringInit(&spring, 1.0, 100.0, 10.0, 0.0)) {
+    //         const double duration = TimelineAnimationSpringSettlingTime(&spring, TimelineAnimationSpringDefaultTolerance);
+    //         TimelineAnimationSpringKeyframeProgress(&spring, duration, keyframeCount, progress);
+    //     }
+    //
+    // The closed-form solution is used for the underdamped (damping below
+    // 2 * sqrt(mass * stiffness)), critically damped and overdamped springs.
+
+    /// How close to 1 the progress has to stay for a spring to be settled;
+    /// a tenth of a point for an animation over 100 points.
+    #define TimelineAnimationSpringDefaultTolerance 1e-3
+
+    enum {
+        TimelineAnimationSpringUnderdamped,
+        TimelineAnimationSpringCriticallyDamped,
+        TimelineAnimationSpringOverdamped,
+    };
+
+    /// A spring ready to be evaluated, see TimelineAnimationSpringInit().
+    typedef struct {
+        /// One of TimelineAnimationSpringUnderdamped,
+        /// TimelineAnimationSpringCriticallyDamped or
+        /// TimelineAnimationSpringOverdamped.
+        int regime;
+        /// The undamped angular frequency, sqrt(stiffness / mass).
+        double naturalFrequency;
+        /// damping / (2 * sqrt(mass * stiffness)).
+        double dampingRatio;
+        /// Private, the coefficients of the solution.
+        double decay, frequency, a, b;
+    } TimelineAnimationSpring;
+
+    /// Sets up `spring`. `initialVelocity` is in distances per second, positive
+    /// towards 1, like the initialVelocity of CASpringAnimation. Returns 0 if
+    /// `mass` or `stiffness` are not positive, or `damping` is negative.
+    int TimelineAnimationSpringInit(TimelineAnimationSpring *spring,
+                                    double mass,
+                                    double stiffness,
+                                    double damping,
+                                    double initialVelocity);
+
+    /// The progress of `spring` `time` seconds after it was released from 0.
+    double TimelineAnimationSpringEvaluate(const TimelineAnimationSpring *spring, double time);
+
+    /// Evaluates `spring` at `n` times. `times` and `progress` may be the same
+    /// buffer.
+    void TimelineAnimationSpringEvaluateBatch(const TimelineAnimationSpring *spring,
+                                              const double *times,
+                                              double *progress,
+                                              size_t n);
+
+    /// The time, in seconds, after which the progress of `spring` stays within
+    /// `tolerance` of 1. It is exact, not the bound of the decay envelope, so
+    /// the last overshoot is not cut short nor waited for needlessly. INFINITY
+    /// for an undamped spring or a `tolerance` that is not positive.
+    double TimelineAnimationSpringSettlingTime(const TimelineAnimationSpring *spring, double tolerance);
+
+    /// Writes the progress of `spring` at `keyframeCount` evenly spaced times
+    /// over [0, `duration`] in `progress`, several times faster than
+    /// evaluating them one by one. `keyframeCount` must be at least 2.
+    void TimelineAnimationSpringKeyframeProgress(const TimelineAnimationSpring *spring,
+                                                 double duration,
+                                                 size_t keyframeCount,
+                                                 double *progress);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
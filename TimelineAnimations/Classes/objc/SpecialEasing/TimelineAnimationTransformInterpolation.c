@@ -0,0 +1,513 @@
+/*!
+ *  @file TimelineAnimationTransformInterpolation.c
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "TimelineAnimationTransformInterpolation.h"
+#include "TimelineAnimationKeyframes.h"
+
+// The keyframes interpolated at a time: the sines and cosines of a block are
+// taken first, then the block is composed without calls.
+#define TA_TRANSFORM_BLOCK 64
+
+// Under this sine of the angle between the quaternions, the rotation is
+// interpolated linearly, off by its square.
+#define TA_TRANSFORM_SLERP_EPSILON 1e-9
+
+static inline double TimelineAnimationTransformDot3(const double a[3], const double b[3])
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void TimelineAnimationTransformCross3(const double a[3], const double b[3], double result[3])
+{
+    result[0] = a[1] * b[2] - a[2] * b[1];
+    result[1] = a[2] * b[0] - a[0] * b[2];
+    result[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+// The parts of a decomposition, in a row: translation, scale, skew,
+// perspective, quaternion.
+enum {
+    TA_TRANSFORM_TRANSLATION = 0,
+    TA_TRANSFORM_SCALE = 3,
+    TA_TRANSFORM_SKEW = 6,
+    TA_TRANSFORM_PERSPECTIVE = 9,
+    TA_TRANSFORM_QUATERNION = 13,
+    TA_TRANSFORM_PARTS = 17,
+};
+
+// The parts at progress v are start + v * difference, but for the quaternion,
+// fromWeight * from + toWeight * to, the weights of the spherical
+// interpolation.
+typedef struct {
+    double start[TA_TRANSFORM_PARTS];
+    double difference[TA_TRANSFORM_PARTS];
+    double from[4];
+    double to[4];
+} TimelineAnimationTransformSpan;
+
+// Writes the matrices at `count` progress values, with their quaternion
+// weights, in `matrix`, planar. Arithmetic only, and into planes a known
+// distance apart, so that it vectorises.
+static void TimelineAnimationTransformComposeBlock(const TimelineAnimationTransformSpan *span,
+                                                   const double *restrict progress,
+                                                   const double *restrict fromWeights,
+                                                   const double *restrict toWeights,
+                                                   size_t count,
+                                                   double matrix[restrict TimelineAnimationTransformComponents][TA_TRANSFORM_BLOCK])
+{
+    // by value, so that writing `matrix` cannot change them
+    const TimelineAnimationTransformSpan local = *span;
+    const double *const start = local.start;
+    const double *const difference = local.difference;
+    for (size_t i = 0; i < count; ++i) {
+        const double v = progress[i];
+#define TA_TRANSFORM_PART(index) (start[index] + v * difference[index])
+        const double fromWeight = fromWeights[i], toWeight = toWeights[i];
+        const double x = fromWeight * local.from[0] + toWeight * local.to[0];
+        const double y = fromWeight * local.from[1] + toWeight * local.to[1];
+        const double z = fromWeight * local.from[2] + toWeight * local.to[2];
+        const double w = fromWeight * local.from[3] + toWeight * local.to[3];
+        // the rotation, for row vectors
+        const double r00 = 1.0 - 2.0 * (y * y + z * z), r01 = 2.0 * (x * y + z * w), r02 = 2.0 * (x * z - y * w);
+        const double r10 = 2.0 * (x * y - z * w), r11 = 1.0 - 2.0 * (x * x + z * z), r12 = 2.0 * (y * z + x * w);
+        const double r20 = 2.0 * (x * z + y * w), r21 = 2.0 * (y * z - x * w), r22 = 1.0 - 2.0 * (x * x + y * y);
+
+        // scale * skew * rotation
+        const double s0 = TA_TRANSFORM_PART(TA_TRANSFORM_SCALE);
+        const double s1 = TA_TRANSFORM_PART(TA_TRANSFORM_SCALE + 1);
+        const double s2 = TA_TRANSFORM_PART(TA_TRANSFORM_SCALE + 2);
+        const double kxy = TA_TRANSFORM_PART(TA_TRANSFORM_SKEW);
+        const double kxz = TA_TRANSFORM_PART(TA_TRANSFORM_SKEW + 1);
+        const double kyz = TA_TRANSFORM_PART(TA_TRANSFORM_SKEW + 2);
+        const double l00 = s0 * r00, l01 = s0 * r01, l02 = s0 * r02;
+        const double l10 = s1 * (r10 + kxy * r00);
+        const double l11 = s1 * (r11 + kxy * r01);
+        const double l12 = s1 * (r12 + kxy * r02);
+        const double l20 = s2 * (r20 + kxz * r00 + kyz * r10);
+        const double l21 = s2 * (r21 + kxz * r01 + kyz * r11);
+        const double l22 = s2 * (r22 + kxz * r02 + kyz * r12);
+
+        const double px = TA_TRANSFORM_PART(TA_TRANSFORM_PERSPECTIVE);
+        const double py = TA_TRANSFORM_PART(TA_TRANSFORM_PERSPECTIVE + 1);
+        const double pz = TA_TRANSFORM_PART(TA_TRANSFORM_PERSPECTIVE + 2);
+        const double pw = TA_TRANSFORM_PART(TA_TRANSFORM_PERSPECTIVE + 3);
+        const double tx = TA_TRANSFORM_PART(TA_TRANSFORM_TRANSLATION);
+        const double ty = TA_TRANSFORM_PART(TA_TRANSFORM_TRANSLATION + 1);
+        const double tz = TA_TRANSFORM_PART(TA_TRANSFORM_TRANSLATION + 2);
+#undef TA_TRANSFORM_PART
+        matrix[0][i] = l00;
+        matrix[1][i] = l01;
+        matrix[2][i] = l02;
+        matrix[3][i] = l00 * px + l01 * py + l02 * pz;
+        matrix[4][i] = l10;
+        matrix[5][i] = l11;
+        matrix[6][i] = l12;
+        matrix[7][i] = l10 * px + l11 * py + l12 * pz;
+        matrix[8][i] = l20;
+        matrix[9][i] = l21;
+        matrix[10][i] = l22;
+        matrix[11][i] = l20 * px + l21 * py + l22 * pz;
+        matrix[12][i] = tx;
+        matrix[13][i] = ty;
+        matrix[14][i] = tz;
+        matrix[15][i] = tx * px + ty * py + tz * pz + pw;
+    }
+}
+
+// The affine version of TimelineAnimationTransformComposeBlock(): the
+// rotation is about z, nothing moves along z and there is no perspective.
+static void TimelineAnimationTransformComposeAffineBlock(const TimelineAnimationTransformSpan *span,
+                                                         const double *restrict progress,
+                                                         const double *restrict fromWeights,
+                                                         const double *restrict toWeights,
+                                                         size_t count,
+                                                         double values[restrict TimelineAnimationTransformAffineComponents][TA_TRANSFORM_BLOCK])
+{
+    const double fromZ = span->from[2], fromW = span->from[3], toZ = span->to[2], toW = span->to[3];
+    const double s0Start = span->start[TA_TRANSFORM_SCALE], s0Difference = span->difference[TA_TRANSFORM_SCALE];
+    const double s1Start = span->start[TA_TRANSFORM_SCALE + 1], s1Difference = span->difference[TA_TRANSFORM_SCALE + 1];
+    const double kStart = span->start[TA_TRANSFORM_SKEW], kDifference = span->difference[TA_TRANSFORM_SKEW];
+    const double txStart = span->start[TA_TRANSFORM_TRANSLATION];
+    const double txDifference = span->difference[TA_TRANSFORM_TRANSLATION];
+    const double tyStart = span->start[TA_TRANSFORM_TRANSLATION + 1];
+    const double tyDifference = span->difference[TA_TRANSFORM_TRANSLATION + 1];
+    for (size_t i = 0; i < count; ++i) {
+        const double v = progress[i];
+        const double z = fromWeights[i] * fromZ + toWeights[i] * toZ;
+        const double w = fromWeights[i] * fromW + toWeights[i] * toW;
+        const double cosine = 1.0 - 2.0 * z * z;
+        const double sine = 2.0 * z * w;
+        const double s0 = s0Start + v * s0Difference;
+        const double s1 = s1Start + v * s1Difference;
+        const double kxy = kStart + v * kDifference;
+        values[0][i] = s0 * cosine;
+        values[1][i] = s0 * sine;
+        values[2][i] = s1 * (kxy * cosine - sine);
+        values[3][i] = s1 * (kxy * sine + cosine);
+        values[4][i] = txStart + v * txDifference;
+        values[5][i] = tyStart + v * tyDifference;
+    }
+}
+
+// The parts of `decomposition`, in a row.
+static void TimelineAnimationTransformParts(const TimelineAnimationTransformDecomposition *decomposition,
+                                            double parts[TA_TRANSFORM_PARTS])
+{
+    for (size_t i = 0; i < 3; ++i) {
+        parts[TA_TRANSFORM_TRANSLATION + i] = decomposition->translation[i];
+        parts[TA_TRANSFORM_SCALE + i] = decomposition->scale[i];
+        parts[TA_TRANSFORM_SKEW + i] = decomposition->skew[i];
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        parts[TA_TRANSFORM_PERSPECTIVE + i] = decomposition->perspective[i];
+        parts[TA_TRANSFORM_QUATERNION + i] = decomposition->quaternion[i];
+    }
+}
+
+int TimelineAnimationTransformDecompose(const double matrix[TimelineAnimationTransformComponents],
+                                        TimelineAnimationTransformDecomposition *decomposition)
+{
+    if (matrix[15] == 0.0) {
+        return 0;
+    }
+    double normalised[TimelineAnimationTransformComponents];
+    for (size_t i = 0; i < TimelineAnimationTransformComponents; ++i) {
+        normalised[i] = matrix[i] / matrix[15];
+    }
+    double row[3][3] = {
+        { normalised[0], normalised[1], normalised[2] },
+        { normalised[4], normalised[5], normalised[6] },
+        { normalised[8], normalised[9], normalised[10] },
+    };
+    double cofactor[3][3];
+    TimelineAnimationTransformCross3(row[1], row[2], cofactor[0]);
+    TimelineAnimationTransformCross3(row[2], row[0], cofactor[1]);
+    TimelineAnimationTransformCross3(row[0], row[1], cofactor[2]);
+    const double determinant = TimelineAnimationTransformDot3(row[0], cofactor[0]);
+    if (determinant == 0.0 || !isfinite(determinant)) {
+        return 0;
+    }
+
+    // the last column is the 3x3 part times the perspective
+    const double *const translation = normalised + 12;
+    double *const perspective = decomposition->perspective;
+    if (normalised[3] != 0.0 || normalised[7] != 0.0 || normalised[11] != 0.0) {
+        const double column[3] = { normalised[3], normalised[7], normalised[11] };
+        for (size_t i = 0; i < 3; ++i) {
+            // the inverse is the transposed cofactors over the determinant
+            perspective[i] = (cofactor[0][i] * column[0] + cofactor[1][i] * column[1] + cofactor[2][i] * column[2])
+                / determinant;
+        }
+        perspective[3] = 1.0 - TimelineAnimationTransformDot3(translation, perspective);
+    }
+    else {
+        perspective[0] = 0.0;
+        perspective[1] = 0.0;
+        perspective[2] = 0.0;
+        perspective[3] = 1.0;
+    }
+    for (size_t i = 0; i < 3; ++i) {
+        decomposition->translation[i] = translation[i];
+    }
+
+    // Gram-Schmidt: row 0 alone, then what of row 1 is not along it, then
+    // what of row 2 is along neither
+    double *const scale = decomposition->scale;
+    double *const skew = decomposition->skew;
+    scale[0] = sqrt(TimelineAnimationTransformDot3(row[0], row[0]));
+    for (size_t i = 0; i < 3; ++i) {
+        row[0][i] /= scale[0];
+    }
+    skew[0] = TimelineAnimationTransformDot3(row[0], row[1]);
+    for (size_t i = 0; i < 3; ++i) {
+        row[1][i] -= skew[0] * row[0][i];
+    }
+    scale[1] = sqrt(TimelineAnimationTransformDot3(row[1], row[1]));
+    for (size_t i = 0; i < 3; ++i) {
+        row[1][i] /= scale[1];
+    }
+    skew[0] /= scale[1];
+    skew[1] = TimelineAnimationTransformDot3(row[0], row[2]);
+    skew[2] = TimelineAnimationTransformDot3(row[1], row[2]);
+    for (size_t i = 0; i < 3; ++i) {
+        row[2][i] -= skew[1] * row[0][i] + skew[2] * row[1][i];
+    }
+    scale[2] = sqrt(TimelineAnimationTransformDot3(row[2], row[2]));
+    for (size_t i = 0; i < 3; ++i) {
+        row[2][i] /= scale[2];
+    }
+    skew[1] /= scale[2];
+    skew[2] /= scale[2];
+
+    // a mirror is a negative scale, leaving a rotation
+    if (determinant < 0.0) {
+        const int keepsZ = (normalised[2] == 0.0 && normalised[6] == 0.0 && normalised[8] == 0.0 && normalised[9] == 0.0);
+        if (keepsZ) {
+            // along x, so that an affine transform keeps rotating about z
+            scale[0] = -scale[0];
+            skew[0] = -skew[0];
+            skew[1] = -skew[1];
+            for (size_t i = 0; i < 3; ++i) {
+                row[0][i] = -row[0][i];
+            }
+        }
+        else {
+            for (size_t r = 0; r < 3; ++r) {
+                scale[r] = -scale[r];
+                for (size_t i = 0; i < 3; ++i) {
+                    row[r][i] = -row[r][i];
+                }
+            }
+        }
+    }
+
+    // the quaternion of the rotation, from its largest component so that
+    // half turns come out right
+    double *const q = decomposition->quaternion;
+    const double trace = row[0][0] + row[1][1] + row[2][2];
+    if (trace > 0.0) {
+        const double w = 0.5 * sqrt(1.0 + trace);
+        q[3] = w;
+        q[0] = (row[1][2] - row[2][1]) / (4.0 * w);
+        q[1] = (row[2][0] - row[0][2]) / (4.0 * w);
+        q[2] = (row[0][1] - row[1][0]) / (4.0 * w);
+    }
+    else if (row[0][0] >= row[1][1] && row[0][0] >= row[2][2]) {
+        const double x = 0.5 * sqrt(fmax(1.0 + row[0][0] - row[1][1] - row[2][2], 0.0));
+        q[0] = x;
+        q[3] = (row[1][2] - row[2][1]) / (4.0 * x);
+        q[1] = (row[0][1] + row[1][0]) / (4.0 * x);
+        q[2] = (row[0][2] + row[2][0]) / (4.0 * x);
+    }
+    else if (row[1][1] >= row[2][2]) {
+        const double y = 0.5 * sqrt(fmax(1.0 - row[0][0] + row[1][1] - row[2][2], 0.0));
+        q[1] = y;
+        q[3] = (row[2][0] - row[0][2]) / (4.0 * y);
+        q[0] = (row[0][1] + row[1][0]) / (4.0 * y);
+        q[2] = (row[1][2] + row[2][1]) / (4.0 * y);
+    }
+    else {
+        const double z = 0.5 * sqrt(fmax(1.0 - row[0][0] - row[1][1] + row[2][2], 0.0));
+        q[2] = z;
+        q[3] = (row[0][1] - row[1][0]) / (4.0 * z);
+        q[0] = (row[0][2] + row[2][0]) / (4.0 * z);
+        q[1] = (row[1][2] + row[2][1]) / (4.0 * z);
+    }
+    if (q[3] < 0.0) {
+        for (size_t i = 0; i < 4; ++i) {
+            q[i] = -q[i];
+        }
+    }
+    return 1;
+}
+
+void TimelineAnimationTransformRecompose(const TimelineAnimationTransformDecomposition *decomposition,
+                                         double matrix[TimelineAnimationTransformComponents])
+{
+    TimelineAnimationTransformSpan span = { 0 };
+    TimelineAnimationTransformParts(decomposition, span.start);
+    for (size_t i = 0; i < 4; ++i) {
+        span.from[i] = decomposition->quaternion[i];
+    }
+    const double progress = 0.0, fromWeight = 1.0, toWeight = 0.0;
+    double composed[TimelineAnimationTransformComponents][TA_TRANSFORM_BLOCK];
+    TimelineAnimationTransformComposeBlock(&span, &progress, &fromWeight, &toWeight, 1, composed);
+    for (size_t c = 0; c < TimelineAnimationTransformComponents; ++c) {
+        matrix[c] = composed[c][0];
+    }
+}
+
+// The quaternions of a rotation from `from` to `to`, the latter negated if
+// that is shorter, and the angle between them: the rotation at progress v is
+// sin((1 - v) angle) / sin(angle) from + sin(v angle) / sin(angle) to, or
+// cos(v angle) - cos(angle) sin(v angle) / sin(angle) for the first weight.
+typedef struct {
+    double from[4];
+    double to[4];
+    double cosine;
+    double angle;
+    double inverseSine;
+    int linear;
+} TimelineAnimationTransformSlerp;
+
+static void TimelineAnimationTransformSlerpMake(const double from[4], const double to[4], TimelineAnimationTransformSlerp *slerp)
+{
+    double cosine = from[0] * to[0] + from[1] * to[1] + from[2] * to[2] + from[3] * to[3];
+    const double sign = (cosine < 0.0) ? -1.0 : 1.0;
+    cosine = fmin(fabs(cosine), 1.0);
+    for (size_t i = 0; i < 4; ++i) {
+        slerp->from[i] = from[i];
+        slerp->to[i] = sign * to[i];
+    }
+    const double sine = sqrt(1.0 - cosine * cosine);
+    slerp->cosine = cosine;
+    slerp->angle = acos(cosine);
+    slerp->linear = (sine < TA_TRANSFORM_SLERP_EPSILON);
+    slerp->inverseSine = slerp->linear ? 0.0 : 1.0 / sine;
+}
+
+static inline void TimelineAnimationTransformSlerpWeights(const TimelineAnimationTransformSlerp *slerp,
+                                                          double progress,
+                                                          double *fromWeight,
+                                                          double *toWeight)
+{
+    if (slerp->linear) {
+        *fromWeight = 1.0 - progress;
+        *toWeight = progress;
+        return;
+    }
+    // a single sincos
+    const double sine = sin(progress * slerp->angle);
+    const double cosine = cos(progress * slerp->angle);
+    *toWeight = sine * slerp->inverseSine;
+    *fromWeight = cosine - slerp->cosine * *toWeight;
+}
+
+void TimelineAnimationTransformDecompositionInterpolate(const TimelineAnimationTransformDecomposition *from,
+                                                        const TimelineAnimationTransformDecomposition *to,
+                                                        double progress,
+                                                        TimelineAnimationTransformDecomposition *result)
+{
+    for (size_t i = 0; i < 3; ++i) {
+        result->translation[i] = from->translation[i] + progress * (to->translation[i] - from->translation[i]);
+        result->scale[i] = from->scale[i] + progress * (to->scale[i] - from->scale[i]);
+        result->skew[i] = from->skew[i] + progress * (to->skew[i] - from->skew[i]);
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        result->perspective[i] = from->perspective[i] + progress * (to->perspective[i] - from->perspective[i]);
+    }
+    TimelineAnimationTransformSlerp slerp;
+    TimelineAnimationTransformSlerpMake(from->quaternion, to->quaternion, &slerp);
+    double fromWeight, toWeight;
+    TimelineAnimationTransformSlerpWeights(&slerp, progress, &fromWeight, &toWeight);
+    for (size_t i = 0; i < 4; ++i) {
+        result->quaternion[i] = fromWeight * slerp.from[i] + toWeight * slerp.to[i];
+    }
+}
+
+// Writes the keyframes of the decomposed `from` and `to`, all 16 components
+// or the affine ones.
+static void TimelineAnimationTransformInterpolateDecompositions(const double *progress,
+                                                                size_t keyframeCount,
+                                                                const TimelineAnimationTransformDecomposition *from,
+                                                                const TimelineAnimationTransformDecomposition *to,
+                                                                int affine,
+                                                                double *values)
+{
+    TimelineAnimationTransformSlerp slerp;
+    TimelineAnimationTransformSlerpMake(from->quaternion, to->quaternion, &slerp);
+    TimelineAnimationTransformSpan span;
+    TimelineAnimationTransformParts(from, span.start);
+    TimelineAnimationTransformParts(to, span.difference);
+    for (size_t c = 0; c < TA_TRANSFORM_PARTS; ++c) {
+        span.difference[c] -= span.start[c];
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        span.from[i] = slerp.from[i];
+        span.to[i] = slerp.to[i];
+    }
+
+    double blockProgress[TA_TRANSFORM_BLOCK];
+    double fromWeights[TA_TRANSFORM_BLOCK];
+    double toWeights[TA_TRANSFORM_BLOCK];
+    double composed[TimelineAnimationTransformComponents][TA_TRANSFORM_BLOCK];
+    const size_t components = affine ? TimelineAnimationTransformAffineComponents : TimelineAnimationTransformComponents;
+    for (size_t first = 0; first < keyframeCount; first += TA_TRANSFORM_BLOCK) {
+        const size_t count = (keyframeCount - first < TA_TRANSFORM_BLOCK) ? keyframeCount - first : TA_TRANSFORM_BLOCK;
+        // read before any of the block is written, in case `progress` is a
+        // plane of `values`
+        for (size_t i = 0; i < count; ++i) {
+            blockProgress[i] = progress[first + i];
+        }
+        for (size_t i = 0; i < count; ++i) {
+            TimelineAnimationTransformSlerpWeights(&slerp, blockProgress[i], &fromWeights[i], &toWeights[i]);
+        }
+        if (affine) {
+            TimelineAnimationTransformComposeAffineBlock(&span, blockProgress, fromWeights, toWeights, count, composed);
+        }
+        else {
+            TimelineAnimationTransformComposeBlock(&span, blockProgress, fromWeights, toWeights, count, composed);
+        }
+        for (size_t c = 0; c < components; ++c) {
+            memcpy(values + c * keyframeCount + first, composed[c], sizeof(double) * count);
+        }
+    }
+}
+
+// Writes the keyframes of `components` values interpolated one by one.
+static void TimelineAnimationTransformInterpolateComponents(const double *progress,
+                                                            size_t keyframeCount,
+                                                            const double *from,
+                                                            const double *to,
+                                                            size_t components,
+                                                            double *values)
+{
+    double start[TimelineAnimationTransformComponents];
+    double end[TimelineAnimationTransformComponents];
+    for (size_t c = 0; c < components; ++c) {
+        start[c] = from[c];
+        end[c] = to[c];
+    }
+    // the last plane last, in case it holds the progress
+    TimelineAnimationKeyframeInterpolate(progress, keyframeCount, start, end, components, values);
+}
+
+void TimelineAnimationTransformInterpolate(const double *progress,
+                                           size_t keyframeCount,
+                                           const double from[TimelineAnimationTransformComponents],
+                                           const double to[TimelineAnimationTransformComponents],
+                                           double *values)
+{
+    TimelineAnimationTransformDecomposition fromDecomposition, toDecomposition;
+    if (!TimelineAnimationTransformDecompose(from, &fromDecomposition)
+        || !TimelineAnimationTransformDecompose(to, &toDecomposition)) {
+        TimelineAnimationTransformInterpolateComponents(progress, keyframeCount, from, to,
+                                                        TimelineAnimationTransformComponents, values);
+        return;
+    }
+    TimelineAnimationTransformInterpolateDecompositions(progress, keyframeCount, &fromDecomposition, &toDecomposition,
+                                                        0, values);
+}
+
+void TimelineAnimationTransformInterpolateAffine(const double *progress,
+                                                 size_t keyframeCount,
+                                                 const double from[TimelineAnimationTransformAffineComponents],
+                                                 const double to[TimelineAnimationTransformAffineComponents],
+                                                 double *values)
+{
+    // as CATransform3DMakeAffineTransform() puts them
+    const double fromMatrix[TimelineAnimationTransformComponents] = {
+        from[0], from[1], 0.0, 0.0, from[2], from[3], 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, from[4], from[5], 0.0, 1.0,
+    };
+    const double toMatrix[TimelineAnimationTransformComponents] = {
+        to[0], to[1], 0.0, 0.0, to[2], to[3], 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, to[4], to[5], 0.0, 1.0,
+    };
+    TimelineAnimationTransformDecomposition fromDecomposition, toDecomposition;
+    if (!TimelineAnimationTransformDecompose(fromMatrix, &fromDecomposition)
+        || !TimelineAnimationTransformDecompose(toMatrix, &toDecomposition)) {
+        TimelineAnimationTransformInterpolateComponents(progress, keyframeCount, from, to,
+                                                        TimelineAnimationTransformAffineComponents, values);
+        return;
+    }
+    TimelineAnimationTransformInterpolateDecompositions(progress, keyframeCount, &fromDecomposition, &toDecomposition,
+                                                        1, values);
+}
+
+void TimelineAnimationTransforms(TimelineAnimationSpecialTimingFunction function,
+                                 const double from[TimelineAnimationTransformComponents],
+                                 const double to[TimelineAnimationTransformComponents],
+                                 size_t keyframeCount,
+                                 double *values)
+{
+    double *const progress = values + (TimelineAnimationTransformComponents - 1) * keyframeCount;
+    TimelineAnimationKeyframeProgress(function, keyframeCount, progress);
+    TimelineAnimationTransformInterpolate(progress, keyframeCount, from, to, values);
+}
@@ -0,0 +1,104 @@
+/*!
+ *  @file TimelineAnimationTransformInterpolation.h
+ *  @brief TimelineAnimations
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#ifndef TIMELINE_ANIMATIONS_TRANSFORM_INTERPOLATION_H
+#define TIMELINE_ANIMATIONS_TRANSFORM_INTERPOLATION_H
+
+#include <stddef.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+    // Interpolation of 3D transforms, free of Foundation so that it builds
+    // and can be checked on any platform.
+    //
+    // A matrix is 16 doubles in the order of the fields of CATransform3D,
+    // m11, m12, ... m44, row by row: points are row vectors multiplied on the
+    // left, the translation is m41, m42, m43 and the perspective m14, m24,
+    // m34.
+    //
+    // A transform is decomposed as in CSS Transforms: perspective,
+    // translation, a rotation, skew and scale, the 3x3 part being
+    // scale * skew * rotation. The parts are interpolated linearly, the
+    // rotation along the shorter arc between the quaternions, and composed
+    // back.
+
+    /// The number of components of a matrix.
+    #define TimelineAnimationTransformComponents 16
+
+    /// The number of components of an affine transform: a, b, c, d, tx, ty.
+    #define TimelineAnimationTransformAffineComponents 6
+
+    typedef struct {
+        double translation[3];
+        /// Negative on one axis or all three if the transform mirrors.
+        double scale[3];
+        /// XY, XZ and YZ shear factors.
+        double skew[3];
+        /// x, y, z, w, 0, 0, 0, 1 without perspective.
+        double perspective[4];
+        /// x, y, z, w, with w >= 0.
+        double quaternion[4];
+    } TimelineAnimationTransformDecomposition;
+
+    /// Decomposes `matrix`. Returns 0 if it cannot be decomposed, if m44 is 0
+    /// or its 3x3 part is singular. A mirroring transform that keeps the
+    /// z axis, as an affine one does, is mirrored along x, any other along all
+    /// three axes, so that what is left is a rotation.
+    int TimelineAnimationTransformDecompose(const double matrix[TimelineAnimationTransformComponents],
+                                            TimelineAnimationTransformDecomposition *decomposition);
+
+    /// Composes the matrix of `decomposition`, with m44 normalised to 1 when
+    /// there is no perspective.
+    void TimelineAnimationTransformRecompose(const TimelineAnimationTransformDecomposition *decomposition,
+                                             double matrix[TimelineAnimationTransformComponents]);
+
+    /// Writes the decomposition at `progress` from `from` to `to` in `result`.
+    void TimelineAnimationTransformDecompositionInterpolate(const TimelineAnimationTransformDecomposition *from,
+                                                            const TimelineAnimationTransformDecomposition *to,
+                                                            double progress,
+                                                            TimelineAnimationTransformDecomposition *result);
+
+    /// Writes the keyframes of a matrix going from `from` to `to` along
+    /// `progress` in `values`, planar in the order of CATransform3D. The
+    /// transforms are decomposed once, and each keyframe takes a single sine
+    /// and cosine, of the rotation; the rest is arithmetic, over blocks of
+    /// keyframes one component at a time. If either transform cannot be
+    /// decomposed the components are interpolated linearly. `progress` may be
+    /// the last plane of `values`.
+    void TimelineAnimationTransformInterpolate(const double *progress,
+                                               size_t keyframeCount,
+                                               const double from[TimelineAnimationTransformComponents],
+                                               const double to[TimelineAnimationTransformComponents],
+                                               double *values);
+
+    /// The affine version of TimelineAnimationTransformInterpolate(), planar
+    /// in the order of CGAffineTransform.
+    void TimelineAnimationTransformInterpolateAffine(const double *progress,
+                                                     size_t keyframeCount,
+                                                     const double from[TimelineAnimationTransformAffineComponents],
+                                                     const double to[TimelineAnimationTransformAffineComponents],
+                                                     double *values);
+
+    /// Writes the `keyframeCount` keyframes of a matrix going from `from` to
+    /// `to` along `function` in `values`, planar,
+    /// `TimelineAnimationTransformComponents * keyframeCount` doubles.
+    void TimelineAnimationTransforms(TimelineAnimationSpecialTimingFunction function,
+                                     const double from[TimelineAnimationTransformComponents],
+                                     const double to[TimelineAnimationTransformComponents],
+                                     size_t keyframeCount,
+                                     double *values);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* TIMELINE_ANIMATIONS_TRANSFORM_INTERPOLATION_H */
@@ -434,6 +434,32 @@ FOUNDATION_EXTERN TimelineAnimationExceptionName TimelineAnimationElementsNotInH
  */
 - (void)merge:(TimelineAnimation *)timeline;
 
+/**
+ Adds the animations that `updates` adds, or merges, without checking each of
+ them for conflicts, then checks them all at once. Meant for building large
+ timelines, where checking every animation as it is added costs the most.
+ 
+ If any of them conflicts, with an animation already in the timeline or with
+ another of them, none of them is added, the blank animations inserted are
+ removed and the onStart and completion blocks are put back as they were,
+ without those of the timelines merged. The same goes if `updates` throws,
+ the exception being thrown again.
+ 
+ @param updates a block adding animations to the receiver. Nested calls are
+ checked by the outermost one. It may not call -clear.
+ @param error on return, if there were conflicts, an error with the code
+ TimelineAnimationsErrorDomainCodeConflictingAnimations and, under
+ TimelineAnimationConflictsKey, an error of the same code for each animation
+ conflicting with one beginning before it, or at the same time and added
+ before it.
+ @return YES if the animations were added.
+ 
+ @throws ImmutableTimelineAnimationException if called on an ongoing timeline,
+ or if `updates` calls -clear.
+ */
+- (BOOL)performBatchUpdates:(NS_NOESCAPE TimelineAnimationVoidBlock)updates
+                      error:(NSError *__autoreleasing _Nullable *_Nullable)error;
+
 @end
 
 #pragma mark - Control Blocks 
@@ -25,6 +25,7 @@
 #import "TimelineAudioAssociation_Internal.h"
 #import "NSSet+TimelineSwiftyAdditions.h"
 #import "TimelineAnimationWeakLayerBox.h"
+#import "TimelineAnimationIntervalIndex.h"
 
 TimelineAnimationExceptionName ImmutableTimelineAnimationException = @"ImmutableTimelineAnimation";
 TimelineAnimationExceptionName EmptyTimelineAnimationException = @"EmptyTimeline";
@@ -41,8 +42,22 @@ NSErrorDomain const TimelineAnimationsErrorDomain = @"TimelineAnimationsErrorDom
 
 NSErrorUserInfoKey const TimelineAnimationReferenceKey = @"timeline";
 NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
-
-@interface TimelineAnimation ()
+NSErrorUserInfoKey const TimelineAnimationConflictsKey = @"conflicts";
+NSErrorUserInfoKey const TimelineAnimationConflictingAnimationsKey = @"animations";
+NSErrorUserInfoKey const TimelineAnimationConflictingLayerKey = @"layer";
+
+@interface TimelineAnimation () {
+    /// The intervals of `_animations` by their conflict keys, numbered in
+    /// `_conflictKeys`, see -_conflictIndex.
+    TimelineAnimationIntervalIndex *_conflictIndex;
+    NSMutableDictionary<NSString *, NSNumber *> *_conflictKeys;
+    /// `_animations` by begin time and the one ending last, see
+    /// -_entitiesByBeginTime.
+    NSMutableArray<TimelineEntity *> *_entitiesByBeginTime;
+    TimelineEntity *_latestEndingEntity;
+    /// The nested calls of -performBatchUpdates:error: under way.
+    NSUInteger _batchUpdates;
+}
 
 @property (nonatomic, strong) TimelineAnimationsDisplayLink *displayLink;
 @property (nonatomic, strong) NSMutableSet<TimelineEntity *> *unfinishedEntities;
@@ -118,6 +133,7 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
 }
 
 - (void)dealloc {
+    TimelineAnimationIntervalIndexDestroy(_conflictIndex);
     [self _cleanUp];
     //    _blankLayers = nil;
     //    _animations = nil;
@@ -179,20 +195,81 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
 
 #pragma mark - Adding Animation Methods -
 
+/// The tail of the timeline, the entity ending last, kept as entities are
+/// added, delayed or merged so that appending takes O(1), see
+/// -_latestEndingEntity.
 - (TimelineEntity *)lastEntity {
-    __block TimelineEntity *res = nil;
-    __block RelativeTime maxTime = 0;
+    return [self _latestEndingEntity];
+}
+
+- (TimelineAnimationInterval)_conflictIntervalOfEntity:(TimelineEntity *)entity {
+    NSString *const key = entity.conflictKey;
+    NSNumber *number = _conflictKeys[key];
+    if (number == nil) {
+        number = @(_conflictKeys.count);
+        _conflictKeys[key] = number;
+    }
+    const TimelineAnimationInterval interval = {
+        number.unsignedIntegerValue, entity.beginTicks, entity.endTicks,
+    };
+    return interval;
+}
+
+/// Forgets the intervals of the entities, when their times change.
+- (void)_invalidateConflictIndex {
+    if (_conflictIndex != NULL) {
+        TimelineAnimationIntervalIndexRemoveAll(_conflictIndex);
+    }
+    [_conflictKeys removeAllObjects];
+}
+
+/// The index of the intervals of `_animations`, built again if entities were
+/// added or removed other than by -_addTimelineEntity:. NULL if memory runs
+/// out.
+- (nullable TimelineAnimationIntervalIndex *)_conflictIndex {
+    if (_conflictIndex == NULL) {
+        _conflictIndex = TimelineAnimationIntervalIndexCreate();
+        _conflictKeys  = [[NSMutableDictionary alloc] init];
+        guard (_conflictIndex != NULL) else { return NULL; }
+    }
+    guard (TimelineAnimationIntervalIndexCount(_conflictIndex) != _animations.count) else { return _conflictIndex; }
+
+    [self _invalidateConflictIndex];
     for (TimelineEntity *const entity in _animations) {
-        const RelativeTime endTime = entity.endTime;
-        if (endTime >= maxTime) {
-            maxTime = endTime;
-            res = entity;
+        const TimelineAnimationInterval interval = [self _conflictIntervalOfEntity:entity];
+        guard (TimelineAnimationIntervalIndexInsert(_conflictIndex, &interval)) else {
+            [self _invalidateConflictIndex];
+            return NULL;
         }
-    };
-    return res;
+    }
+    return _conflictIndex;
 }
 
 - (void)_addTimelineEntity:(TimelineEntity *)timelineEntity {
+    guard (_batchUpdates == 0) else {
+        // checked once the batch ends
+        [_animations addObject:timelineEntity];
+        [self _addEntityToBounds:timelineEntity];
+        return;
+    }
+    TimelineAnimationIntervalIndex *const index = [self _conflictIndex];
+    const TimelineAnimationInterval interval = [self _conflictIntervalOfEntity:timelineEntity];
+    // the index rules out most entities in O(log n), the others are checked
+    // against every entity, which finds the one to report
+    const BOOL mayConflict = (index == NULL) || TimelineAnimationIntervalIndexMayConflict(index, &interval);
+    guard (!mayConflict || ![self _reportConflictOfEntity:timelineEntity]) else { return; }
+
+    // add the timeline entity
+    [_animations addObject:timelineEntity];
+    if (index != NULL && !TimelineAnimationIntervalIndexInsert(index, &interval)) {
+        [self _invalidateConflictIndex];
+    }
+    [self _addEntityToBounds:timelineEntity];
+}
+
+/// Raises, or logs, the first conflict of `timelineEntity` with an entity of
+/// the timeline. Returns whether there was one.
+- (BOOL)_reportConflictOfEntity:(TimelineEntity *)timelineEntity {
 
     {   // check if already in
         const BOOL alreadyIn = [_animations containsObject:timelineEntity];
@@ -206,7 +283,7 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
             TimelineEntity *const entity = _animations[indexes.firstIndex];
             [self __raiseConflictingAnimationExceptionBetweenEntity:entity
                                                           andEntity:timelineEntity];
-            return;
+            return YES;
         }
     }
 
@@ -222,12 +299,101 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
             TimelineEntity *const entity = _animations[indexes.firstIndex];
             [self __raiseConflictingAnimationExceptionBetweenEntity:entity
                                                           andEntity:timelineEntity];
-            return;
+            return YES;
         }
     }
+    return NO;
+}
 
-    // add the timeline entity
-    [_animations addObject:timelineEntity];
+/// The conflicts of the entities from `first` on, with those before them or
+/// with one another, found in one sort and sweep of all the entities.
+- (NSArray<NSError *> *)_conflictsOfEntitiesFromIndex:(NSUInteger)first {
+    const NSUInteger count = _animations.count;
+    guard (first < count) else { return @[]; }
+
+    TimelineAnimationInterval *const intervals = malloc(sizeof(TimelineAnimationInterval) * count);
+    TimelineAnimationIntervalConflict *const conflicts = malloc(sizeof(TimelineAnimationIntervalConflict) * count);
+    size_t found = SIZE_MAX;
+    if (intervals != NULL && conflicts != NULL) {
+        NSMutableDictionary<NSString *, NSNumber *> *const keys = [[NSMutableDictionary alloc] init];
+        for (NSUInteger i = 0; i < count; ++i) {
+            TimelineEntity *const entity = _animations[i];
+            NSString *const key = entity.conflictKey;
+            NSNumber *number = keys[key];
+            if (number == nil) {
+                number = @(keys.count);
+                keys[key] = number;
+            }
+            const TimelineAnimationInterval interval = {
+                number.unsignedIntegerValue, entity.beginTicks, entity.endTicks,
+            };
+            intervals[i] = interval;
+        }
+        found = TimelineAnimationIntervalsFindConflicts(intervals, count, conflicts);
+    }
+
+    NSMutableArray<NSError *> *const errors = [[NSMutableArray alloc] init];
+    BOOL (^const conflicting)(TimelineEntity *, TimelineEntity *) = ^BOOL(TimelineEntity *entity1, TimelineEntity *entity2) {
+        return [entity1 isEqual:entity2] || [entity1 conflictingWith:entity2];
+    };
+    void (^const addError)(TimelineEntity *, TimelineEntity *) = ^(TimelineEntity *entity1, TimelineEntity *entity2) {
+        NSString *const reason =
+        [[NSString alloc] initWithFormat:
+         @"The conflict resides between \n\ta: %@\n\tb: %@.",
+         entity1.shortDescription,
+         entity2.shortDescription];
+        NSMutableDictionary<NSErrorUserInfoKey, id> *const userInfo = [@{
+                                                                         TimelineAnimationReferenceKey: self,
+                                                                         NSLocalizedDescriptionKey: TimelineAnimationConflictingAnimationsException,
+                                                                         NSLocalizedFailureReasonErrorKey: reason,
+                                                                         TimelineAnimationConflictingAnimationsKey: @[entity1.animation.copy, entity2.animation.copy],
+                                                                         } mutableCopy];
+        __strong __kindof CALayer *const slayer = entity1.layer;
+        if (slayer != nil) {
+            userInfo[TimelineAnimationConflictingLayerKey] = slayer;
+        }
+        [errors addObject:[NSError errorWithDomain:TimelineAnimationsErrorDomain
+                                              code:TimelineAnimationsErrorDomainCodeConflictingAnimations
+                                          userInfo:userInfo]];
+    };
+    if (found != SIZE_MAX) {
+        for (size_t k = 0; k < found; ++k) {
+            const NSUInteger index = conflicts[k].interval;
+            TimelineEntity *const entity = _animations[index];
+            NSUInteger otherIndex = conflicts[k].other;
+            // the conflict keys are strings that different keys can share,
+            // then the entity is checked against every one before it
+            if (!conflicting(_animations[otherIndex], entity)) {
+                otherIndex = NSNotFound;
+                for (NSUInteger j = 0; j < count; ++j) {
+                    const BOOL before = (intervals[j].begin < intervals[index].begin)
+                        || (intervals[j].begin == intervals[index].begin && j < index);
+                    guard (before && conflicting(_animations[j], entity)) else { continue; }
+                    otherIndex = j;
+                    break;
+                }
+                guard (otherIndex != NSNotFound) else { continue; }
+            }
+            // those before the batch do not conflict among themselves
+            guard (index >= first || otherIndex >= first) else { continue; }
+            addError(_animations[otherIndex], entity);
+        }
+    }
+    else {
+        // out of memory, every entity of the batch against those before it
+        for (NSUInteger i = first; i < count; ++i) {
+            TimelineEntity *const entity = _animations[i];
+            for (NSUInteger j = 0; j < i; ++j) {
+                TimelineEntity *const other = _animations[j];
+                guard (conflicting(other, entity)) else { continue; }
+                addError(other, entity);
+                break;
+            }
+        }
+    }
+    free(conflicts);
+    free(intervals);
+    return [errors copy];
 }
 
 #pragma mark - Animation Control Methods -
@@ -363,6 +529,7 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
     for (TimelineEntity *const entity in _animations) {
         [entity reset];
     };
+    [self _invalidateBounds];
 
     _repeat.onStartCalled = NO;
     _repeat.onCompleteCalled = NO;
@@ -424,11 +591,64 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
     return sortedEntities;
 }
 
+#pragma mark - Bounds
+
+/// Forgets the order of the entities, when their times change.
+- (void)_invalidateBounds {
+    _entitiesByBeginTime = nil;
+    _latestEndingEntity  = nil;
+}
+
+- (void)_updateBoundsIfNeeded {
+    guard (_entitiesByBeginTime == nil || _entitiesByBeginTime.count != _animations.count) else { return; }
+    _entitiesByBeginTime = [[self _sortedEntitesUsingKey:SortKey(beginTicks)] mutableCopy];
+    _latestEndingEntity  = [self _sortedEntitesUsingKey:SortKey(endTicks)].lastObject;
+}
+
+/// The entities by begin time, those beginning together in the order they
+/// were added, as sorting them has it. Kept as entities are added and
+/// delayed, sorted again after anything else changes their times.
+- (NSArray<TimelineEntity *> *)_entitiesByBeginTime {
+    [self _updateBoundsIfNeeded];
+    return _entitiesByBeginTime;
+}
+
+/// The entity ending last, the last added of those ending together.
+- (nullable TimelineEntity *)_latestEndingEntity {
+    [self _updateBoundsIfNeeded];
+    return _latestEndingEntity;
+}
+
+- (void)_addEntityToBounds:(TimelineEntity *)entity {
+    // only if they were up to date without it
+    guard (_entitiesByBeginTime != nil && _entitiesByBeginTime.count + 1 == _animations.count) else {
+        [self _invalidateBounds];
+        return;
+    }
+    // after those beginning at the same time
+    const TimelineTicks beginTicks = entity.beginTicks;
+    NSUInteger low = 0;
+    NSUInteger high = _entitiesByBeginTime.count;
+    while (low < high) {
+        const NSUInteger middle = low + (high - low) / 2;
+        if (_entitiesByBeginTime[middle].beginTicks <= beginTicks) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    [_entitiesByBeginTime insertObject:entity atIndex:low];
+    if (_latestEndingEntity == nil || entity.endTicks >= _latestEndingEntity.endTicks) {
+        _latestEndingEntity = entity;
+    }
+}
+
 #pragma mark - Properties
 
 - (RelativeTime)beginTime {
-    const RelativeTime begin = [self _sortedEntitesUsingKey:SortKey(beginTime)].firstObject.beginTime;
-    return begin;
+    const TimelineTicks begin = [self _entitiesByBeginTime].firstObject.beginTicks;
+    return TimelineTimeFromTicks(begin);
 }
 
 - (void)setBeginTime:(RelativeTime)beginTime {
@@ -437,7 +657,7 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
 }
 
 - (RelativeTime)endTime {
-    const RelativeTime endTime = [self _sortedEntitesUsingKey:SortKey(endTime)].lastObject.endTime;
+    const RelativeTime endTime = TimelineTimeFromTicks([self _latestEndingEntity].endTicks);
     if (self.isRepeating && !self.isInfinitelyRepeating) {
         return (endTime - self.beginTime) * (RelativeTime)self.repeatCount + self.beginTime;
     }
@@ -445,8 +665,7 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
 }
 
 - (RelativeTime)endTimeWithNoRepeating {
-    const RelativeTime endTime = [self _sortedEntitesUsingKey:SortKey(endTime)].lastObject.endTime;
-    return endTime;
+    return TimelineTimeFromTicks([self _latestEndingEntity].endTicks);
 }
 
 - (NSTimeInterval)duration {
@@ -507,6 +726,14 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
     for (TimelineEntity *const entity in _animations) {
         entity.speed = speed;
     }
+    [self _invalidateConflictIndex];
+    [self _invalidateBounds];
+}
+
+- (void)setAnimations:(NSMutableArray<TimelineEntity *> *)animations {
+    _animations = animations;
+    [self _invalidateConflictIndex];
+    [self _invalidateBounds];
 }
 
 - (void)setStarted:(BOOL)started {
@@ -576,12 +803,13 @@ NSErrorUserInfoKey const TimelineAnimationSummaryKey = @"summary";
         [blankAnimations addObject:entity];
     }];
     [_animations removeObjectsInArray:blankAnimations];
+    [self _invalidateBounds];
 }
 
 - (NSTimeInterval)nonRepeatingDuration {
-    const RelativeTime begin = [self _sortedEntitesUsingKey:SortKey(beginTime)].firstObject.beginTime;
-    const RelativeTime end = [self _sortedEntitesUsingKey:SortKey(endTime)].lastObject.endTime;
-    return (end - begin);
+    const TimelineTicks begin = [self _entitiesByBeginTime].firstObject.beginTicks;
+    const TimelineTicks end = [self _latestEndingEntity].endTicks;
+    return TimelineTimeFromTicks(end - begin);
 }
 
 - (NSSet<__kindof CALayer *> *)affectedLayers {
@@ -936,7 +1164,7 @@ va_end(arguments); \
     guard (_timeNotificationAssociations.count > 0) else { return; }
 
     [_timeNotificationAssociations enumerateKeysAndObjectsUsingBlock:^(RelativeTimeNumber  *_Nonnull key, NSMutableArray<TimelineAnimationNotifyBlockInfo *> *_Nonnull infos, BOOL * _Nonnull stop) {
-        const RelativeTime time = key.doubleValue;
+        const RelativeTime time = TimelineTimeFromTicks(key.longLongValue);
         __weak typeof(self) welf = self;
         [self insertBlankAnimationAtTime:time
                                  onStart:^{
@@ -983,7 +1211,7 @@ va_end(arguments); \
      self.beginTime, self.endTime, self.duration];
     [summary appendFormat:@" animations(%@) = [\n", @(_animations.count)];
 
-    NSArray<TimelineEntity *> *const sorted = [self _sortedEntitesUsingKey:SortKey(beginTime)];
+    NSArray<TimelineEntity *> *const sorted = [self _entitiesByBeginTime].copy;
     [sorted enumerateObjectsUsingBlock:^(TimelineEntity * _Nonnull entity, NSUInteger idx, BOOL * _Nonnull stop) {
         __strong __kindof CALayer *const slayer = entity.layer;
         [summary appendFormat:(entity == entityToMark) ? @" -> " : @"    "];
@@ -1323,6 +1551,94 @@ va_end(arguments); \
     }
 }
 
+- (BOOL)performBatchUpdates:(NS_NOESCAPE TimelineAnimationVoidBlock)updates
+                      error:(NSError *__autoreleasing _Nullable *_Nullable)error {
+
+    NSParameterAssert(updates != nil);
+
+    if (self.hasStarted) {
+        [self __raiseImmutableTimelineExceptionWithSelector:_cmd];
+        return NO;
+    }
+
+    // what the batch may change, to leave the timeline as it was
+    const NSUInteger first = _animations.count;
+    const NSUInteger firstBlankLayer = _blankLayers.count;
+    TimelineAnimationOnStartBlock const onStart = _onStart;
+    TimelineAnimationCompletionBlock const completion = _completion;
+
+    ++_batchUpdates;
+    @try {
+        updates();
+    }
+    @catch (id exception) {
+        [self _undoBatchUpdatesFromEntity:first
+                               blankLayer:firstBlankLayer
+                                  onStart:onStart
+                               completion:completion];
+        @throw;
+    }
+    @finally {
+        --_batchUpdates;
+    }
+    // the outermost batch checks the entities of those nested in it
+    guard (_batchUpdates == 0) else { return YES; }
+    // nothing added to check, -clear being refused during a batch the count
+    // cannot drop below `first`
+    guard (_animations.count > first) else { return YES; }
+
+    NSArray<NSError *> *const conflicts = [self _conflictsOfEntitiesFromIndex:first];
+    guard (conflicts.count > 0) else { return YES; }
+
+    NSString *const summary = self.summary;
+    const NSUInteger added = _animations.count - first;
+    [self _undoBatchUpdatesFromEntity:first
+                           blankLayer:firstBlankLayer
+                              onStart:onStart
+                           completion:completion];
+
+    if (error != NULL) {
+        NSString *const reason =
+        [[NSString alloc] initWithFormat:
+         @"Tried to add %lu animations to the timeline, of which %lu conflict"
+         " with other animations. None of them was added.",
+         (unsigned long)added,
+         (unsigned long)conflicts.count];
+        *error = [NSError errorWithDomain:TimelineAnimationsErrorDomain
+                                     code:TimelineAnimationsErrorDomainCodeConflictingAnimations
+                                 userInfo:@{
+                                            TimelineAnimationReferenceKey: self,
+                                            TimelineAnimationSummaryKey: summary,
+                                            NSLocalizedDescriptionKey: TimelineAnimationConflictingAnimationsException,
+                                            NSLocalizedFailureReasonErrorKey: reason,
+                                            TimelineAnimationConflictsKey: conflicts,
+                                            }];
+    }
+    return NO;
+}
+
+/// Removes the entities and blank layers a batch added, from `first` and
+/// `firstBlankLayer` on, and puts back the blocks -merge: chained.
+- (void)_undoBatchUpdatesFromEntity:(NSUInteger)first
+                         blankLayer:(NSUInteger)firstBlankLayer
+                            onStart:(nullable TimelineAnimationOnStartBlock)onStart
+                         completion:(nullable TimelineAnimationCompletionBlock)completion {
+    if (_animations.count > first) {
+        [_animations removeObjectsInRange:NSMakeRange(first, _animations.count - first)];
+        [self _invalidateBounds];
+    }
+    if (_blankLayers.count > firstBlankLayer) {
+        const NSRange added = NSMakeRange(firstBlankLayer, _blankLayers.count - firstBlankLayer);
+        for (TimelineAnimationsBlankLayer *const layer in [_blankLayers subarrayWithRange:added]) {
+            [layer removeAllAnimations];
+            [layer removeFromSuperlayer];
+        }
+        [_blankLayers removeObjectsInRange:added];
+    }
+    [self _setOnStart:onStart];
+    [self _setCompletion:completion];
+}
+
 @end
 
 #pragma mark - Control Blocks
@@ -1398,10 +1714,9 @@ va_end(arguments); \
          [self summary]];
     }
 
+    NSArray<TimelineEntity *> *const sortedEntities = [self _entitiesByBeginTime].copy;
     self.started = YES;
 
-
-    NSArray<TimelineEntity *> *const sortedEntities = [self _sortedEntitesUsingKey:SortKey(beginTime)];
     _unfinishedEntities = [[NSMutableSet alloc] initWithArray:_animations];
     [sortedEntities enumerateObjectsUsingBlock:^(TimelineEntity * _Nonnull entity, NSUInteger idx, BOOL * _Nonnull stop) {
         entity.speed = self.speed;
@@ -1454,11 +1769,20 @@ va_end(arguments); \
 }
 
 - (void)clear {
+    guard (_batchUpdates == 0) else {
+        [self __raiseImmutableTimelineAnimationExceptionWithReason:
+         @"Tried to clear %@.%@ during -performBatchUpdates:error:,"
+         " which could not tell the animations it added any more.",
+         NSStringFromClass(self.class),
+         self.name];
+        return;
+    }
     for (TimelineEntity *const entity in _animations) {
         [entity clear];
     };
 
     [_animations removeAllObjects];
+    [self _invalidateBounds];
 
     self.paused  = NO;
     self.started = NO;
@@ -1487,18 +1811,23 @@ va_end(arguments); \
         [self __raiseImmutableTimelineExceptionWithSelector:_cmd];
         return;
     }
-    guard (delay != 0.0) else { return; }
+    const TimelineTicks delayTicks = TimelineTicksFromTime(delay);
+    guard (delayTicks != 0) else { return; }
 
     for (TimelineEntity *const entity in _animations) {
-        entity.beginTime += delay;
+        entity.beginTicks += delayTicks;
     };
+    // every entity moves alike, so the intervals keep their order
+    if (_conflictIndex != NULL) {
+        TimelineAnimationIntervalIndexShift(_conflictIndex, delayTicks);
+    }
 
-    RelativeTime newBeginTime = self.beginTime;
+    const TimelineTicks newBeginTicks = [self _entitiesByBeginTime].firstObject.beginTicks;
     // calculate notification time changes
     _timeNotificationAssociations = [self timeNotificationConvertedUsing:^RelativeTimeNumber * _Nonnull(RelativeTimeNumber * _Nonnull key) {
-        RelativeTime new = Round(key.doubleValue + delay);
-        if (new <= newBeginTime) {
-            new = newBeginTime + TimelineAnimationMillisecond;
+        TimelineTicks new = key.longLongValue + delayTicks;
+        if (new <= newBeginTicks) {
+            new = newBeginTicks + TimelineTicksPerMillisecond;
         }
         return @(new);
     }];
@@ -1515,23 +1844,21 @@ va_end(arguments); \
         }
         const NSTimeInterval currentDuration = self.nonRepeatingDuration; {
             // checks
-            const NSUInteger currentDurationInMilliseconds = (NSUInteger)(currentDuration * 1000.0); // in ms
-            const NSUInteger durationInMilliseconds = (NSUInteger)(duration * 1000.0); // in ms
+            const TimelineTicks currentDurationTicks = TimelineTicksFromTime(currentDuration);
+            const TimelineTicks durationTicks = TimelineTicksFromTime(duration);
 
             // if same duration do nothing
-            guard (durationInMilliseconds != currentDurationInMilliseconds) else {
+            guard (durationTicks != currentDurationTicks) else {
                 return updatedTimeline;
             }
 
-            const NSUInteger millisecond = (NSUInteger)(TimelineAnimationMillisecond * 1000.0);
             // if duration is only 1ms then do nothing
-            if (currentDurationInMilliseconds == millisecond) {
+            if (currentDurationTicks == TimelineTicksFromTime(TimelineAnimationMillisecond)) {
                 return updatedTimeline;
             }
 
-            const NSUInteger frame = (NSUInteger)(TimelineAnimationOneFrame * 1000.0);
             // if duration is only 16ms (one frame long) then do nothing
-            if (currentDurationInMilliseconds == frame) {
+            if (currentDurationTicks == TimelineTicksFromTime(TimelineAnimationOneFrame)) {
                 return updatedTimeline;
             }
         }
@@ -1542,9 +1869,10 @@ va_end(arguments); \
         const NSTimeInterval newTimelineDuration = duration;
         const NSTimeInterval oldTimelineDuration = currentDuration;
         const RelativeTime beginTime = self.beginTime;
+        const TimelineTicks beginTicks = TimelineTicksFromTime(beginTime);
         for (TimelineEntity *const entity in entities) {
             // adjust if the entity's .beginTime is not the same as the timeline's .beginTime
-            const BOOL adjust = fabs((double)(entity.beginTime - beginTime)) >= TimelineAnimationMillisecond;
+            const BOOL adjust = (entity.beginTicks != beginTicks);
             const NSTimeInterval newEntityDuration = newTimelineDuration * entity.duration / oldTimelineDuration;
             TimelineEntity *const updatedEntity = [entity copyWithDuration:newEntityDuration
                                                      shouldAdjustBeginTime:adjust
@@ -1566,22 +1894,16 @@ va_end(arguments); \
 
         // calculate notification time changes
         const double factor = newTimelineDuration / oldTimelineDuration;
+        const TimelineTicks millisecond = TimelineTicksFromTime(TimelineAnimationMillisecond);
+        const TimelineTicks frame = TimelineTicksFromTime(TimelineAnimationOneFrame);
         updatedTimeline.timeNotificationAssociations = [self timeNotificationConvertedUsing:^RelativeTimeNumber *(RelativeTimeNumber *key) {
-            double value = key.doubleValue;
-            if ((value == TimelineAnimationMillisecond)
-                || (fabs((double)(value - TimelineAnimationMillisecond)) < 0.001)) {
-                return @(TimelineAnimationMillisecond);
-            }
-            // if around one frame time
-            if ((value == TimelineAnimationOneFrame)
-                || (fabs((double)(value - TimelineAnimationOneFrame)) < 0.001)) {
-                return @(TimelineAnimationOneFrame);
-            }
-            value *= factor;
-            if (value < TimelineAnimationMillisecond) {
-                value = TimelineAnimationMillisecond;
+            const TimelineTicks ticks = key.longLongValue;
+            // if at one millisecond or one frame time
+            if (ticks == millisecond || ticks == frame) {
+                return key;
             }
-            return @(Round(value));
+            const TimelineTicks value = TimelineTicksFromTime(TimelineTimeFromTicks(ticks) * factor);
+            return @(MAX(value, millisecond));
         }];
 
         return updatedTimeline;
@@ -1613,7 +1935,7 @@ va_end(arguments); \
         [reversedEntities addObject:reversedTimelineEntity];
     };
 
-    [reversedEntities sortUsingDescriptors:@[[NSSortDescriptor sortDescriptorWithKey:@"beginTime" ascending:YES]]];
+    [reversedEntities sortUsingDescriptors:@[[NSSortDescriptor sortDescriptorWithKey:SortKey(beginTicks) ascending:YES]]];
 
     TimelineAnimation *const reversed = [self copy];
     [reversedEntities enumerateObjectsUsingBlock:^(TimelineEntity * _Nonnull entity, NSUInteger idx, BOOL * _Nonnull stop) {
@@ -1737,7 +2059,7 @@ va_end(arguments); \
 }
 
 - (void)_appendTimelineAnimationNotifyBlockInfo:(TimelineAnimationNotifyBlockInfo *)info atTime:(RelativeTime)time {
-    RelativeTimeNumber *const timeKey = @(Round(time));
+    RelativeTimeNumber *const timeKey = @(TimelineTicksFromTime(time));
     NSMutableArray<TimelineAnimationNotifyBlockInfo *> *infos = _timeNotificationAssociations[timeKey];
     if (infos == nil) {
         infos = [[NSMutableArray alloc] init];
@@ -1945,7 +2267,7 @@ va_end(arguments); \
     }
 
     const RelativeTime time = [association timeInTimelineAnimation:self];
-    RelativeTimeNumber *const timeKey = @(time);
+    RelativeTimeNumber *const timeKey = @(TimelineTicksFromTime(time));
     NSMutableArray<TimelineAnimationNotifyBlockInfo *> *const infos = _timeNotificationAssociations[timeKey];
 
     NSIndexSet *const indexes = [infos indexesOfObjectsPassingTest:^BOOL(TimelineAnimationNotifyBlockInfo * _Nonnull info, NSUInteger idx, BOOL * _Nonnull stop) {
@@ -1968,7 +2290,7 @@ va_end(arguments); \
         return @[];
     }
 
-    RelativeTimeNumber *const timeKey = @(time);
+    RelativeTimeNumber *const timeKey = @(TimelineTicksFromTime(time));
     NSMutableArray<TimelineAnimationNotifyBlockInfo *> *infos = _timeNotificationAssociations[timeKey];
     guard (infos != nil) else { return @[]; }
     guard (infos.count != 0) else { return @[]; }
@@ -1992,7 +2314,7 @@ va_end(arguments); \
 
     NSMutableArray<TimelineAnimationNotifyBlockInfo *> *const ongoingSounds = [[NSMutableArray alloc] init];
     [_timeNotificationAssociations enumerateKeysAndObjectsUsingBlock:^(RelativeTimeNumber * _Nonnull keyTime, NSMutableArray<TimelineAnimationNotifyBlockInfo *> * _Nonnull infos, BOOL * _Nonnull stop) {
-        const RelativeTime beginTime = keyTime.doubleValue;
+        const RelativeTime beginTime = TimelineTimeFromTicks(keyTime.longLongValue);
         guard (time >= beginTime) else { return; }
         NSArray<TimelineAnimationNotifyBlockInfo *> *_ongoingSounds =
         [infos _objectsPassingTest:^BOOL(TimelineAnimationNotifyBlockInfo * _Nonnull info, NSUInteger idx, BOOL * _Nonnull stop2) {
@@ -2088,8 +2410,9 @@ va_end(arguments); \
 }
 
 - (NSArray<__kindof CAPropertyAnimation *> *)animationsBeginingAtTime:(RelativeTime)time {
+    const TimelineTicks ticks = TimelineTicksFromTime(time);
     NSIndexSet *const indexes = [_animations indexesOfObjectsPassingTest:^BOOL(TimelineEntity * _Nonnull entity, NSUInteger idx, BOOL * _Nonnull stop) {
-        return (entity.beginTime == time);
+        return (entity.beginTicks == ticks);
     }];
     NSArray<TimelineEntity *> *const entities = [_animations objectsAtIndexes:indexes];
     NSArray<__kindof CAPropertyAnimation *> *const animations = [[NSArray alloc] initWithArray:
@@ -2099,8 +2422,9 @@ va_end(arguments); \
 }
 
 - (NSArray<__kindof CAPropertyAnimation *> *)animationsOngoingAtTime:(RelativeTime)time {
+    const TimelineTicks ticks = TimelineTicksFromTime(time);
     NSIndexSet *const indexes = [_animations indexesOfObjectsPassingTest:^BOOL(TimelineEntity * _Nonnull entity, NSUInteger idx, BOOL * _Nonnull stop) {
-        return (time >= entity.beginTime) && (time <= entity.endTime);
+        return (ticks >= entity.beginTicks) && (ticks <= entity.endTicks);
     }];
     NSArray<TimelineEntity *> *const entities = [_animations objectsAtIndexes:indexes];
     NSArray<__kindof CAPropertyAnimation *> *const animations = [[NSArray alloc] initWithArray:
@@ -16,6 +16,7 @@
 #import "EasingTimingHandler.h"
 #import "KeyValueBlockObservation.h"
 #import "CAKeyframeAnimation+SpecialEasing.h"
+#import "CAKeyframeAnimation+Simplification.h"
 #import "AnimationsFactory.h"
 #import "TimelineAudio.h"
 #import "TimelineAudioAssociation.h"
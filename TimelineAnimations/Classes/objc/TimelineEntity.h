@@ -23,6 +23,11 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, assign, readonly)  RelativeTime endTime;
 @property (nonatomic, assign, readonly)  NSTimeInterval duration;
 
+/// The begin time the entity keeps, relative to its timeline also while it
+/// plays.
+@property (nonatomic, readwrite, assign) TimelineTicks beginTicks;
+@property (nonatomic, assign, readonly)  TimelineTicks endTicks;
+
 @property (nonatomic, copy, readonly, nullable) TimelineAnimationOnStartBlock onStart;
 @property (nonatomic, copy, readonly, nullable) TimelineAnimationCompletionBlock completion;
 
@@ -75,6 +80,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface TimelineEntity (Conflicts)
 - (BOOL)conflictingWith:(TimelineEntity *)entity;
+/// The layer, animation key and key path, the same for entities that may conflict.
+@property (nonatomic, readonly) NSString *conflictKey;
 @end
 
 @interface TimelineEntity (Duration)
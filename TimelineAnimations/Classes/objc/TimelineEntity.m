@@ -13,6 +13,7 @@
 #import "CAPropertyAnimation+Reverse.h"
 #import "CABasicAnimation+Reverse.h"
 #import "CAKeyframeAnimation+Reverse.h"
+#import "CAKeyframeAnimation+SpecialEasing.h"
 #import "CALayer+TimelineAnimation.h"
 #import "CAPropertyAnimation+TimelineEntity.h"
 #import "PrivateTypes.h"
@@ -41,6 +42,9 @@
 
 @property (nonatomic, copy) NSString *actualAnimationKey;
 
+/// The real duration of the animation, which does not change once added.
+@property (nonatomic, assign) TimelineTicks durationTicks;
+
 - (instancetype)init NS_DESIGNATED_INITIALIZER;
 
 - (instancetype)initWithLayer:(__kindof CALayer *)layer
@@ -127,8 +131,10 @@
         _completion          = [completion copy];
         _timelineAnimation   = timelineAnimation;
         
-        _animation.beginTime = Round(beginTime);
-        _animation.duration  = Round(_animation.duration);
+        _beginTicks          = TimelineTicksFromTime(beginTime);
+        _animation.beginTime = TimelineTimeFromTicks(_beginTicks);
+        _animation.duration  = TimelineTimeFromTicks(TimelineTicksFromTime(_animation.duration));
+        _durationTicks       = TimelineTicksFromTime(_animation.realDuration);
         
         _initialAnimation    = _animation.copy;
         _initialAnimationKey = key.copy;
@@ -170,18 +176,26 @@
 #pragma mark - Properties
 
 - (RelativeTime)beginTime {
-    const RelativeTime beginTime = (RelativeTime)_animation.beginTime;
-    return Round(beginTime);
+    return TimelineTimeFromTicks(_beginTicks);
 }
 
 - (void)setBeginTime:(RelativeTime)beginTime {
+    self.beginTicks = TimelineTicksFromTime(beginTime);
+}
+
+- (void)setBeginTicks:(TimelineTicks)beginTicks {
+    _beginTicks = beginTicks;
+    // Core Animation's copy, which follows the media time while playing
     _initialAnimation.beginTime =
-    _animation.beginTime        = (RelativeTime)Round(beginTime);
+    _animation.beginTime        = TimelineTimeFromTicks(beginTicks);
 }
 
 - (RelativeTime)endTime {
-    const RelativeTime endTime = ((RelativeTime)_animation.beginTime) + ((RelativeTime)self.duration);
-    return Round(endTime);
+    return TimelineTimeFromTicks(self.endTicks);
+}
+
+- (TimelineTicks)endTicks {
+    return _beginTicks + _durationTicks;
 }
 
 - (NSTimeInterval)duration {
@@ -242,7 +256,7 @@
         return NO;
     }
     
-    if (other.beginTime != self.beginTime) {
+    if (other.beginTicks != _beginTicks) {
         return NO;
     }
     
@@ -431,6 +445,7 @@
     
     
     
+    [self _materializeDeferredValues];
     _animation.delegate = self;
     const CFTimeInterval gap = _animation.duration * (CFTimeInterval)_progress;
     _animation.beginTime += (RelativeTime)currentTime();
@@ -544,6 +559,18 @@
     [slayer setValue:_initialValue forKeyPath:keyPath];
 }
 
+/// The values of a deferred special easing animation are computed now that it
+/// plays. The initial animation gets them too, from the keyframe cache, so
+/// that a reset does not defer them again.
+- (void)_materializeDeferredValues {
+    guard ([_animation isKindOfClass:[CAKeyframeAnimation class]]) else { return; }
+    __kindof CAKeyframeAnimation *const keyframeAnimation = (__kindof CAKeyframeAnimation *)_animation;
+    guard (keyframeAnimation.hasDeferredValues) else { return; }
+    
+    [keyframeAnimation materializeValues];
+    [(__kindof CAKeyframeAnimation *)_initialAnimation materializeValues];
+}
+
 - (id)_updateAnimationForSetModelValues {
     __strong typeof(_layer) slayer = _layer;
     guard (slayer != nil) else { _raise(EmptyTimelineAnimationException); return nil; };
@@ -655,14 +682,11 @@
     // - same animation key
     // - same keypath
     
-    // there is snag you see…,
-    // due to bad planning float comparison sucks, so we transform everything
-    // in milliseconds and treat them as integers
-    const int64_t selfBeginTime = (int64_t)(self.beginTime * (RelativeTime)1000.0); // make it ms
-    const int64_t selfEndTime = (int64_t)(self.endTime * (RelativeTime)1000.0); // make it ms
+    const TimelineTicks selfBeginTime = _beginTicks;
+    const TimelineTicks selfEndTime = self.endTicks;
     
-    int64_t otherBeginTime = (int64_t)(other.beginTime * (RelativeTime)1000.0); // make it ms
-    int64_t otherEndTime = (int64_t)(other.endTime * (RelativeTime)1000.0); // make it ms
+    const TimelineTicks otherBeginTime = other.beginTicks;
+    const TimelineTicks otherEndTime = other.endTicks;
     
     // if I begin before the other ends, |or| the other begins before I end! - boumis the painter
     if ( ((selfBeginTime >= otherBeginTime) && (selfBeginTime < otherEndTime)) ||
@@ -673,6 +697,11 @@
     return NO;
 }
 
+- (NSString *)conflictKey {
+    __strong typeof(_layer) slayer = _layer;
+    return [NSString stringWithFormat:@"%p %@ %@", slayer, _animationKey, _animation.keyPath];
+}
+
 @end
 
 @implementation TimelineEntity (Duration)
@@ -688,23 +717,23 @@
     const NSTimeInterval newAnimationDuration = (NSTimeInterval) (((NSTimeInterval)animation.duration) * factor);
     animation.duration  = newAnimationDuration;
     
+    // the times are set before the entity keeps them as ticks
+    RelativeTime beginTime = self.beginTime;
+    if (adjust) {
+        beginTime = totalBeginTime + ((beginTime - totalBeginTime) * factor);
+    }
+    if (newAnimationDuration < TimelineAnimationMillisecond) {
+        beginTime = MAX(TimelineTimeFromTicks(TimelineTicksFromTime(beginTime)) - TimelineAnimationMillisecond, (RelativeTime)0);
+        animation.duration = TimelineAnimationMillisecond; // 1ms
+    }
+    
     TimelineEntity *entity = [[TimelineEntity alloc] initWithLayer:_layer
                                                          animation:animation
                                                       animationKey:_animationKey
-                                                         beginTime:_initialAnimation.beginTime
+                                                         beginTime:beginTime
                                                            onStart:_onStart
                                                         onComplete:_completion
                                                  timelineAnimation:_timelineAnimation];
-    if (adjust) {
-        entity.beginTime = totalBeginTime + ((self.beginTime - totalBeginTime) * factor);
-    }
-    if (newAnimationDuration < TimelineAnimationMillisecond) {
-        entity.beginTime = MAX(entity.beginTime - TimelineAnimationMillisecond, (RelativeTime)0);
-        entity.animation.duration = TimelineAnimationMillisecond; // 1ms
-    }
-    else {
-        entity.animation.duration = (CFTimeInterval)Round(entity.animation.duration);
-    }
     return entity;
 }
 
@@ -61,6 +61,12 @@ typedef NS_ENUM(NSInteger, TimelineAnimationsErrorDomainCode) {
 FOUNDATION_EXTERN NSErrorUserInfoKey const TimelineAnimationReferenceKey;
 /** The error key containing the summarry of the TimelineAnimation. */
 FOUNDATION_EXTERN NSErrorUserInfoKey const TimelineAnimationSummaryKey;
+/** The error key containing the conflicts found by -performBatchUpdates:error:, an error for each. */
+FOUNDATION_EXTERN NSErrorUserInfoKey const TimelineAnimationConflictsKey;
+/** The error key containing the two animations of a conflict, the one beginning first first. */
+FOUNDATION_EXTERN NSErrorUserInfoKey const TimelineAnimationConflictingAnimationsKey;
+/** The error key containing the layer of a conflict. */
+FOUNDATION_EXTERN NSErrorUserInfoKey const TimelineAnimationConflictingLayerKey;
 
 /** Block used for completion */
 typedef void (^TimelineAnimationBoolBlock)(BOOL result);
@@ -0,0 +1,171 @@
+/*!
+ *  @file TimelineAnimationAdaptiveKeyframesCheck.c
+ *  @brief TimelineAnimations
+ *
+ *  For every curve of TimelineAnimationSpecialTimingFunction.h and a few
+ *  maximum errors, compares the keyframes of
+ *  TimelineAnimationKeyframeAdaptiveProgress() with the 60 evenly spaced ones
+ *  of CAKeyframeAnimation+SpecialEasing: the keyframe count, and the largest
+ *  error of their linear interpolation over 2^20 + 1 progress values. Also
+ *  prints how many evenly spaced keyframes reach the same error.
+ *
+ *  Exits with 1 if an adaptive interpolation is off by more than its maximum
+ *  error, or if a curve needs more than TimelineAnimationKeyframeAdaptiveCapacity
+ *  keyframes within 1e-5.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationAdaptiveKeyframesCheck.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframes.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationTransformInterpolation.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationAdaptiveKeyframesCheck && /tmp/TimelineAnimationAdaptiveKeyframesCheck
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "TimelineAnimationKeyframes.h"
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#define GRID ((size_t)1 << 20)
+#define UNIFORM 60
+#define CAPACITY TimelineAnimationKeyframeAdaptiveCapacity
+
+#define CURVE(name) { #name, name }
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+} curves[] = {
+    CURVE(LinearInterpolation),
+    CURVE(QuadraticEaseIn), CURVE(QuadraticEaseOut), CURVE(QuadraticEaseInOut),
+    CURVE(CubicEaseIn), CURVE(CubicEaseOut), CURVE(CubicEaseInOut),
+    CURVE(QuarticEaseIn), CURVE(QuarticEaseOut), CURVE(QuarticEaseInOut),
+    CURVE(QuinticEaseIn), CURVE(QuinticEaseOut), CURVE(QuinticEaseInOut),
+    CURVE(SineEaseIn), CURVE(SineEaseOut), CURVE(SineEaseInOut),
+    CURVE(CircularEaseIn), CURVE(CircularEaseOut), CURVE(CircularEaseInOut),
+    CURVE(ExponentialEaseIn), CURVE(ExponentialEaseOut), CURVE(ExponentialEaseInOut),
+    CURVE(BackEaseIn), CURVE(BackEaseOut), CURVE(BackEaseInOut),
+    CURVE(ElasticEaseIn), CURVE(ElasticEaseOut), CURVE(ElasticEaseInOut),
+    CURVE(BounceEaseIn), CURVE(BounceEaseOut), CURVE(BounceEaseInOut),
+    CURVE(SlowMotion),
+};
+
+static const double tolerances[] = { 1e-2, 1e-3, 1e-4 };
+
+// the largest error of interpolating the keyframes linearly against `exact`,
+// the curve over GRID + 1 progress values
+static double interpolationError(const double *exact, const double *keyTimes, const double *progress, size_t count)
+{
+    double error = 0.0;
+    size_t segment = 0;
+    for (size_t i = 0; i <= GRID; ++i) {
+        const double t = (double)i / GRID;
+        while (segment + 2 < count && t > keyTimes[segment + 1]) {
+            ++segment;
+        }
+        const double t0 = keyTimes[segment], t1 = keyTimes[segment + 1];
+        const double value = progress[segment] + (progress[segment + 1] - progress[segment]) * (t - t0) / (t1 - t0);
+        error = fmax(error, fabs(value - exact[i]));
+    }
+    return error;
+}
+
+static double uniformError(TimelineAnimationSpecialTimingFunction function, const double *exact,
+                           size_t count, double *keyTimes, double *progress)
+{
+    for (size_t i = 0; i < count; ++i) {
+        keyTimes[i] = (double)i / (double)(count - 1);
+    }
+    TimelineAnimationKeyframeProgress(function, count, progress);
+    return interpolationError(exact, keyTimes, progress, count);
+}
+
+// the fewest evenly spaced keyframes within `error`, by bisection as the
+// error mostly shrinks with the count; 0 if more than CAPACITY
+static size_t uniformCountFor(TimelineAnimationSpecialTimingFunction function, const double *exact, double error,
+                              double *keyTimes, double *progress)
+{
+    size_t low = 2, high = CAPACITY;
+    if (uniformError(function, exact, low, keyTimes, progress) <= error) {
+        return low;
+    }
+    if (uniformError(function, exact, high, keyTimes, progress) > error) {
+        return 0;
+    }
+    while (high - low > 1) {
+        const size_t middle = (low + high) / 2;
+        if (uniformError(function, exact, middle, keyTimes, progress) <= error) {
+            high = middle;
+        }
+        else {
+            low = middle;
+        }
+    }
+    return high;
+}
+
+int main(void)
+{
+    double *const exact = malloc(sizeof(double) * (GRID + 1));
+    double *const keyTimes = malloc(sizeof(double) * CAPACITY);
+    double *const progress = malloc(sizeof(double) * CAPACITY);
+    int failures = 0;
+
+    printf("%-22s %10s", "curve", "60 error");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   %5s %9s %7s", "count", "error", "uniform");
+    }
+    printf("\n%-22s %10s", "", "");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   within %-16.0e", tolerances[e]);
+    }
+    printf("\n");
+
+    double adaptiveTotal[3] = { 0 };
+    double uniformTotal[3] = { 0 };
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        const TimelineAnimationSpecialTimingFunction function = curves[c].function;
+        for (size_t i = 0; i <= GRID; ++i) {
+            exact[i] = function((double)i / GRID);
+        }
+        printf("%-22s %10.1e", curves[c].name, uniformError(function, exact, UNIFORM, keyTimes, progress));
+
+        for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+            const size_t count = TimelineAnimationKeyframeAdaptiveProgress(function, tolerances[e], CAPACITY, keyTimes, progress);
+            const double error = (count >= 2) ? interpolationError(exact, keyTimes, progress, count) : INFINITY;
+            const int ok = (count >= 2) && keyTimes[0] == 0.0 && keyTimes[count - 1] == 1.0 && error <= tolerances[e];
+            failures += !ok;
+            const size_t uniform = uniformCountFor(function, exact, tolerances[e], keyTimes, progress);
+            adaptiveTotal[e] += (double)count;
+            uniformTotal[e] += (double)(uniform != 0 ? uniform : CAPACITY);
+            char uniformText[16];
+            snprintf(uniformText, sizeof(uniformText), uniform != 0 ? "%zu" : ">%zu", uniform != 0 ? uniform : (size_t)CAPACITY);
+            printf("   %5zu %9.2e %7s%s", count, error, uniformText, ok ? "" : " FAILED");
+        }
+        printf("\n");
+
+        // the capacity is enough down to 1e-5
+        if (TimelineAnimationKeyframeAdaptiveProgress(function, 1e-5, CAPACITY, keyTimes, progress) == 0) {
+            printf("%-22s does not fit in %d keyframes within 1e-5 FAILED\n", curves[c].name, CAPACITY);
+            ++failures;
+        }
+    }
+    printf("%-22s %10s", "total", "");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   %5.0f %9s %7.0f", adaptiveTotal[e], "", uniformTotal[e]);
+    }
+    printf("\n\n%d failures\n", failures);
+
+    free(progress);
+    free(keyTimes);
+    free(exact);
+    return failures == 0 ? 0 : 1;
+}
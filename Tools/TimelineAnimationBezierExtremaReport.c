@@ -0,0 +1,140 @@
+/*!
+ *  @file TimelineAnimationBezierExtremaReport.c
+ *  @brief TimelineAnimations
+ *
+ *  For the curves +[EasingTimingHandler isSpecialTimingFunction:] sends to
+ *  sampled keyframes, Elastic and Bounce, reports their representation by
+ *  TimelineAnimationCubicBezierFitExtremaSegments(): a keyframe at every
+ *  extremum and a cubic Bézier timing function per segment. For each curve:
+ *
+ *  - the number of extrema, segments and keyframes
+ *  - the maximum deviation from the analytic curve over 2^16 + 1 times, of
+ *    the segments and of the single precision control points Core Animation
+ *    is given, as the key times and values put them back in place
+ *  - the deviation of the 60 linearly interpolated keyframes used until now
+ *
+ *  Exits with 1 if a curve needs more than 16 keyframes, or deviates from
+ *  the analytic curve by more than twice the tolerance.
+ *
+ *      --tolerance E   maximum error of the segments, 1e-3 by default
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall \
+ *          -ITimelineAnimations/Classes/objc/EasingTiming \
+ *          -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationBezierExtremaReport.c \
+ *          TimelineAnimations/Classes/objc/EasingTiming/TimelineAnimationCubicBezierFit.c \
+ *          TimelineAnimations/Classes/objc/EasingTiming/TimelineAnimationCubicBezier.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          -lm -o /tmp/TimelineAnimationBezierExtremaReport && /tmp/TimelineAnimationBezierExtremaReport
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TimelineAnimationCubicBezierFit.h"
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#define MAX_SEGMENTS 64
+#define GRID (1 << 16)
+#define UNIFORM 60
+#define MAX_KEYFRAMES 16
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+} curves[] = {
+    { "ElasticIn", ElasticEaseIn }, { "ElasticOut", ElasticEaseOut }, { "ElasticInOut", ElasticEaseInOut },
+    { "BounceIn", BounceEaseIn }, { "BounceOut", BounceEaseOut }, { "BounceInOut", BounceEaseInOut },
+};
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// The segment as Core Animation runs it: its ends from the key times and
+// values, its shape from the single precision control points.
+static double renderedValue(const TimelineAnimationCubicBezierSegment *segment, double x)
+{
+    TimelineAnimationCubicBezierControlPoints points;
+    if (!TimelineAnimationCubicBezierSegmentControlPoints(segment, &points)) {
+        return segment->y0;
+    }
+    const double width = segment->x3 - segment->x0;
+    const double height = segment->y3 - segment->y0;
+    const TimelineAnimationCubicBezierSegment rendered = {
+        segment->x0, segment->y0,
+        segment->x0 + width * points.x1, segment->y0 + height * points.y1,
+        segment->x0 + width * points.x2, segment->y0 + height * points.y2,
+        segment->x3, segment->y3,
+    };
+    return TimelineAnimationCubicBezierSegmentEvaluate(&rendered, x);
+}
+
+int main(int argc, char **argv)
+{
+    double tolerance = 1e-3;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = strtod(argv[++i], NULL);
+        }
+        else {
+            fprintf(stderr, "usage: %s [--tolerance E]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("tolerance %.0e\n\n", tolerance);
+    printf("%-14s %7s %8s %9s %12s %12s %12s %10s\n",
+           "curve", "extrema", "segments", "keyframes", "segments err", "rendered err", "60 linear err", "fit ms");
+
+    int failures = 0;
+    TimelineAnimationCubicBezierSegment segments[MAX_SEGMENTS];
+    double extrema[TimelineAnimationCubicBezierFitExtremaCapacity];
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        const TimelineAnimationSpecialTimingFunction function = curves[c].function;
+        const size_t extremaCount = TimelineAnimationCubicBezierFitExtrema(function, extrema,
+                                                                           TimelineAnimationCubicBezierFitExtremaCapacity);
+        const double start = now();
+        const size_t count = TimelineAnimationCubicBezierFitExtremaSegments(function, tolerance, segments, MAX_SEGMENTS, NULL);
+        const double elapsed = (now() - start) / 1e6;
+
+        double segmentsError = 0.0, renderedError = 0.0, uniformError = 0.0;
+        size_t segment = 0;
+        for (int i = 0; i <= GRID; ++i) {
+            const double x = (double)i / GRID;
+            const double exact = function(x);
+            while (segment + 1 < count && x > segments[segment].x3) {
+                ++segment;
+            }
+            if (count != 0) {
+                segmentsError = fmax(segmentsError, fabs(TimelineAnimationCubicBezierSegmentEvaluate(&segments[segment], x) - exact));
+                renderedError = fmax(renderedError, fabs(renderedValue(&segments[segment], x) - exact));
+            }
+            const double position = x * (UNIFORM - 1);
+            const int frame = (position >= UNIFORM - 1) ? UNIFORM - 2 : (int)position;
+            const double f0 = function((double)frame / (UNIFORM - 1));
+            const double f1 = function((double)(frame + 1) / (UNIFORM - 1));
+            uniformError = fmax(uniformError, fabs(f0 + (f1 - f0) * (position - frame) - exact));
+        }
+
+        const size_t keyframes = count + 1;
+        const int ok = count != 0 && keyframes <= MAX_KEYFRAMES && renderedError <= 2.0 * tolerance;
+        failures += !ok;
+        printf("%-14s %7zu %8zu %9zu %12.2e %12.2e %12.2e %10.1f%s\n",
+               curves[c].name, extremaCount, count, keyframes, segmentsError, renderedError, uniformError, elapsed,
+               ok ? "" : " FAILED");
+    }
+    printf("\n%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,166 @@
+/*!
+ *  @file TimelineAnimationCubicBezierBenchmark.c
+ *  @brief TimelineAnimations
+ *
+ *  Reports the nanoseconds per evaluation of every ECustomTimingFunction:
+ *  the Bézier curves through TimelineAnimationCubicBezier.h, with and
+ *  without the sample table, one by one and in batch, and the Elastic and
+ *  Bounce curves through their C functions. It also reports the largest
+ *  difference with a reference solved by bisection to machine precision.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall \
+ *          -ITimelineAnimations/Classes/objc/EasingTiming \
+ *          -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationCubicBezierBenchmark.c \
+ *          TimelineAnimations/Classes/objc/EasingTiming/TimelineAnimationCubicBezier.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          -lm -o /tmp/TimelineAnimationCubicBezierBenchmark && /tmp/TimelineAnimationCubicBezierBenchmark
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "TimelineAnimationCubicBezier.h"
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#define SAMPLES 4096
+#define ROUNDS 200
+
+static const char *const names[TimelineAnimationCubicBezierControlPointsCount] = {
+    "Default", "Linear", "EaseIn", "EaseOut", "EaseInOut",
+    "SineIn", "SineOut", "SineInOut",
+    "QuadIn", "QuadOut", "QuadInOut",
+    "CubicIn", "CubicOut", "CubicInOut",
+    "QuartIn", "QuartOut", "QuartInOut",
+    "QuintIn", "QuintOut", "QuintInOut",
+    "ExpoIn", "ExpoOut", "ExpoInOut",
+    "CircIn", "CircOut", "CircInOut",
+    "BackIn", "BackOut", "BackInOut",
+    "ElasticIn", "ElasticOut", "ElasticInOut",
+    "BounceIn", "BounceOut", "BounceInOut",
+};
+
+static const TimelineAnimationSpecialTimingFunction specials[] = {
+    ElasticEaseIn, ElasticEaseOut, ElasticEaseInOut,
+    BounceEaseIn, BounceEaseOut, BounceEaseInOut,
+};
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// keeps the compiler from dropping the loops
+static volatile double sink;
+
+// y at time x, by bisection on the parameter until it cannot move anymore
+static double reference(TimelineAnimationCubicBezierControlPoints p, double x)
+{
+    const double x1 = p.x1, y1 = p.y1, x2 = p.x2, y2 = p.y2;
+    double low = 0.0, high = 1.0;
+    for (int i = 0; i < 200; ++i) {
+        const double t = 0.5 * (low + high);
+        const double u = 1.0 - t;
+        const double value = 3.0 * u * u * t * x1 + 3.0 * u * t * t * x2 + t * t * t;
+        if (value < x) {
+            low = t;
+        }
+        else {
+            high = t;
+        }
+    }
+    const double t = 0.5 * (low + high);
+    const double u = 1.0 - t;
+    return 3.0 * u * u * t * y1 + 3.0 * u * t * t * y2 + t * t * t;
+}
+
+static double single(const TimelineAnimationCubicBezier *bezier, const double *in, double *out)
+{
+    const double start = now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        for (size_t i = 0; i < SAMPLES; ++i) {
+            out[i] = TimelineAnimationCubicBezierSolve(bezier, in[i], TimelineAnimationCubicBezierDefaultEpsilon);
+        }
+        sink = out[r % SAMPLES];
+    }
+    return (now() - start) / ((double)ROUNDS * SAMPLES);
+}
+
+static double batch(const TimelineAnimationCubicBezier *bezier, const double *in, double *out)
+{
+    const double start = now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        TimelineAnimationCubicBezierSolveBatch(bezier, in, out, SAMPLES, TimelineAnimationCubicBezierDefaultEpsilon);
+        sink = out[r % SAMPLES];
+    }
+    return (now() - start) / ((double)ROUNDS * SAMPLES);
+}
+
+int main(void)
+{
+    double *const in = (double *)malloc(sizeof(double) * SAMPLES);
+    double *const out = (double *)malloc(sizeof(double) * SAMPLES);
+    if (in == NULL || out == NULL) {
+        return 1;
+    }
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        in[i] = (double)i / (SAMPLES - 1);
+    }
+
+    printf("%-13s %10s %10s %10s %10s %12s\n",
+           "function", "newton", "table", "batch", "tbl+batch", "max error");
+    for (unsigned long f = 0; f < TimelineAnimationCubicBezierControlPointsCount; ++f) {
+        TimelineAnimationCubicBezierControlPoints points;
+        if (!TimelineAnimationCubicBezierControlPointsFor(f, &points)) {
+            const TimelineAnimationSpecialTimingFunction function = specials[f - 29];
+            const double start = now();
+            for (int r = 0; r < ROUNDS; ++r) {
+                for (size_t i = 0; i < SAMPLES; ++i) {
+                    out[i] = function(in[i]);
+                }
+                sink = out[r % SAMPLES];
+            }
+            printf("%-13s %10.2f %10s %10s %10s %12s  (C function)\n",
+                   names[f], (now() - start) / ((double)ROUNDS * SAMPLES), "-", "-", "-", "-");
+            continue;
+        }
+
+        TimelineAnimationCubicBezier plain, tabulated;
+        TimelineAnimationCubicBezierInit(&plain, points, 0);
+        TimelineAnimationCubicBezierInit(&tabulated, points, 1);
+
+        const double newtonTime = single(&plain, in, out);
+        const double tableTime = single(&tabulated, in, out);
+        const double batchTime = batch(&plain, in, out);
+        const double tableBatchTime = batch(&tabulated, in, out);
+
+        double error = 0.0;
+        for (size_t i = 0; i < SAMPLES; ++i) {
+            const double expected = reference(points, in[i]);
+            const double a = fabs(TimelineAnimationCubicBezierSolve(&plain, in[i], TimelineAnimationCubicBezierDefaultEpsilon) - expected);
+            const double b = fabs(TimelineAnimationCubicBezierSolve(&tabulated, in[i], TimelineAnimationCubicBezierDefaultEpsilon) - expected);
+            error = fmax(error, fmax(a, b));
+        }
+        TimelineAnimationCubicBezierSolveBatch(&tabulated, in, out, SAMPLES, TimelineAnimationCubicBezierDefaultEpsilon);
+        for (size_t i = 0; i < SAMPLES; ++i) {
+            error = fmax(error, fabs(out[i] - reference(points, in[i])));
+        }
+
+        printf("%-13s %10.2f %10.2f %10.2f %10.2f %12.3e\n",
+               names[f], newtonTime, tableTime, batchTime, tableBatchTime, error);
+    }
+    printf("nanoseconds per evaluation, %d samples x %d rounds\n", SAMPLES, ROUNDS);
+
+    free(in);
+    free(out);
+    return 0;
+}
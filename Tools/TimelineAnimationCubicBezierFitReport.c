@@ -0,0 +1,159 @@
+/*!
+ *  @file TimelineAnimationCubicBezierFitReport.c
+ *  @brief TimelineAnimations
+ *
+ *  For every ECustomTimingFunction backed by a curve of
+ *  TimelineAnimationSpecialTimingFunction.h, reports:
+ *
+ *  - the error of the control points of TimelineAnimationCubicBezier.c, the
+ *    ones +[EasingTimingHandler functionWithType:] hands to Core Animation
+ *  - the least-squares single Bézier curve and its error
+ *  - the fewest Bézier segments found within the tolerance, as the key
+ *    times and timing functions of a keyframe animation would use them
+ *
+ *  Errors are in progress units, maximum and RMS over 1025 times per segment.
+ *
+ *      --tolerance E   maximum error of the segments, 1e-3 by default
+ *      --segments      also print the control points of every segment
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall \
+ *          -ITimelineAnimations/Classes/objc/EasingTiming \
+ *          -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationCubicBezierFitReport.c \
+ *          TimelineAnimations/Classes/objc/EasingTiming/TimelineAnimationCubicBezierFit.c \
+ *          TimelineAnimations/Classes/objc/EasingTiming/TimelineAnimationCubicBezier.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          -lm -o /tmp/TimelineAnimationCubicBezierFitReport && /tmp/TimelineAnimationCubicBezierFitReport
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "TimelineAnimationCubicBezier.h"
+#include "TimelineAnimationCubicBezierFit.h"
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#define MAX_SEGMENTS 64
+#define ERROR_SAMPLES 1024
+
+// the ECustomTimingFunction raw values from SineIn on
+#define FIRST_FUNCTION 5
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+} curves[] = {
+    { "SineIn", SineEaseIn }, { "SineOut", SineEaseOut }, { "SineInOut", SineEaseInOut },
+    { "QuadIn", QuadraticEaseIn }, { "QuadOut", QuadraticEaseOut }, { "QuadInOut", QuadraticEaseInOut },
+    { "CubicIn", CubicEaseIn }, { "CubicOut", CubicEaseOut }, { "CubicInOut", CubicEaseInOut },
+    { "QuartIn", QuarticEaseIn }, { "QuartOut", QuarticEaseOut }, { "QuartInOut", QuarticEaseInOut },
+    { "QuintIn", QuinticEaseIn }, { "QuintOut", QuinticEaseOut }, { "QuintInOut", QuinticEaseInOut },
+    { "ExpoIn", ExponentialEaseIn }, { "ExpoOut", ExponentialEaseOut }, { "ExpoInOut", ExponentialEaseInOut },
+    { "CircIn", CircularEaseIn }, { "CircOut", CircularEaseOut }, { "CircInOut", CircularEaseInOut },
+    { "BackIn", BackEaseIn }, { "BackOut", BackEaseOut }, { "BackInOut", BackEaseInOut },
+    { "ElasticIn", ElasticEaseIn }, { "ElasticOut", ElasticEaseOut }, { "ElasticInOut", ElasticEaseInOut },
+    { "BounceIn", BounceEaseIn }, { "BounceOut", BounceEaseOut }, { "BounceInOut", BounceEaseInOut },
+};
+
+// the error of the control points Core Animation is given today
+static int tableError(unsigned long timingFunction,
+                      TimelineAnimationSpecialTimingFunction function,
+                      TimelineAnimationCubicBezierFitError *error)
+{
+    TimelineAnimationCubicBezierControlPoints points;
+    if (!TimelineAnimationCubicBezierControlPointsFor(timingFunction, &points)) {
+        return 0;
+    }
+    TimelineAnimationCubicBezier bezier;
+    TimelineAnimationCubicBezierInit(&bezier, points, 0);
+    double maximum = 0.0;
+    double squared = 0.0;
+    for (int i = 0; i <= ERROR_SAMPLES; ++i) {
+        const double x = (double)i / ERROR_SAMPLES;
+        const double difference = fabs(TimelineAnimationCubicBezierSolve(&bezier, x, 1e-12) - function(x));
+        maximum = fmax(maximum, difference);
+        squared += difference * difference;
+    }
+    error->maximumError = maximum;
+    error->rmsError = sqrt(squared / (ERROR_SAMPLES + 1));
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    double tolerance = 1e-3;
+    int printSegments = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = strtod(argv[++i], NULL);
+        }
+        else if (strcmp(argv[i], "--segments") == 0) {
+            printSegments = 1;
+        }
+        else {
+            fprintf(stderr, "usage: %s [--tolerance E] [--segments]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (!(tolerance > 0.0)) {
+        fprintf(stderr, "%s: the tolerance must be positive\n", argv[0]);
+        return 2;
+    }
+
+    printf("%-13s %21s   %-38s %21s   %21s\n",
+           "", "current table", "", "least-squares fit", "segments");
+    printf("%-13s %10s %10s   %-38s %10s %10s   %4s %10s %10s\n",
+           "function", "max", "rms", "control points", "max", "rms", "n", "max", "rms");
+
+    TimelineAnimationCubicBezierSegment segments[MAX_SEGMENTS];
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        const TimelineAnimationSpecialTimingFunction function = curves[c].function;
+
+        char current[32] = "-";
+        TimelineAnimationCubicBezierFitError table;
+        if (tableError(FIRST_FUNCTION + c, function, &table)) {
+            snprintf(current, sizeof(current), "%10.2e %10.2e", table.maximumError, table.rmsError);
+        }
+
+        TimelineAnimationCubicBezierSegment single;
+        TimelineAnimationCubicBezierFitError singleError;
+        TimelineAnimationCubicBezierFitSegment(function, 0.0, 1.0, &single, &singleError);
+        char points[48];
+        snprintf(points, sizeof(points), "(%.4f, %.4f, %.4f, %.4f)", single.x1, single.y1, single.x2, single.y2);
+
+        TimelineAnimationCubicBezierFitError splitError;
+        const size_t count = TimelineAnimationCubicBezierFitSegments(function, tolerance, segments, MAX_SEGMENTS, &splitError);
+
+        printf("%-13s %21s   %-38s %10.2e %10.2e   ",
+               curves[c].name, current, points, singleError.maximumError, singleError.rmsError);
+        if (count == 0) {
+            printf("%4s\n", ">64");
+            continue;
+        }
+        printf("%4zu %10.2e %10.2e\n", count, splitError.maximumError, splitError.rmsError);
+
+        if (printSegments && count > 1) {
+            for (size_t s = 0; s < count; ++s) {
+                TimelineAnimationCubicBezierControlPoints normalized;
+                printf("    keyTime %.6f value %+.6f", segments[s].x0, segments[s].y0);
+                if (TimelineAnimationCubicBezierSegmentControlPoints(&segments[s], &normalized)) {
+                    printf("  timing (%.4f, %.4f, %.4f, %.4f)\n",
+                           (double)normalized.x1, (double)normalized.y1, (double)normalized.x2, (double)normalized.y2);
+                }
+                else {
+                    printf("  flat\n");
+                }
+            }
+            printf("    keyTime %.6f value %+.6f\n", 1.0, function(1.0));
+        }
+    }
+    printf("tolerance %.1e\n", tolerance);
+    return 0;
+}
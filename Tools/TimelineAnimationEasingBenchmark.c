@@ -0,0 +1,281 @@
+/*!
+ *  @file TimelineAnimationEasingBenchmark.c
+ *  @brief TimelineAnimations
+ *
+ *  Measures the easing layer without Foundation: every curve of
+ *  TimelineAnimationSpecialTimingFunction.h, for every keyframe count from 2
+ *  to 1024, through four paths:
+ *
+ *  - scalar:  the per-frame loop the keyframe animations used to run
+ *  - batch:   TimelineAnimationKeyframeProgress(), double precision kernels
+ *  - batchF:  TimelineAnimationKeyframeProgressF(), single precision kernels
+ *  - numbers: TimelineAnimationKeyframeNumbers(), the values boxed by
+ *             +[CAKeyframeAnimation numberValuesFunction:from:to:keyframeCount:]
+ *
+ *  Every measurement is the fastest of 5 runs of at least 20 microseconds.
+ *  The results go to the standard output, one row per curve, keyframe count
+ *  and path, as CSV (the default) or JSON, so that releases can be compared
+ *  with any spreadsheet or script, or as a summary table of the speedup of
+ *  the batch paths over the scalar one for each family of curves, over all
+ *  the keyframe counts measured.
+ *
+ *      --format csv|json|summary   output format
+ *      --from N --to N     keyframe counts, 2 and 1024 by default
+ *      --step N            keyframe count increment, 1 by default
+ *      --curve NAME        only the curve NAME, e.g. BounceEaseOut
+ *      --isa NAME          portable, sse2, avx2 or neon instead of the best
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationEasingBenchmark.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframes.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationTransformInterpolation.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationEasingBenchmark \
+ *          && /tmp/TimelineAnimationEasingBenchmark --format csv > /tmp/easing.csv
+ *
+ *  or, for the speedups at 1024 keyframes:
+ *
+ *      /tmp/TimelineAnimationEasingBenchmark --format summary --from 1024
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TimelineAnimationKeyframes.h"
+#include "TimelineAnimationSpecialTimingFunctionBatch.h"
+
+#define MAX_KEYFRAMES 1024
+#define RUNS 5
+#define MIN_RUN_NS 20000.0
+
+#define CURVE(family, name) { #family, #name, name, name##F }
+
+static const struct {
+    const char *family;
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+    TimelineAnimationSpecialTimingFunctionF functionF;
+} curves[] = {
+    CURVE(Linear, LinearInterpolation),
+    CURVE(Quadratic, QuadraticEaseIn), CURVE(Quadratic, QuadraticEaseOut), CURVE(Quadratic, QuadraticEaseInOut),
+    CURVE(Cubic, CubicEaseIn), CURVE(Cubic, CubicEaseOut), CURVE(Cubic, CubicEaseInOut),
+    CURVE(Quartic, QuarticEaseIn), CURVE(Quartic, QuarticEaseOut), CURVE(Quartic, QuarticEaseInOut),
+    CURVE(Quintic, QuinticEaseIn), CURVE(Quintic, QuinticEaseOut), CURVE(Quintic, QuinticEaseInOut),
+    CURVE(Sine, SineEaseIn), CURVE(Sine, SineEaseOut), CURVE(Sine, SineEaseInOut),
+    CURVE(Circular, CircularEaseIn), CURVE(Circular, CircularEaseOut), CURVE(Circular, CircularEaseInOut),
+    CURVE(Exponential, ExponentialEaseIn), CURVE(Exponential, ExponentialEaseOut), CURVE(Exponential, ExponentialEaseInOut),
+    CURVE(Back, BackEaseIn), CURVE(Back, BackEaseOut), CURVE(Back, BackEaseInOut),
+    CURVE(Elastic, ElasticEaseIn), CURVE(Elastic, ElasticEaseOut), CURVE(Elastic, ElasticEaseInOut),
+    CURVE(Bounce, BounceEaseIn), CURVE(Bounce, BounceEaseOut), CURVE(Bounce, BounceEaseInOut),
+    CURVE(SlowMotion, SlowMotion),
+};
+
+static const struct {
+    const char *name;
+    TimelineAnimationBatchISA isa;
+} isas[] = {
+    { "portable", TimelineAnimationBatchISAPortable },
+    { "sse2", TimelineAnimationBatchISASSE2 },
+    { "avx2", TimelineAnimationBatchISAAVX2 },
+    { "neon", TimelineAnimationBatchISANEON },
+};
+
+typedef enum {
+    PathScalar = 0,
+    PathBatch,
+    PathBatchF,
+    PathNumbers,
+    PathCount
+} Path;
+
+static const char *const pathNames[PathCount] = { "scalar", "batch", "batchF", "numbers" };
+
+static double progress[MAX_KEYFRAMES];
+static float progressF[MAX_KEYFRAMES];
+
+// keeps the compiler from dropping the loops
+static volatile double sink;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void run(Path path, size_t c, size_t keyframeCount, long iterations)
+{
+    for (long i = 0; i < iterations; ++i) {
+        switch (path) {
+            case PathScalar: {
+                double t = 0.0;
+                const double dt = 1.0 / (keyframeCount - 1);
+                for (size_t frame = 0; frame < keyframeCount; ++frame, t += dt) {
+                    progress[frame] = curves[c].function(t);
+                }
+                sink = progress[keyframeCount - 1];
+                break;
+            }
+            case PathBatch:
+                TimelineAnimationKeyframeProgress(curves[c].function, keyframeCount, progress);
+                sink = progress[keyframeCount - 1];
+                break;
+            case PathBatchF:
+                TimelineAnimationKeyframeProgressF(curves[c].functionF, keyframeCount, progressF);
+                sink = progressF[keyframeCount - 1];
+                break;
+            case PathNumbers:
+                TimelineAnimationKeyframeNumbers(curves[c].function, 10.0, 250.0, keyframeCount, progressF);
+                sink = progressF[keyframeCount - 1];
+                break;
+            case PathCount:
+                break;
+        }
+    }
+}
+
+// nanoseconds per call, the fastest of RUNS runs
+static double measure(Path path, size_t c, size_t keyframeCount)
+{
+    long iterations = 1;
+    double elapsed;
+    for (;;) {
+        const double start = now();
+        run(path, c, keyframeCount, iterations);
+        elapsed = now() - start;
+        if (elapsed >= MIN_RUN_NS) {
+            break;
+        }
+        iterations *= 2;
+    }
+    double best = elapsed / iterations;
+    for (int r = 1; r < RUNS; ++r) {
+        const double start = now();
+        run(path, c, keyframeCount, iterations);
+        const double time = (now() - start) / iterations;
+        best = (time < best) ? time : best;
+    }
+    return best;
+}
+
+static int usage(const char *program)
+{
+    fprintf(stderr, "usage: %s [--format csv|json|summary] [--from N] [--to N] [--step N] [--curve NAME] [--isa NAME]\n", program);
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    int json = 0;
+    int summary = 0;
+    long from = 2, to = MAX_KEYFRAMES, step = 1;
+    const char *onlyCurve = NULL;
+    for (int i = 1; i < argc; ++i) {
+        const char *const option = argv[i];
+        const char *const value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (value == NULL) {
+            return usage(argv[0]);
+        }
+        ++i;
+        if (strcmp(option, "--format") == 0) {
+            if (strcmp(value, "json") != 0 && strcmp(value, "csv") != 0 && strcmp(value, "summary") != 0) {
+                return usage(argv[0]);
+            }
+            json = (strcmp(value, "json") == 0);
+            summary = (strcmp(value, "summary") == 0);
+        }
+        else if (strcmp(option, "--from") == 0) {
+            from = strtol(value, NULL, 10);
+        }
+        else if (strcmp(option, "--to") == 0) {
+            to = strtol(value, NULL, 10);
+        }
+        else if (strcmp(option, "--step") == 0) {
+            step = strtol(value, NULL, 10);
+        }
+        else if (strcmp(option, "--curve") == 0) {
+            onlyCurve = value;
+        }
+        else if (strcmp(option, "--isa") == 0) {
+            size_t s = 0;
+            while (s < sizeof(isas) / sizeof(isas[0]) && strcmp(isas[s].name, value) != 0) {
+                ++s;
+            }
+            if (s == sizeof(isas) / sizeof(isas[0]) || !TimelineAnimationBatchSetISA(isas[s].isa)) {
+                fprintf(stderr, "%s: instruction set %s is not available\n", argv[0], value);
+                return 1;
+            }
+        }
+        else {
+            return usage(argv[0]);
+        }
+    }
+    if (from < 2 || to > MAX_KEYFRAMES || from > to || step < 1) {
+        return usage(argv[0]);
+    }
+
+    const char *isa = "unknown";
+    for (size_t s = 0; s < sizeof(isas) / sizeof(isas[0]); ++s) {
+        if (isas[s].isa == TimelineAnimationBatchCurrentISA()) {
+            isa = isas[s].name;
+        }
+    }
+
+    if (json) {
+        printf("{\n  \"isa\": \"%s\",\n  \"results\": [", isa);
+    }
+    else if (summary) {
+        printf("%-12s %10s %10s %10s %10s %8s %8s\n",
+               isa, "scalar", "batch", "batchF", "numbers", "batch", "batchF");
+    }
+    else {
+        printf("isa,curve,keyframes,path,ns_per_call,ns_per_keyframe\n");
+    }
+    int first = 1;
+    // ns per keyframe of the current family, for the summary
+    double totals[PathCount] = { 0.0 };
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        if (onlyCurve != NULL && strcmp(onlyCurve, curves[c].name) != 0) {
+            continue;
+        }
+        for (long keyframeCount = from; keyframeCount <= to; keyframeCount += step) {
+            for (int path = 0; path < PathCount; ++path) {
+                const double time = measure((Path)path, c, (size_t)keyframeCount);
+                if (json) {
+                    printf("%s\n    {\"curve\": \"%s\", \"keyframes\": %ld, \"path\": \"%s\", "
+                           "\"ns_per_call\": %.2f, \"ns_per_keyframe\": %.4f}",
+                           first ? "" : ",", curves[c].name, keyframeCount, pathNames[path],
+                           time, time / keyframeCount);
+                }
+                else if (summary) {
+                    totals[path] += time / keyframeCount;
+                }
+                else {
+                    printf("%s,%s,%ld,%s,%.2f,%.4f\n",
+                           isa, curves[c].name, keyframeCount, pathNames[path], time, time / keyframeCount);
+                }
+                first = 0;
+            }
+        }
+        const int lastOfFamily = (c + 1 == sizeof(curves) / sizeof(curves[0]) ||
+                                  strcmp(curves[c + 1].family, curves[c].family) != 0);
+        if (summary && lastOfFamily && totals[PathScalar] > 0.0) {
+            printf("%-12s %10.3f %10.3f %10.3f %10.3f %7.2fx %7.2fx\n",
+                   curves[c].family, totals[PathScalar], totals[PathBatch], totals[PathBatchF], totals[PathNumbers],
+                   totals[PathScalar] / totals[PathBatch], totals[PathScalar] / totals[PathBatchF]);
+            memset(totals, 0, sizeof(totals));
+        }
+    }
+    if (json) {
+        printf("\n  ]\n}\n");
+    }
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*!
+ *  @file TimelineAnimationEasingExpressionBenchmark.c
+ *  @brief TimelineAnimations
+ *
+ *  Builds with TimelineAnimationEasingExpression.h curves that already exist
+ *  as C functions, checks that both agree, and reports the nanoseconds per
+ *  evaluation of the compiled programs next to the C functions, in batch.
+ *  Exits with a non zero status if a program differs from its function by
+ *  more than 1e-12, or by more than 2e-9 for the Sine, Back and Elastic
+ *  curves, whose batch kernels approximate sin and 2^x within the bounds of
+ *  TimelineAnimationSpecialTimingFunctionBatch.h.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall \
+ *          -ITimelineAnimations/Classes/objc/EasingTiming \
+ *          -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationEasingExpressionBenchmark.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationEasingExpression.c \
+ *          TimelineAnimations/Classes/objc/EasingTiming/TimelineAnimationCubicBezier.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationEasingExpressionBenchmark \
+ *          && /tmp/TimelineAnimationEasingExpressionBenchmark
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "TimelineAnimationEasingExpression.h"
+#include "TimelineAnimationSpecialTimingFunctionBatch.h"
+
+#define SAMPLES 4096
+#define ROUNDS 500
+#define TOLERANCE 1e-12
+#define APPROXIMATE_TOLERANCE 2e-9
+
+// keeps the compiler from dropping the loops
+static volatile double sink;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// the mirrored, repeated and clamped curves written by hand
+static double BounceTwice(double p)
+{
+    const double u = 2 * p;
+    return BounceEaseOut((u > 0.0) ? u - ceil(u) + 1.0 : u);
+}
+
+static double BackInClamped(double p)
+{
+    return fmax(BackEaseIn(p), 0.0);
+}
+
+static double SineBlend(double p)
+{
+    return 0.75 * SineEaseInOut(p) + 0.25 * LinearInterpolation(p);
+}
+
+static int compare(const char *name,
+                   TimelineAnimationSpecialTimingFunction function,
+                   const TimelineAnimationEasingExpression *expression,
+                   TimelineAnimationEasingNode root,
+                   double tolerance,
+                   const double *in,
+                   double *out)
+{
+    static TimelineAnimationEasingProgram program;
+    if (!TimelineAnimationEasingCompile(expression, root, &program)) {
+        printf("%-28s does not compile\n", name);
+        return 1;
+    }
+
+    double error = 0.0;
+    TimelineAnimationEasingProgramEvaluateBatch(&program, in, out, SAMPLES);
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        error = fmax(error, fabs(out[i] - function(in[i])));
+        error = fmax(error, fabs(TimelineAnimationEasingProgramEvaluate(&program, in[i]) - out[i]));
+    }
+
+    double start = now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        TimelineAnimationSpecialTimingFunctionEvaluateBatch(function, in, out, SAMPLES);
+        sink = out[r % SAMPLES];
+    }
+    const double functionTime = (now() - start) / ((double)ROUNDS * SAMPLES);
+
+    start = now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        TimelineAnimationEasingProgramEvaluateBatch(&program, in, out, SAMPLES);
+        sink = out[r % SAMPLES];
+    }
+    const double programTime = (now() - start) / ((double)ROUNDS * SAMPLES);
+
+    printf("%-28s %6d %10.2f %10.2f %8.2fx %12.3e\n",
+           name, program.count, functionTime, programTime, programTime / functionTime, error);
+    return error > tolerance;
+}
+
+int main(void)
+{
+    double *const in = (double *)malloc(sizeof(double) * SAMPLES);
+    double *const out = (double *)malloc(sizeof(double) * SAMPLES);
+    if (in == NULL || out == NULL) {
+        return 1;
+    }
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        in[i] = (double)i / (SAMPLES - 1);
+    }
+
+    TimelineAnimationEasingExpression expression;
+    int failures = 0;
+    printf("%-28s %6s %10s %10s %9s %12s\n", "curve", "ops", "C ns", "program ns", "ratio", "max error");
+
+    TimelineAnimationEasingExpressionInit(&expression);
+    failures += compare("QuadraticEaseOut = mirror", QuadraticEaseOut, &expression,
+                        TimelineAnimationEasingMirror(&expression, TimelineAnimationEasingCurve(&expression, QuadraticEaseIn)),
+                        TOLERANCE, in, out);
+
+    TimelineAnimationEasingExpressionInit(&expression);
+    failures += compare("CubicEaseIn = reverse twice", CubicEaseIn, &expression,
+                        TimelineAnimationEasingReverse(&expression,
+                            TimelineAnimationEasingReverse(&expression, TimelineAnimationEasingCurve(&expression, CubicEaseIn))),
+                        TOLERANCE, in, out);
+
+    TimelineAnimationEasingExpressionInit(&expression);
+    {
+        const TimelineAnimationEasingNode easeIn = TimelineAnimationEasingCurve(&expression, QuadraticEaseIn);
+        const TimelineAnimationEasingNode easeOut = TimelineAnimationEasingCurve(&expression, QuadraticEaseOut);
+        failures += compare("QuadraticEaseInOut = concat", QuadraticEaseInOut, &expression,
+                            TimelineAnimationEasingConcatenate(&expression, easeIn, easeOut, 0.5, 0.5),
+                            TOLERANCE, in, out);
+    }
+
+    TimelineAnimationEasingExpressionInit(&expression);
+    {
+        const TimelineAnimationEasingNode sine = TimelineAnimationEasingCurve(&expression, SineEaseInOut);
+        const TimelineAnimationEasingNode linear = TimelineAnimationEasingCurve(&expression, LinearInterpolation);
+        failures += compare("SineBlend = blend", SineBlend, &expression,
+                            TimelineAnimationEasingBlend(&expression, sine, linear, 0.25),
+                            APPROXIMATE_TOLERANCE, in, out);
+    }
+
+    TimelineAnimationEasingExpressionInit(&expression);
+    failures += compare("BackInClamped = clamp", BackInClamped, &expression,
+                        TimelineAnimationEasingClamp(&expression, TimelineAnimationEasingCurve(&expression, BackEaseIn), 0.0, INFINITY),
+                        APPROXIMATE_TOLERANCE, in, out);
+
+    TimelineAnimationEasingExpressionInit(&expression);
+    failures += compare("BounceTwice = repeat", BounceTwice, &expression,
+                        TimelineAnimationEasingRepeat(&expression, TimelineAnimationEasingCurve(&expression, BounceEaseOut), 2.0),
+                        TOLERANCE, in, out);
+
+    // 16 levels of mirrors, folded into the time of the curve
+    TimelineAnimationEasingExpressionInit(&expression);
+    {
+        TimelineAnimationEasingNode node = TimelineAnimationEasingCurve(&expression, ElasticEaseOut);
+        for (int i = 0; i < 16; ++i) {
+            node = TimelineAnimationEasingMirror(&expression, node);
+        }
+        failures += compare("ElasticEaseOut = 16 mirrors", ElasticEaseOut, &expression, node, APPROXIMATE_TOLERANCE, in, out);
+    }
+
+    // 17 values on the stack, too deep to compile
+    TimelineAnimationEasingExpressionInit(&expression);
+    {
+        const TimelineAnimationEasingNode linear = TimelineAnimationEasingCurve(&expression, LinearInterpolation);
+        TimelineAnimationEasingNode node = linear;
+        for (int i = 0; i < 16; ++i) {
+            node = TimelineAnimationEasingBlend(&expression, linear, node, 0.5);
+        }
+        TimelineAnimationEasingProgram program;
+        const int compiled = TimelineAnimationEasingCompile(&expression, node, &program);
+        printf("17 nested blends %s\n", compiled ? "COMPILE" : "are rejected");
+        failures += compiled;
+    }
+
+    printf("nanoseconds per evaluation in batch, %d samples x %d rounds\n", SAMPLES, ROUNDS);
+    printf("%d failure(s)\n", failures);
+
+    free(in);
+    free(out);
+    return failures ? 1 : 0;
+}
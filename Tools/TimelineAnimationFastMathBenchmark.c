@@ -0,0 +1,95 @@
+/*!
+ *  @file TimelineAnimationFastMathBenchmark.c
+ *  @brief TimelineAnimations
+ *
+ *  Compares the fast curves of TimelineAnimationSpecialTimingFunctionFast.h
+ *  with the libm based ones of TimelineAnimationSpecialTimingFunction.h: the
+ *  nanoseconds per evaluation of both, and the maximum absolute error of the
+ *  fast curves over 2^22 + 1 progress values.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationFastMathBenchmark.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionFast.c \
+ *          -lm -o /tmp/TimelineAnimationFastMathBenchmark && /tmp/TimelineAnimationFastMathBenchmark
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+#include "TimelineAnimationSpecialTimingFunctionFast.h"
+
+#define GRID ((size_t)1 << 22)
+#define SAMPLES 4096
+#define ROUNDS 500
+
+#define CURVE(name) { #name, name, name##Fast }
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction exact;
+    TimelineAnimationSpecialTimingFunction fast;
+} curves[] = {
+    CURVE(SineEaseIn), CURVE(SineEaseOut), CURVE(SineEaseInOut),
+    CURVE(ExponentialEaseIn), CURVE(ExponentialEaseOut), CURVE(ExponentialEaseInOut),
+    CURVE(ElasticEaseIn), CURVE(ElasticEaseOut), CURVE(ElasticEaseInOut),
+    CURVE(BounceEaseIn), CURVE(BounceEaseOut), CURVE(BounceEaseInOut),
+};
+
+// keeps the compiler from dropping the loops
+static volatile double sink;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static double measure(TimelineAnimationSpecialTimingFunction function, const double *in, double *out)
+{
+    const double start = now();
+    for (int r = 0; r < ROUNDS; ++r) {
+        for (size_t i = 0; i < SAMPLES; ++i) {
+            out[i] = function(in[i]);
+        }
+        sink = out[r % SAMPLES];
+    }
+    return (now() - start) / ((double)ROUNDS * SAMPLES);
+}
+
+int main(void)
+{
+    double in[SAMPLES];
+    double out[SAMPLES];
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        in[i] = (double)i / (SAMPLES - 1);
+    }
+
+    printf("%-22s %10s %10s %8s %12s %12s\n", "curve", "libm ns", "fast ns", "speedup", "max error", "at");
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        double error = 0.0;
+        double at = 0.0;
+        for (size_t i = 0; i <= GRID; ++i) {
+            const double p = (double)i / (double)GRID;
+            const double e = fabs(curves[c].fast(p) - curves[c].exact(p));
+            if (!(e <= error)) {
+                error = e;
+                at = p;
+            }
+        }
+        const double exact = measure(curves[c].exact, in, out);
+        const double fast = measure(curves[c].fast, in, out);
+        printf("%-22s %10.2f %10.2f %7.2fx %12.3e %12.8f\n",
+               curves[c].name, exact, fast, exact / fast, error, at);
+    }
+    return 0;
+}
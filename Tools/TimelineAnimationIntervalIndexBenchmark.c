@@ -0,0 +1,292 @@
+/*!
+ *  @file TimelineAnimationIntervalIndexBenchmark.c
+ *  @brief TimelineAnimations
+ *
+ *  Checks TimelineAnimationIntervalIndex.h against the comparison of
+ *  -[TimelineEntity conflictingWith:], written out here, then times building
+ *  timelines of 10 to 100,000 entities both ways:
+ *
+ *  - for random intervals over a few keys, many of them conflicting and
+ *    empty, the index finds a conflict for an interval exactly when one of
+ *    those inserted before conflicts with it or begins at the same time,
+ *    also once they are all shifted, as -[TimelineAnimation delay:] does
+ *  - the sweep of two sets of intervals finds a conflict exactly when one of
+ *    the pairs conflicts
+ *  - finding the conflicts of a set reports exactly the intervals that
+ *    conflict with one before them, by begin time and then as given, each
+ *    with such an interval
+ *
+ *  The timings add entities that do not conflict, a few animations of each
+ *  of a hundred layers one after the other, as -[TimelineAnimation
+ *  _addTimelineEntity:] does: looking for a conflict with every entity added
+ *  so far, comparing keys as numbers rather than the strings it compares,
+ *  against the index, and against adding them all unchecked and finding the
+ *  conflicts once, as -[TimelineAnimation performBatchUpdates:error:] does.
+ *  Then they check a timeline against another of as many entities, every
+ *  pair against the sweep.
+ *
+ *  Exits with 1 if a check fails.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/Helper \
+ *          Tools/TimelineAnimationIntervalIndexBenchmark.c \
+ *          TimelineAnimations/Classes/objc/Helper/TimelineAnimationIntervalIndex.c \
+ *          -o /tmp/TimelineAnimationIntervalIndexBenchmark && /tmp/TimelineAnimationIntervalIndexBenchmark
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "TimelineAnimationIntervalIndex.h"
+
+static const size_t counts[] = { 10, 100, 1000, 10000, 100000 };
+
+// keeps the compiler from dropping the loops
+static volatile int sink;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// -[TimelineEntity conflictingWith:]
+static int conflicting(const TimelineAnimationInterval *a, const TimelineAnimationInterval *b)
+{
+    if (a->key != b->key) {
+        return 0;
+    }
+    return ((a->begin >= b->begin) && (a->begin < b->end)) || ((b->begin >= a->begin) && (b->begin < a->end));
+}
+
+static TimelineAnimationInterval randomInterval(size_t keys, int64_t span)
+{
+    TimelineAnimationInterval interval;
+    interval.key = (size_t)rand() % keys;
+    interval.begin = (int64_t)(rand() % (int)span);
+    // a fifth of them empty
+    interval.end = interval.begin + ((rand() % 5 == 0) ? 0 : 1 + rand() % 40);
+    return interval;
+}
+
+static int checkIndex(void)
+{
+    int failures = 0;
+    size_t conflicts = 0, checks = 0;
+    TimelineAnimationInterval inserted[400];
+    for (int round = 0; round < 200; ++round) {
+        TimelineAnimationIntervalIndex *const index = TimelineAnimationIntervalIndexCreate();
+        const size_t keys = 1 + (size_t)(round % 7);
+        const int64_t span = 50 + 20 * round;
+        size_t count = 0;
+        for (size_t i = 0; i < 400; ++i) {
+            const TimelineAnimationInterval interval = randomInterval(keys, span);
+            int expected = 0;
+            for (size_t j = 0; j < count; ++j) {
+                expected |= conflicting(&inserted[j], &interval)
+                    || (inserted[j].key == interval.key && inserted[j].begin == interval.begin);
+            }
+            const int found = TimelineAnimationIntervalIndexMayConflict(index, &interval);
+            failures += (found != expected);
+            conflicts += (size_t)expected;
+            ++checks;
+            // as a timeline, which adds an entity only if it does not conflict,
+            // and as the index alone
+            if (!expected || round % 2 == 0) {
+                TimelineAnimationIntervalIndexInsert(index, &interval);
+                inserted[count++] = interval;
+            }
+        }
+        failures += (TimelineAnimationIntervalIndexCount(index) != count);
+
+        // earlier and later
+        const int64_t shift = (round % 2 == 0) ? -(int64_t)(rand() % 100) : (int64_t)(rand() % 100);
+        TimelineAnimationIntervalIndexShift(index, shift);
+        for (size_t j = 0; j < count; ++j) {
+            inserted[j].begin += shift;
+            inserted[j].end += shift;
+        }
+        for (size_t i = 0; i < 100; ++i) {
+            TimelineAnimationInterval interval = randomInterval(keys, span);
+            interval.begin += shift;
+            interval.end += shift;
+            int expected = 0;
+            for (size_t j = 0; j < count; ++j) {
+                expected |= conflicting(&inserted[j], &interval)
+                    || (inserted[j].key == interval.key && inserted[j].begin == interval.begin);
+            }
+            failures += (TimelineAnimationIntervalIndexMayConflict(index, &interval) != expected);
+            conflicts += (size_t)expected;
+            ++checks;
+        }
+
+        TimelineAnimationIntervalIndexRemoveAll(index);
+        failures += (TimelineAnimationIntervalIndexCount(index) != 0);
+        failures += TimelineAnimationIntervalIndexMayConflict(index, &inserted[0]);
+        TimelineAnimationIntervalIndexDestroy(index);
+    }
+    printf("index, %zu intervals, %zu of them conflicting: %s\n", checks, conflicts, failures ? "FAILED" : "ok");
+    return failures;
+}
+
+static int checkSweep(void)
+{
+    int failures = 0;
+    size_t conflicts = 0;
+    TimelineAnimationInterval first[60], second[60];
+    for (int round = 0; round < 20000; ++round) {
+        const size_t keys = 1 + (size_t)(round % 5);
+        const int64_t span = 20 + round % 400;
+        const size_t count = (size_t)(rand() % 60), otherCount = (size_t)(rand() % 60);
+        for (size_t i = 0; i < count; ++i) {
+            first[i] = randomInterval(keys, span);
+        }
+        for (size_t i = 0; i < otherCount; ++i) {
+            second[i] = randomInterval(keys, span);
+        }
+        int expected = 0;
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t j = 0; j < otherCount; ++j) {
+                expected |= conflicting(&first[i], &second[j]);
+            }
+        }
+        conflicts += (size_t)expected;
+        failures += (TimelineAnimationIntervalsConflict(first, count, second, otherCount) != expected);
+    }
+    printf("sweep, 20000 pairs of sets, %zu of them conflicting: %s\n", conflicts, failures ? "FAILED" : "ok");
+    return failures;
+}
+
+static int checkFindConflicts(void)
+{
+    int failures = 0;
+    size_t conflicts = 0;
+    TimelineAnimationInterval intervals[120];
+    TimelineAnimationIntervalConflict found[120];
+    for (int round = 0; round < 20000; ++round) {
+        const size_t keys = 1 + (size_t)(round % 5);
+        const int64_t span = 20 + round % 400;
+        const size_t count = (size_t)(rand() % 120);
+        for (size_t i = 0; i < count; ++i) {
+            intervals[i] = randomInterval(keys, span);
+        }
+        const size_t foundCount = TimelineAnimationIntervalsFindConflicts(intervals, count, found);
+        failures += (foundCount > count);
+        if (foundCount > count) {
+            continue;
+        }
+        char reported[120] = { 0 };
+        for (size_t k = 0; k < foundCount; ++k) {
+            const TimelineAnimationInterval *const interval = &intervals[found[k].interval];
+            const TimelineAnimationInterval *const other = &intervals[found[k].other];
+            const int before = other->begin < interval->begin
+                || (other->begin == interval->begin && found[k].other < found[k].interval);
+            failures += !before || !(conflicting(other, interval)
+                                     || (other->key == interval->key && other->begin == interval->begin));
+            failures += reported[found[k].interval];
+            reported[found[k].interval] = 1;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            int expected = 0;
+            for (size_t j = 0; j < count; ++j) {
+                const int before = intervals[j].begin < intervals[i].begin
+                    || (intervals[j].begin == intervals[i].begin && j < i);
+                expected |= before && (conflicting(&intervals[j], &intervals[i])
+                                       || (intervals[j].key == intervals[i].key && intervals[j].begin == intervals[i].begin));
+            }
+            failures += (expected != reported[i]);
+            conflicts += (size_t)expected;
+        }
+    }
+    printf("conflicts, 20000 sets, %zu conflicting intervals: %s\n", conflicts, failures ? "FAILED" : "ok");
+    return failures;
+}
+
+// `count` entities of a hundred layers, with two animations of each in turn
+// and one after the other.
+static void timelineIntervals(TimelineAnimationInterval *intervals, size_t count, int64_t offset)
+{
+    for (size_t i = 0; i < count; ++i) {
+        intervals[i].key = i % 200;
+        intervals[i].begin = offset + (int64_t)(i / 200) * 300;
+        intervals[i].end = intervals[i].begin + 250;
+    }
+}
+
+int main(void)
+{
+    srand(20261017);
+    int failures = checkIndex();
+    failures += checkSweep();
+    failures += checkFindConflicts();
+
+    const size_t largest = counts[sizeof(counts) / sizeof(counts[0]) - 1];
+    TimelineAnimationInterval *const intervals = malloc(sizeof(TimelineAnimationInterval) * largest);
+    TimelineAnimationInterval *const others = malloc(sizeof(TimelineAnimationInterval) * largest);
+    TimelineAnimationIntervalConflict *const conflicts = malloc(sizeof(TimelineAnimationIntervalConflict) * largest);
+
+    printf("\n%9s %14s %14s %14s %14s %14s\n", "", "adding", "", "", "group check", "");
+    printf("%9s %14s %14s %14s %14s %14s\n", "entities", "every entity", "index", "batch", "every pair", "sweep");
+    for (size_t n = 0; n < sizeof(counts) / sizeof(counts[0]); ++n) {
+        const size_t count = counts[n];
+        timelineIntervals(intervals, count, 0);
+
+        double start = now();
+        for (size_t i = 0; i < count; ++i) {
+            int found = 0;
+            for (size_t j = 0; j < i && !found; ++j) {
+                found = conflicting(&intervals[j], &intervals[i]) || (intervals[j].key == intervals[i].key
+                                                                       && intervals[j].begin == intervals[i].begin);
+            }
+            failures += found;
+        }
+        const double scanning = now() - start;
+
+        start = now();
+        TimelineAnimationIntervalIndex *const index = TimelineAnimationIntervalIndexCreate();
+        for (size_t i = 0; i < count; ++i) {
+            const int found = TimelineAnimationIntervalIndexMayConflict(index, &intervals[i]);
+            failures += found;
+            TimelineAnimationIntervalIndexInsert(index, &intervals[i]);
+        }
+        TimelineAnimationIntervalIndexDestroy(index);
+        const double indexing = now() - start;
+
+        start = now();
+        failures += (TimelineAnimationIntervalsFindConflicts(intervals, count, conflicts) != 0);
+        const double batching = now() - start;
+
+        // a second timeline, after the first
+        timelineIntervals(others, count, (int64_t)(count / 200 + 1) * 300);
+        start = now();
+        int found = 0;
+        for (size_t i = 0; i < count && !found; ++i) {
+            for (size_t j = 0; j < count && !found; ++j) {
+                found = conflicting(&others[i], &intervals[j]);
+            }
+        }
+        failures += found;
+        const double pairing = now() - start;
+
+        start = now();
+        found = TimelineAnimationIntervalsConflict(others, count, intervals, count);
+        failures += found;
+        const double sweeping = now() - start;
+        sink = found;
+
+        printf("%9zu %12.3fms %12.3fms %12.3fms %12.3fms %12.3fms\n", count, scanning / 1e6, indexing / 1e6,
+               batching / 1e6, pairing / 1e6, sweeping / 1e6);
+    }
+    printf("\n%d failures\n", failures);
+
+    free(conflicts);
+    free(others);
+    free(intervals);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,307 @@
+/*!
+ *  @file TimelineAnimationKeyframeEvaluatorBenchmark.c
+ *  @brief TimelineAnimations
+ *
+ *  Checks TimelineAnimationKeyframeEvaluator.h, then times it against a binary
+ *  search of the key times per sample, for 10 to 10,000 keyframes of a point:
+ *
+ *  - for every calculation, unevenly spaced key times and none, the values
+ *    played forwards, backwards, in steps of several segments and at random
+ *    times are those found by a binary search written out here, and for the
+ *    cubic calculation by TimelineAnimationKeyframeSplineEvaluate()
+ *  - a few values worked out by hand, for the ends, the discrete and the
+ *    paced calculations
+ *
+ *  The timings are in nanoseconds per sample, playing forwards through the
+ *  animation in 100,000 samples and seeking to 100,000 random times, for the
+ *  linear and the cubic calculations.
+ *
+ *  Exits with 1 if a check fails.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationKeyframeEvaluatorBenchmark.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframeEvaluator.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframeSpline.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationKeyframeEvaluatorBenchmark \
+ *          && /tmp/TimelineAnimationKeyframeEvaluatorBenchmark
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "TimelineAnimationKeyframeEvaluator.h"
+#include "TimelineAnimationKeyframeSpline.h"
+
+#define COMPONENTS 2
+#define SAMPLES 100000
+
+static const size_t counts[] = { 10, 100, 1000, 10000 };
+
+static const char *const calculationNames[] = { "linear", "discrete", "paced", "cubic" };
+
+// keeps the compiler from dropping the loops
+static volatile double sink;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static double randomUnit(void)
+{
+    return (double)rand() / (double)RAND_MAX;
+}
+
+// The last boundary at or before `time`, clamped to the segments.
+static size_t referenceSegment(const double *times, size_t timeCount, double time)
+{
+    size_t low = 0;
+    size_t high = timeCount - 1;
+    while (high - low > 1) {
+        const size_t middle = low + (high - low) / 2;
+        if (times[middle] <= time) {
+            low = middle;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// The value at `time`, from scratch, with the boundaries of the evaluator
+// made up here.
+static void referenceValue(TimelineAnimationKeyframeCalculation calculation,
+                           const double *times,
+                           const double *values,
+                           size_t count,
+                           double time,
+                           double *value)
+{
+    if (calculation == TimelineAnimationKeyframeCalculationDiscrete) {
+        const size_t k = referenceSegment(times, count + 1, time);
+        for (size_t c = 0; c < COMPONENTS; ++c) {
+            value[c] = values[c * count + k];
+        }
+        return;
+    }
+    if (calculation == TimelineAnimationKeyframeCalculationCubic) {
+        for (size_t c = 0; c < COMPONENTS; ++c) {
+            value[c] = TimelineAnimationKeyframeSplineEvaluate(times, values + c * count, count, NULL, NULL, NULL, time);
+        }
+        return;
+    }
+    const size_t k = referenceSegment(times, count, time);
+    const double duration = times[k + 1] - times[k];
+    const double s = fmin(fmax((duration > 0.0) ? (time - times[k]) / duration : 1.0, 0.0), 1.0);
+    for (size_t c = 0; c < COMPONENTS; ++c) {
+        value[c] = values[c * count + k] + (values[c * count + k + 1] - values[c * count + k]) * s;
+    }
+}
+
+static void makeTimes(TimelineAnimationKeyframeCalculation calculation,
+                      const double *keyTimes,
+                      const double *values,
+                      size_t count,
+                      double *times)
+{
+    const size_t timeCount = (calculation == TimelineAnimationKeyframeCalculationDiscrete) ? count + 1 : count;
+    if (calculation == TimelineAnimationKeyframeCalculationPaced) {
+        times[0] = 0.0;
+        for (size_t k = 1; k < count; ++k) {
+            times[k] = times[k - 1] + hypot(values[k] - values[k - 1], values[count + k] - values[count + k - 1]);
+        }
+        for (size_t k = 1; k < count; ++k) {
+            times[k] /= times[count - 1];
+        }
+    }
+    else {
+        for (size_t k = 0; k < timeCount; ++k) {
+            times[k] = (keyTimes != NULL) ? keyTimes[k] : (double)k / (double)(timeCount - 1);
+        }
+    }
+}
+
+// Evaluates at `sampleCount` times and compares with the reference.
+static int checkTimes(TimelineAnimationKeyframeEvaluator *evaluator,
+                      const double *times,
+                      const double *samples,
+                      size_t sampleCount)
+{
+    double value[COMPONENTS], expected[COMPONENTS];
+    for (size_t i = 0; i < sampleCount; ++i) {
+        TimelineAnimationKeyframeEvaluate(evaluator, samples[i], value);
+        referenceValue(evaluator->calculation, times, evaluator->values, evaluator->keyframeCount, samples[i], expected);
+        for (size_t c = 0; c < COMPONENTS; ++c) {
+            if (!(fabs(value[c] - expected[c]) <= 1e-9)) {
+                printf("%s, %zu keyframes, at %.17g: %.17g instead of %.17g\n",
+                       calculationNames[evaluator->calculation], evaluator->keyframeCount, samples[i], value[c],
+                       expected[c]);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int checkByHand(void)
+{
+    int failures = 0;
+    TimelineAnimationKeyframeEvaluator evaluator;
+    double value;
+
+    const double steps[4] = { 10.0, 20.0, 30.0, 40.0 };
+    TimelineAnimationKeyframeEvaluatorInit(&evaluator, TimelineAnimationKeyframeCalculationDiscrete, NULL, steps, 4, 1,
+                                           NULL, NULL, NULL);
+    const double discreteTimes[5] = { -1.0, 0.0, 0.3, 0.5, 1.0 };
+    const double discreteValues[5] = { 10.0, 10.0, 20.0, 30.0, 40.0 };
+    for (size_t i = 0; i < 5; ++i) {
+        TimelineAnimationKeyframeEvaluate(&evaluator, discreteTimes[i], &value);
+        failures += (value != discreteValues[i]);
+    }
+    TimelineAnimationKeyframeEvaluatorDestroy(&evaluator);
+
+    const double distances[3] = { 0.0, 1.0, 3.0 };
+    TimelineAnimationKeyframeEvaluatorInit(&evaluator, TimelineAnimationKeyframeCalculationPaced, NULL, distances, 3, 1,
+                                           NULL, NULL, NULL);
+    const double pacedTimes[4] = { 0.25, 0.5, 1.0 / 3.0, 2.0 };
+    const double pacedValues[4] = { 0.75, 1.5, 1.0, 3.0 };
+    for (size_t i = 0; i < 4; ++i) {
+        TimelineAnimationKeyframeEvaluate(&evaluator, pacedTimes[i], &value);
+        failures += !(fabs(value - pacedValues[i]) < 1e-15);
+    }
+    TimelineAnimationKeyframeEvaluatorDestroy(&evaluator);
+
+    const double still[3] = { 5.0, 5.0, 5.0 };
+    TimelineAnimationKeyframeEvaluatorInit(&evaluator, TimelineAnimationKeyframeCalculationPaced, NULL, still, 3, 1,
+                                           NULL, NULL, NULL);
+    TimelineAnimationKeyframeEvaluate(&evaluator, 0.7, &value);
+    failures += (value != 5.0) || (evaluator.times[1] != 0.5);
+    TimelineAnimationKeyframeEvaluatorDestroy(&evaluator);
+
+    const double single = 7.0;
+    for (int calculation = 0; calculation < 4; ++calculation) {
+        TimelineAnimationKeyframeEvaluatorInit(&evaluator, (TimelineAnimationKeyframeCalculation)calculation, NULL, &single,
+                                               1, 1, NULL, NULL, NULL);
+        TimelineAnimationKeyframeEvaluate(&evaluator, 0.4, &value);
+        failures += (value != 7.0);
+        TimelineAnimationKeyframeEvaluatorDestroy(&evaluator);
+    }
+    failures += TimelineAnimationKeyframeEvaluatorInit(&evaluator, TimelineAnimationKeyframeCalculationLinear, NULL, steps,
+                                                       0, 1, NULL, NULL, NULL);
+
+    printf("values worked out by hand: %s\n", failures ? "FAILED" : "ok");
+    return failures;
+}
+
+// Nanoseconds per sample of evaluating at `samples`, by the evaluator or by
+// the reference.
+static double timeSamples(TimelineAnimationKeyframeEvaluator *evaluator,
+                          const double *times,
+                          const double *samples,
+                          int reference)
+{
+    double value[COMPONENTS];
+    double best = INFINITY;
+    for (int run = 0; run < 5; ++run) {
+        const double start = now();
+        for (size_t i = 0; i < SAMPLES; ++i) {
+            if (reference) {
+                referenceValue(evaluator->calculation, times, evaluator->values, evaluator->keyframeCount, samples[i],
+                               value);
+            }
+            else {
+                TimelineAnimationKeyframeEvaluate(evaluator, samples[i], value);
+            }
+            sink = value[0];
+        }
+        best = fmin(best, (now() - start) / SAMPLES);
+    }
+    return best;
+}
+
+int main(void)
+{
+    int failures = checkByHand();
+
+    const size_t largest = counts[sizeof(counts) / sizeof(counts[0]) - 1];
+    double *const keyTimes = malloc(sizeof(double) * (largest + 1));
+    double *const times = malloc(sizeof(double) * (largest + 1));
+    double *const values = malloc(sizeof(double) * largest * COMPONENTS);
+    double *const forwards = malloc(sizeof(double) * SAMPLES);
+    double *const backwards = malloc(sizeof(double) * SAMPLES);
+    double *const strides = malloc(sizeof(double) * SAMPLES);
+    double *const seeks = malloc(sizeof(double) * SAMPLES);
+
+    srand(20261017);
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        forwards[i] = (double)i / (SAMPLES - 1);
+        backwards[i] = 1.0 - forwards[i];
+        strides[i] = fmod((double)i * 0.0137, 1.1) - 0.05;
+        seeks[i] = randomUnit() * 1.2 - 0.1;
+    }
+
+    printf("\n%-9s %9s %10s %10s %10s %10s\n", "", "", "forwards", "", "seeks", "");
+    printf("%-9s %9s %10s %10s %10s %10s\n", "", "keyframes", "cursor", "search", "cursor", "search");
+    for (int calculation = 0; calculation < 4; ++calculation) {
+        for (size_t n = 0; n < sizeof(counts) / sizeof(counts[0]); ++n) {
+            const size_t count = counts[n];
+            const size_t timeCount = (calculation == TimelineAnimationKeyframeCalculationDiscrete) ? count + 1 : count;
+            keyTimes[0] = 0.0;
+            for (size_t k = 1; k < timeCount; ++k) {
+                // a few keyframes at the same time
+                keyTimes[k] = keyTimes[k - 1] + ((k % 97 == 0) ? 0.0 : 0.5 + randomUnit());
+            }
+            for (size_t k = 1; k < timeCount; ++k) {
+                keyTimes[k] /= keyTimes[timeCount - 1];
+            }
+            for (size_t i = 0; i < count * COMPONENTS; ++i) {
+                values[i] = randomUnit() * 100.0 - 50.0;
+            }
+
+            for (int uneven = 0; uneven < 2; ++uneven) {
+                const double *const given = uneven ? keyTimes : NULL;
+                TimelineAnimationKeyframeEvaluator evaluator;
+                if (!TimelineAnimationKeyframeEvaluatorInit(&evaluator, (TimelineAnimationKeyframeCalculation)calculation,
+                                                            given, values, count, COMPONENTS, NULL, NULL, NULL)) {
+                    ++failures;
+                    continue;
+                }
+                makeTimes((TimelineAnimationKeyframeCalculation)calculation, given, values, count, times);
+                failures += checkTimes(&evaluator, times, forwards, SAMPLES);
+                failures += checkTimes(&evaluator, times, backwards, SAMPLES);
+                failures += checkTimes(&evaluator, times, strides, SAMPLES);
+                failures += checkTimes(&evaluator, times, seeks, SAMPLES);
+
+                if (uneven && (calculation == TimelineAnimationKeyframeCalculationLinear
+                               || calculation == TimelineAnimationKeyframeCalculationCubic)) {
+                    printf("%-9s %9zu %10.1f %10.1f %10.1f %10.1f\n", calculationNames[calculation], count,
+                           timeSamples(&evaluator, times, forwards, 0), timeSamples(&evaluator, times, forwards, 1),
+                           timeSamples(&evaluator, times, seeks, 0), timeSamples(&evaluator, times, seeks, 1));
+                }
+                TimelineAnimationKeyframeEvaluatorDestroy(&evaluator);
+            }
+        }
+    }
+    printf("\n%d failures\n", failures);
+
+    free(seeks);
+    free(strides);
+    free(backwards);
+    free(forwards);
+    free(values);
+    free(times);
+    free(keyTimes);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,302 @@
+/*!
+ *  @file TimelineAnimationKeyframeSimplificationCheck.c
+ *  @brief TimelineAnimations
+ *
+ *  Simplifies the keyframes of every curve of
+ *  TimelineAnimationSpecialTimingFunction.h, as scalars, points and affine
+ *  transforms with 240 evenly spaced keyframes, and some unevenly spaced
+ *  noisy keyframes, with a few tolerances. Prints how many keyframes are
+ *  kept and the error of the kept ones, checked independently, and the
+ *  time taken.
+ *
+ *  Exits with 1 if a simplification is off by more than its tolerance, or
+ *  does not keep the first and last keyframes.
+ *
+ *  With `--simplify TOLERANCE`, simplifies the keyframes read from the
+ *  standard input instead, one per line, a key time then the components
+ *  separated by white space, and writes the kept lines to the standard
+ *  output and the counts to the standard error, so that keyframes exported
+ *  from assets can be simplified offline.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationKeyframeSimplificationCheck.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframeSimplification.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframes.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationTransformInterpolation.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationKeyframeSimplificationCheck && /tmp/TimelineAnimationKeyframeSimplificationCheck
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TimelineAnimationKeyframeSimplification.h"
+#include "TimelineAnimationKeyframes.h"
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#define KEYFRAMES 240
+#define MAXIMUM_COMPONENTS 16
+
+#define CURVE(name) { #name, name }
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+} curves[] = {
+    CURVE(LinearInterpolation),
+    CURVE(QuadraticEaseIn), CURVE(QuadraticEaseOut), CURVE(QuadraticEaseInOut),
+    CURVE(CubicEaseIn), CURVE(CubicEaseOut), CURVE(CubicEaseInOut),
+    CURVE(QuarticEaseIn), CURVE(QuarticEaseOut), CURVE(QuarticEaseInOut),
+    CURVE(QuinticEaseIn), CURVE(QuinticEaseOut), CURVE(QuinticEaseInOut),
+    CURVE(SineEaseIn), CURVE(SineEaseOut), CURVE(SineEaseInOut),
+    CURVE(CircularEaseIn), CURVE(CircularEaseOut), CURVE(CircularEaseInOut),
+    CURVE(ExponentialEaseIn), CURVE(ExponentialEaseOut), CURVE(ExponentialEaseInOut),
+    CURVE(BackEaseIn), CURVE(BackEaseOut), CURVE(BackEaseInOut),
+    CURVE(ElasticEaseIn), CURVE(ElasticEaseOut), CURVE(ElasticEaseInOut),
+    CURVE(BounceEaseIn), CURVE(BounceEaseOut), CURVE(BounceEaseInOut),
+    CURVE(SlowMotion),
+};
+
+// in the units of the values: a scalar from 0 to 1, points moving by a few
+// hundred points, transforms with a unit scale
+static const double tolerances[] = { 1e-2, 1e-3, 1e-4 };
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// The error of the kept keyframes, computed here again rather than with
+// TimelineAnimationKeyframeSimplificationError(): at every keyframe, the
+// largest difference of any component from the kept ones interpolated.
+static double independentError(const double *keyTimes, const double *values, size_t count, size_t dimensions,
+                               const size_t *indices, size_t kept)
+{
+    double error = 0.0;
+    size_t segment = 0;
+    for (size_t frame = 0; frame < count; ++frame) {
+        const double t = keyTimes[frame];
+        while (segment + 2 < kept && frame >= indices[segment + 1]) {
+            ++segment;
+        }
+        const size_t a = indices[segment], b = indices[segment + 1];
+        const double u = (keyTimes[b] > keyTimes[a]) ? (t - keyTimes[a]) / (keyTimes[b] - keyTimes[a]) : 0.0;
+        for (size_t c = 0; c < dimensions; ++c) {
+            const double *const plane = values + c * count;
+            error = fmax(error, fabs(plane[frame] - (plane[a] + u * (plane[b] - plane[a]))));
+        }
+    }
+    return error;
+}
+
+typedef struct {
+    size_t kept;
+    double error;
+    int ok;
+} Result;
+
+static Result check(const double *keyTimes, const double *values, size_t count, size_t dimensions, double tolerance,
+                    size_t *indices)
+{
+    Result result;
+    result.kept = TimelineAnimationKeyframeSimplify(keyTimes, values, count, dimensions, tolerance, indices);
+    result.error = (result.kept >= 2) ? independentError(keyTimes, values, count, dimensions, indices, result.kept) : INFINITY;
+    result.ok = result.kept >= 2 && indices[0] == 0 && indices[result.kept - 1] == count - 1
+        && result.error <= tolerance
+        && fabs(result.error - TimelineAnimationKeyframeSimplificationError(keyTimes, values, count, dimensions,
+                                                                            indices, result.kept)) <= 1e-12;
+    return result;
+}
+
+// MARK: - Offline
+
+static int simplifyInput(double tolerance)
+{
+    size_t capacity = 1024, count = 0, dimensions = 0;
+    double *rows = malloc(sizeof(double) * (MAXIMUM_COMPONENTS + 1) * capacity);
+    char line[4096];
+    while (rows != NULL && fgets(line, sizeof(line), stdin) != NULL) {
+        double row[MAXIMUM_COMPONENTS + 1];
+        size_t fields = 0;
+        char *cursor = line, *end = NULL;
+        while (fields <= MAXIMUM_COMPONENTS) {
+            const double field = strtod(cursor, &end);
+            if (end == cursor) {
+                break;
+            }
+            row[fields++] = field;
+            cursor = end;
+        }
+        if (fields == 0) {
+            continue;
+        }
+        if (dimensions == 0) {
+            dimensions = fields - 1;
+        }
+        if (fields - 1 != dimensions || dimensions == 0) {
+            fprintf(stderr, "line %zu: expected a time and %zu components\n", count + 1, dimensions);
+            free(rows);
+            return 1;
+        }
+        if (count == capacity) {
+            capacity *= 2;
+            double *const grown = realloc(rows, sizeof(double) * (MAXIMUM_COMPONENTS + 1) * capacity);
+            if (grown == NULL) {
+                break;
+            }
+            rows = grown;
+        }
+        memcpy(rows + count * (MAXIMUM_COMPONENTS + 1), row, sizeof(double) * fields);
+        ++count;
+    }
+    if (count == 0) {
+        free(rows);
+        fprintf(stderr, "no keyframes\n");
+        return 1;
+    }
+
+    double *const keyTimes = malloc(sizeof(double) * count);
+    double *const values = malloc(sizeof(double) * dimensions * count);
+    size_t *const indices = malloc(sizeof(size_t) * count);
+    for (size_t frame = 0; frame < count; ++frame) {
+        const double *const row = rows + frame * (MAXIMUM_COMPONENTS + 1);
+        keyTimes[frame] = row[0];
+        for (size_t c = 0; c < dimensions; ++c) {
+            values[c * count + frame] = row[c + 1];
+        }
+    }
+    const size_t kept = TimelineAnimationKeyframeSimplify(keyTimes, values, count, dimensions, tolerance, indices);
+    for (size_t k = 0; k < kept; ++k) {
+        const double *const row = rows + indices[k] * (MAXIMUM_COMPONENTS + 1);
+        for (size_t c = 0; c <= dimensions; ++c) {
+            printf(c == 0 ? "%.17g" : " %.17g", row[c]);
+        }
+        printf("\n");
+    }
+    fprintf(stderr, "%zu keyframes, %zu kept, %zu removed, error %.3e\n", count, kept, count - kept,
+            TimelineAnimationKeyframeSimplificationError(keyTimes, values, count, dimensions, indices, kept));
+    free(indices);
+    free(values);
+    free(keyTimes);
+    free(rows);
+    return kept != 0 ? 0 : 1;
+}
+
+// MARK: -
+
+int main(int argc, char **argv)
+{
+    if (argc == 3 && strcmp(argv[1], "--simplify") == 0) {
+        return simplifyInput(strtod(argv[2], NULL));
+    }
+
+    double *const keyTimes = malloc(sizeof(double) * KEYFRAMES);
+    double *const values = malloc(sizeof(double) * MAXIMUM_COMPONENTS * KEYFRAMES);
+    size_t *const indices = malloc(sizeof(size_t) * KEYFRAMES);
+    for (size_t frame = 0; frame < KEYFRAMES; ++frame) {
+        keyTimes[frame] = (double)frame / (KEYFRAMES - 1);
+    }
+    int failures = 0;
+    double elapsed = 0.0;
+    size_t simplified = 0;
+
+    static const char *const kinds[] = { "scalar", "point", "transform" };
+    size_t keptTotal[3][3] = { { 0 } };
+    printf("%-22s %-10s", "curve", "value");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   %4s %9s", "kept", "error");
+    }
+    printf("\n%-22s %-10s", "", "");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   within %-7.0e", tolerances[e]);
+    }
+    printf("\n");
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        for (size_t kind = 0; kind < 3; ++kind) {
+            size_t dimensions;
+            if (kind == 0) {
+                dimensions = 1;
+                TimelineAnimationKeyframeProgress(curves[c].function, KEYFRAMES, values);
+            }
+            else if (kind == 1) {
+                dimensions = 2;
+                const double from[2] = { 0.0, 100.0 }, to[2] = { 320.0, -40.0 };
+                TimelineAnimationKeyframeVectors(curves[c].function, from, to, 2, KEYFRAMES, values);
+                // in hundreds of points, so that 1e-2 is a point
+                for (size_t i = 0; i < 2 * KEYFRAMES; ++i) {
+                    values[i] /= 100.0;
+                }
+            }
+            else {
+                dimensions = TimelineAnimationKeyframeAffineComponents;
+                const double from[6] = { 1.0, 0.0, 0.0, 1.0, 0.0, 0.0 };
+                const double to[6] = { 0.0, 1.5, -1.5, 0.0, 0.2, 0.1 };
+                TimelineAnimationKeyframeAffineTransforms(curves[c].function, from, to, KEYFRAMES, values);
+            }
+            printf("%-22s %-10s", curves[c].name, kinds[kind]);
+            for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+                const double start = now();
+                const Result result = check(keyTimes, values, KEYFRAMES, dimensions, tolerances[e], indices);
+                elapsed += now() - start;
+                ++simplified;
+                failures += !result.ok;
+                keptTotal[kind][e] += result.kept;
+                printf("   %4zu %9.2e%s", result.kept, result.error, result.ok ? "" : " FAILED");
+            }
+            printf("\n");
+        }
+    }
+    for (size_t kind = 0; kind < 3; ++kind) {
+        printf("%-22s %-10s", "total", kinds[kind]);
+        for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+            printf("   %4zu %9s", keptTotal[kind][e], "");
+        }
+        printf("   of %zu\n", (size_t)KEYFRAMES * (sizeof(curves) / sizeof(curves[0])));
+    }
+
+    // unevenly spaced, noisy keyframes, as authored ones can be, with jumps
+    srand(42);
+    size_t noisyKept[3] = { 0 };
+    const size_t noisyRuns = 100;
+    for (size_t run = 0; run < noisyRuns; ++run) {
+        double t = 0.0;
+        for (size_t frame = 0; frame < KEYFRAMES; ++frame) {
+            // every 60th keyframe at the time of the previous one
+            t += (frame == 0 || frame % 60 == 0) ? 0.0 : (double)rand() / RAND_MAX;
+            keyTimes[frame] = t;
+        }
+        for (size_t frame = 0; frame < KEYFRAMES; ++frame) {
+            keyTimes[frame] /= t;
+            values[frame] = sin(6.0 * keyTimes[frame]) + 1e-3 * ((double)rand() / RAND_MAX - 0.5);
+            values[KEYFRAMES + frame] = (frame / 60) + keyTimes[frame];
+        }
+        for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+            const Result result = check(keyTimes, values, KEYFRAMES, 2, tolerances[e], indices);
+            failures += !result.ok;
+            noisyKept[e] += result.kept;
+        }
+    }
+    printf("%-22s %-10s", "noisy, uneven, jumps", "2 values");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   %6.1f %7s", (double)noisyKept[e] / noisyRuns, "");
+    }
+    printf("   of %d on average\n", KEYFRAMES);
+
+    printf("\n%.2f us per simplification of %d keyframes\n", elapsed / simplified / 1000.0, KEYFRAMES);
+    printf("%d failures\n", failures);
+    free(indices);
+    free(values);
+    free(keyTimes);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,278 @@
+/*!
+ *  @file TimelineAnimationKeyframeValuesBenchmark.c
+ *  @brief TimelineAnimations
+ *
+ *  Compares the planar keyframe values of TimelineAnimationKeyframes.h with
+ *  the boxing loops CAKeyframeAnimation+SpecialEasing used to run, for
+ *  points, sizes, rects and affine transforms:
+ *
+ *  - boxed:  t accumulated by dt, the curve called once per keyframe and each
+ *            keyframe boxed on its own, as +[NSValue valueWithCGPoint:] does,
+ *            into a growing array that is copied at the end
+ *  - planar: TimelineAnimationKeyframeVectors() and
+ *            TimelineAnimationKeyframeAffineTransforms() into a buffer of the
+ *            caller
+ *
+ *  Foundation is not available here, so a box is a malloc'ed header and
+ *  payload and the arrays are arrays of pointers; every allocation is
+ *  counted. Then, for every curve, compares the last keyframe of both ways of
+ *  stepping the time with the value at 1, for every keyframe count from 2 to
+ *  1024, and a single keyframe with the value at 0.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationKeyframeValuesBenchmark.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframes.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationTransformInterpolation.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationKeyframeValuesBenchmark && /tmp/TimelineAnimationKeyframeValuesBenchmark
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TimelineAnimationKeyframes.h"
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#define CURVE(name) { #name, name }
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+} curves[] = {
+    CURVE(LinearInterpolation),
+    CURVE(QuadraticEaseIn), CURVE(QuadraticEaseOut), CURVE(QuadraticEaseInOut),
+    CURVE(CubicEaseIn), CURVE(CubicEaseOut), CURVE(CubicEaseInOut),
+    CURVE(QuarticEaseIn), CURVE(QuarticEaseOut), CURVE(QuarticEaseInOut),
+    CURVE(QuinticEaseIn), CURVE(QuinticEaseOut), CURVE(QuinticEaseInOut),
+    CURVE(SineEaseIn), CURVE(SineEaseOut), CURVE(SineEaseInOut),
+    CURVE(CircularEaseIn), CURVE(CircularEaseOut), CURVE(CircularEaseInOut),
+    CURVE(ExponentialEaseIn), CURVE(ExponentialEaseOut), CURVE(ExponentialEaseInOut),
+    CURVE(BackEaseIn), CURVE(BackEaseOut), CURVE(BackEaseInOut),
+    CURVE(ElasticEaseIn), CURVE(ElasticEaseOut), CURVE(ElasticEaseInOut),
+    CURVE(BounceEaseIn), CURVE(BounceEaseOut), CURVE(BounceEaseInOut),
+    CURVE(SlowMotion),
+};
+
+static const size_t counts[] = { 16, 60, 240 };
+
+// keeps the compiler from dropping the loops
+static volatile double sink;
+static size_t allocations;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void *countedMalloc(size_t size)
+{
+    ++allocations;
+    return malloc(size);
+}
+
+// MARK: - Boxed
+
+// An object header, then the payload, like an NSValue.
+static void *box(const double *components, size_t dimensions)
+{
+    double *const object = countedMalloc(16 + sizeof(double) * dimensions);
+    memcpy(object + 2, components, sizeof(double) * dimensions);
+    return object;
+}
+
+static void **boxedArray(size_t count)
+{
+    void **const values = countedMalloc(sizeof(void *) * count);
+    memset(values, 0, sizeof(void *) * count);
+    return values;
+}
+
+// [values copy]
+static void **boxedCopy(void **values, size_t count)
+{
+    void **const copy = countedMalloc(sizeof(void *) * count);
+    memcpy(copy, values, sizeof(void *) * count);
+    free(values);
+    return copy;
+}
+
+static void boxedFree(void **values, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        free(values[i]);
+    }
+    free(values);
+}
+
+static void boxedVectors(TimelineAnimationSpecialTimingFunction function,
+                         const double *from, const double *to, size_t dimensions, size_t count)
+{
+    void **values = boxedArray(count);
+    double t = 0.0;
+    const double dt = 1.0 / (count - 1);
+    for (size_t frame = 0; frame < count; ++frame, t += dt) {
+        const double v = function(t);
+        double components[4];
+        for (size_t c = 0; c < dimensions; ++c) {
+            components[c] = from[c] + v * (to[c] - from[c]);
+        }
+        values[frame] = box(components, dimensions);
+    }
+    values = boxedCopy(values, count);
+    boxedFree(values, count);
+}
+
+static void boxedTransforms(TimelineAnimationSpecialTimingFunction function,
+                            const double *from, const double *to, size_t count)
+{
+    void **values = boxedArray(count);
+    const double fromScale = hypot(from[0], from[2]), toScale = hypot(to[0], to[2]);
+    const double fromRotation = atan2(from[2], from[0]), toRotation = atan2(to[2], to[0]);
+    double t = 0.0;
+    const double dt = 1.0 / (count - 1);
+    for (size_t frame = 0; frame < count; ++frame, t += dt) {
+        const double v = function(t);
+        const double scale = fromScale + v * (toScale - fromScale);
+        const double rotate = fromRotation + v * (toRotation - fromRotation);
+        // the CATransform3D the affine transform is boxed in
+        double components[16] = { 0 };
+        components[0] = scale * cos(rotate);
+        components[1] = -scale * sin(rotate);
+        components[4] = scale * sin(rotate);
+        components[5] = scale * cos(rotate);
+        components[10] = 1.0;
+        components[12] = from[4] + v * (to[4] - from[4]);
+        components[13] = from[5] + v * (to[5] - from[5]);
+        components[15] = 1.0;
+        values[frame] = box(components, 16);
+    }
+    values = boxedCopy(values, count);
+    boxedFree(values, count);
+}
+
+// MARK: - Planar
+
+static double *planes;
+
+static void planarVectors(TimelineAnimationSpecialTimingFunction function,
+                          const double *from, const double *to, size_t dimensions, size_t count)
+{
+    TimelineAnimationKeyframeVectors(function, from, to, dimensions, count, planes);
+    sink = planes[dimensions * count - 1];
+}
+
+static void planarTransforms(TimelineAnimationSpecialTimingFunction function,
+                             const double *from, const double *to, size_t count)
+{
+    TimelineAnimationKeyframeAffineTransforms(function, from, to, count, planes);
+    sink = planes[TimelineAnimationKeyframeAffineComponents * count - 1];
+}
+
+// MARK: -
+
+typedef enum { POINT, SIZE, RECT, TRANSFORM } Kind;
+
+static const char *const kinds[] = { "point", "size", "rect", "transform" };
+static const size_t dimensions[] = { 2, 2, 4, TimelineAnimationKeyframeAffineComponents };
+
+static void run(int boxed, Kind kind, TimelineAnimationSpecialTimingFunction function, size_t count)
+{
+    static const double from[6] = { 1.0, 0.0, 0.0, 1.0, 10.0, 20.0 };
+    static const double to[6] = { 0.0, -2.0, 2.0, 0.0, 300.0, -40.0 };
+    if (kind == TRANSFORM) {
+        boxed ? boxedTransforms(function, from, to, count) : planarTransforms(function, from, to, count);
+    }
+    else {
+        boxed ? boxedVectors(function, from, to, dimensions[kind], count) : planarVectors(function, from, to, dimensions[kind], count);
+    }
+}
+
+// nanoseconds per keyframe, the fastest of 5 runs of at least 20 microseconds
+static double measure(int boxed, Kind kind, TimelineAnimationSpecialTimingFunction function, size_t count)
+{
+    double best = INFINITY;
+    for (int r = 0; r < 5; ++r) {
+        size_t rounds = 0;
+        const double start = now();
+        double elapsed;
+        do {
+            run(boxed, kind, function, count);
+            ++rounds;
+            elapsed = now() - start;
+        } while (elapsed < 20000.0);
+        best = fmin(best, elapsed / (double)(rounds * count));
+    }
+    return best;
+}
+
+int main(void)
+{
+    planes = malloc(sizeof(double) * TimelineAnimationKeyframeAffineComponents * 1024);
+
+    printf("%-10s %-14s %9s %14s %14s %14s %14s\n",
+           "value", "curve", "keyframes", "boxed ns/kf", "planar ns/kf", "boxed allocs", "planar allocs");
+    const TimelineAnimationSpecialTimingFunction timed[] = { QuadraticEaseOut, ElasticEaseOut };
+    const char *const timedNames[] = { "QuadraticOut", "ElasticOut" };
+    for (Kind kind = POINT; kind <= TRANSFORM; ++kind) {
+        for (size_t f = 0; f < 2; ++f) {
+            for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+                allocations = 0;
+                run(1, kind, timed[f], counts[c]);
+                const size_t boxedAllocations = allocations;
+                allocations = 0;
+                run(0, kind, timed[f], counts[c]);
+                const size_t planarAllocations = allocations;
+                printf("%-10s %-14s %9zu %14.2f %14.2f %14zu %14zu\n",
+                       kinds[kind], timedNames[f], counts[c],
+                       measure(1, kind, timed[f], counts[c]), measure(0, kind, timed[f], counts[c]),
+                       boxedAllocations, planarAllocations);
+            }
+        }
+    }
+
+    // the last keyframe against the value at 1, accumulated and from the
+    // index, and a single keyframe against the value at 0
+    printf("\n%-22s %22s %22s %8s\n", "curve", "accumulated: misses", "index: misses", "single");
+    double *const progress = malloc(sizeof(double) * 1024);
+    int failures = 0;
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        const TimelineAnimationSpecialTimingFunction function = curves[c].function;
+        const double end = function(1.0);
+        size_t accumulatedMisses = 0, indexMisses = 0;
+        double accumulatedWorst = 0.0;
+        for (size_t count = 2; count <= 1024; ++count) {
+            double t = 0.0;
+            const double dt = 1.0 / (count - 1);
+            for (size_t frame = 0; frame + 1 < count; ++frame) {
+                t += dt;
+            }
+            const double accumulated = function(t);
+            if (accumulated != end) {
+                ++accumulatedMisses;
+                accumulatedWorst = fmax(accumulatedWorst, fabs(accumulated - end));
+            }
+            TimelineAnimationKeyframeProgress(function, count, progress);
+            indexMisses += (progress[count - 1] != end);
+        }
+        TimelineAnimationKeyframeProgress(function, 1, progress);
+        const int single = (progress[0] == function(0.0));
+        failures += (indexMisses != 0) + !single;
+        printf("%-22s %12zu (%7.1e) %22zu %8s\n", curves[c].name, accumulatedMisses, accumulatedWorst, indexMisses,
+               single ? "ok" : "MISS");
+    }
+    printf("\n%d failures\n", failures);
+    free(progress);
+    free(planes);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,229 @@
+/*!
+ *  @file TimelineAnimationSplineKeyframesCheck.c
+ *  @brief TimelineAnimations
+ *
+ *  For every curve of TimelineAnimationSpecialTimingFunction.h and a few
+ *  maximum errors, compares the keyframes of
+ *  TimelineAnimationKeyframeSplineProgress(), interpolated as the cubic
+ *  calculation mode does, with those of
+ *  TimelineAnimationKeyframeAdaptiveProgress(), interpolated linearly: the
+ *  keyframe counts and the largest error over 2^20 + 1 progress values,
+ *  which is finer than the grid the keyframes are chosen on. The last column
+ *  is what the `splineMaximumError:` factories use, the fewer of both.
+ *
+ *  The spline is evaluated by TimelineAnimationKeyframeSplineEvaluate(), and
+ *  checked first against a Catmull-Rom spline written out here for evenly
+ *  spaced keyframes, and for unevenly spaced ones against a Hermite spline
+ *  whose slopes are those of the chords between neighbouring keyframes.
+ *
+ *  Exits with 1 if a check fails, or if a spline or the linear keyframes are
+ *  off by more than twice their maximum error.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationSplineKeyframesCheck.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframeSpline.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframes.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationTransformInterpolation.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationSplineKeyframesCheck && /tmp/TimelineAnimationSplineKeyframesCheck
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "TimelineAnimationKeyframeSpline.h"
+#include "TimelineAnimationKeyframes.h"
+#include "TimelineAnimationSpecialTimingFunction.h"
+
+#define GRID ((size_t)1 << 20)
+#define CAPACITY TimelineAnimationKeyframeSplineCapacity
+#define LINEAR_CAPACITY TimelineAnimationKeyframeAdaptiveCapacity
+
+#define CURVE(name) { #name, name }
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+} curves[] = {
+    CURVE(LinearInterpolation),
+    CURVE(QuadraticEaseIn), CURVE(QuadraticEaseOut), CURVE(QuadraticEaseInOut),
+    CURVE(CubicEaseIn), CURVE(CubicEaseOut), CURVE(CubicEaseInOut),
+    CURVE(QuarticEaseIn), CURVE(QuarticEaseOut), CURVE(QuarticEaseInOut),
+    CURVE(QuinticEaseIn), CURVE(QuinticEaseOut), CURVE(QuinticEaseInOut),
+    CURVE(SineEaseIn), CURVE(SineEaseOut), CURVE(SineEaseInOut),
+    CURVE(CircularEaseIn), CURVE(CircularEaseOut), CURVE(CircularEaseInOut),
+    CURVE(ExponentialEaseIn), CURVE(ExponentialEaseOut), CURVE(ExponentialEaseInOut),
+    CURVE(BackEaseIn), CURVE(BackEaseOut), CURVE(BackEaseInOut),
+    CURVE(ElasticEaseIn), CURVE(ElasticEaseOut), CURVE(ElasticEaseInOut),
+    CURVE(BounceEaseIn), CURVE(BounceEaseOut), CURVE(BounceEaseInOut),
+    CURVE(SlowMotion),
+};
+
+static const double tolerances[] = { 1e-2, 1e-3 };
+
+// Catmull-Rom through evenly spaced points, the ends repeated.
+static double catmullRom(const double *values, size_t count, double time)
+{
+    const double position = time * (double)(count - 1);
+    size_t k = (size_t)position;
+    if (k >= count - 1) {
+        k = count - 2;
+    }
+    const double s = position - (double)k;
+    const double p0 = values[k > 0 ? k - 1 : 0], p1 = values[k], p2 = values[k + 1];
+    const double p3 = values[k + 2 < count ? k + 2 : count - 1];
+    return 0.5 * ((2.0 * p1) + (-p0 + p2) * s + (2.0 * p0 - 5.0 * p1 + 4.0 * p2 - p3) * s * s
+                  + (-p0 + 3.0 * p1 - 3.0 * p2 + p3) * s * s * s);
+}
+
+static int checkEvaluator(void)
+{
+    int failures = 0;
+
+    // evenly spaced, against the textbook formula
+    double keyTimes[9], values[9];
+    for (size_t i = 0; i < 9; ++i) {
+        keyTimes[i] = (double)i / 8.0;
+        values[i] = sin(5.0 * keyTimes[i]) + 0.3 * (double)(i % 3);
+    }
+    double error = 0.0;
+    for (size_t i = 0; i <= 10000; ++i) {
+        const double t = (double)i / 10000.0;
+        error = fmax(error, fabs(TimelineAnimationKeyframeSplineEvaluate(keyTimes, values, 9, NULL, NULL, NULL, t)
+                                 - catmullRom(values, 9, t)));
+    }
+    printf("evenly spaced, against Catmull-Rom:        %.2e\n", error);
+    failures += !(error < 1e-12);
+
+    // a tension of 1 everywhere is a zero tangent, smoothstep between keyframes
+    double ones[9];
+    for (size_t i = 0; i < 9; ++i) {
+        ones[i] = 1.0;
+    }
+    error = 0.0;
+    for (size_t i = 0; i <= 10000; ++i) {
+        const double t = (double)i / 10000.0;
+        const double position = t * 8.0;
+        const size_t k = (position >= 8.0) ? 7 : (size_t)position;
+        const double s = position - (double)k;
+        const double smooth = values[k] + (values[k + 1] - values[k]) * s * s * (3.0 - 2.0 * s);
+        error = fmax(error, fabs(TimelineAnimationKeyframeSplineEvaluate(keyTimes, values, 9, ones, NULL, NULL, t) - smooth));
+    }
+    printf("tension 1, against smoothstep:             %.2e\n", error);
+    failures += !(error < 1e-12);
+
+    // unevenly spaced, against a Hermite spline in time whose inner slopes are
+    // those of the chords between the neighbouring keyframes
+    const double uneven[7] = { 0.0, 0.05, 0.2, 0.45, 0.5, 0.8, 1.0 };
+    double unevenValues[7], slopes[7];
+    for (size_t i = 0; i < 7; ++i) {
+        unevenValues[i] = sin(5.0 * uneven[i]) + 0.3 * (double)(i % 3);
+    }
+    for (size_t i = 0; i < 7; ++i) {
+        const size_t before = (i > 0) ? i - 1 : 0, after = (i < 6) ? i + 1 : 6;
+        slopes[i] = (unevenValues[after] - unevenValues[before]) / (uneven[after] - uneven[before]);
+    }
+    // at the repeated ends the chord spans a single step, counted as two
+    slopes[0] *= 0.5;
+    slopes[6] *= 0.5;
+    error = 0.0;
+    for (size_t i = 0; i <= 10000; ++i) {
+        const double t = (double)i / 10000.0;
+        size_t k = 0;
+        while (k < 5 && t >= uneven[k + 1]) {
+            ++k;
+        }
+        const double h = uneven[k + 1] - uneven[k];
+        const double s = (t - uneven[k]) / h;
+        const double hermite = (2.0 * s * s * s - 3.0 * s * s + 1.0) * unevenValues[k]
+            + (s * s * s - 2.0 * s * s + s) * h * slopes[k]
+            + (-2.0 * s * s * s + 3.0 * s * s) * unevenValues[k + 1]
+            + (s * s * s - s * s) * h * slopes[k + 1];
+        error = fmax(error, fabs(TimelineAnimationKeyframeSplineEvaluate(uneven, unevenValues, 7, NULL, NULL, NULL, t)
+                                 - hermite));
+    }
+    printf("unevenly spaced, against Hermite in time:  %.2e\n", error);
+    failures += !(error < 1e-12);
+    return failures;
+}
+
+int main(void)
+{
+    int failures = checkEvaluator();
+    printf("\n");
+
+    double *const exact = malloc(sizeof(double) * (GRID + 1));
+    double *const keyTimes = malloc(sizeof(double) * LINEAR_CAPACITY);
+    double *const progress = malloc(sizeof(double) * LINEAR_CAPACITY);
+
+    printf("%-22s", "curve");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   %6s %9s %6s %9s %6s", "spline", "error", "linear", "error", "fewer");
+    }
+    printf("\n%-22s", "");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   within %-33.0e", tolerances[e]);
+    }
+    printf("\n");
+
+    size_t splineTotal[2] = { 0 }, linearTotal[2] = { 0 }, fewerTotal[2] = { 0 };
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        const TimelineAnimationSpecialTimingFunction function = curves[c].function;
+        for (size_t i = 0; i <= GRID; ++i) {
+            exact[i] = function((double)i / GRID);
+        }
+        printf("%-22s", curves[c].name);
+        for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+            const size_t count = TimelineAnimationKeyframeSplineProgress(function, tolerances[e], CAPACITY, keyTimes, progress);
+            double error = INFINITY;
+            if (count >= 2) {
+                error = 0.0;
+                for (size_t i = 0; i <= GRID; ++i) {
+                    const double value = TimelineAnimationKeyframeSplineEvaluate(keyTimes, progress, count, NULL, NULL, NULL,
+                                                                                 (double)i / GRID);
+                    error = fmax(error, fabs(value - exact[i]));
+                }
+            }
+            const size_t linear = TimelineAnimationKeyframeAdaptiveProgress(function, tolerances[e], LINEAR_CAPACITY,
+                                                                            keyTimes, progress);
+            double linearError = INFINITY;
+            if (linear >= 2) {
+                linearError = 0.0;
+                size_t k = 0;
+                for (size_t i = 0; i <= GRID; ++i) {
+                    const double t = (double)i / GRID;
+                    while (k + 2 < linear && t > keyTimes[k + 1]) {
+                        ++k;
+                    }
+                    const double s = (t - keyTimes[k]) / (keyTimes[k + 1] - keyTimes[k]);
+                    linearError = fmax(linearError, fabs(progress[k] + (progress[k + 1] - progress[k]) * s - exact[i]));
+                }
+            }
+            const int ok = count >= 2 && error <= 2.0 * tolerances[e] && linear >= 2 && linearError <= 2.0 * tolerances[e];
+            failures += !ok;
+            const size_t fewer = (linear < count) ? linear : count;
+            splineTotal[e] += count;
+            linearTotal[e] += linear;
+            fewerTotal[e] += fewer;
+            printf("   %6zu %9.2e %6zu %9.2e %6zu%s", count, error, linear, linearError, fewer, ok ? "" : " FAILED");
+        }
+        printf("\n");
+    }
+    printf("%-22s", "total");
+    for (size_t e = 0; e < sizeof(tolerances) / sizeof(tolerances[0]); ++e) {
+        printf("   %6zu %9s %6zu %9s %6zu", splineTotal[e], "", linearTotal[e], "", fewerTotal[e]);
+    }
+    printf("\n\n%d failures\n", failures);
+
+    free(progress);
+    free(keyTimes);
+    free(exact);
+    return failures == 0 ? 0 : 1;
+}
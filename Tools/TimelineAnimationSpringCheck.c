@@ -0,0 +1,212 @@
+/*!
+ *  @file TimelineAnimationSpringCheck.c
+ *  @brief TimelineAnimations
+ *
+ *  Checks the springs of TimelineAnimationSpring.h, underdamped to heavily
+ *  overdamped, launched backwards, at rest or forwards:
+ *
+ *  - the closed-form solution against a Runge-Kutta integration of the
+ *    spring equation
+ *  - that the settling time is where the progress last leaves the tolerance,
+ *    by sampling the spring densely around and after it; the bound of the
+ *    decay envelope is printed next to it for the underdamped springs
+ *  - the keyframes stepped by recurrence against the evaluated ones
+ *
+ *  then times TimelineAnimationSpringEvaluate(), the batch and the keyframes
+ *  for 60 keyframes. Exits with 1 if a check fails.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationSpringCheck.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpring.c \
+ *          -lm -o /tmp/TimelineAnimationSpringCheck && /tmp/TimelineAnimationSpringCheck
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "TimelineAnimationSpring.h"
+
+#define TOLERANCE TimelineAnimationSpringDefaultTolerance
+#define KEYFRAMES 60
+#define ROUNDS 20000
+
+static const struct {
+    double mass, stiffness, damping, velocity;
+} springs[] = {
+    { 1.0, 100.0, 1.0, 0.0 },
+    { 1.0, 100.0, 6.0, 0.0 },
+    { 1.0, 100.0, 10.0, 0.0 },
+    { 1.0, 100.0, 10.0, -8.0 },
+    { 1.0, 100.0, 10.0, 20.0 },
+    { 1.0, 300.0, 20.0, 0.0 },
+    { 2.0, 50.0, 19.0, 3.0 },
+    { 1.0, 100.0, 20.0, 0.0 },
+    { 1.0, 100.0, 20.0, -5.0 },
+    { 1.0, 100.0, 20.0, 30.0 },
+    { 1.0, 100.0, 30.0, 0.0 },
+    { 1.0, 100.0, 30.0, -10.0 },
+    { 1.0, 100.0, 100.0, 0.0 },
+    { 1.0, 100.0, 1000.0, 50.0 },
+};
+
+static const char *const regimes[] = { "under", "critical", "over" };
+
+// keeps the compiler from dropping the loops
+static volatile double sink;
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// the largest difference between the closed form and a classic Runge-Kutta
+// integration of m x'' = -k x - c x', over `duration`
+static double integrationError(const TimelineAnimationSpring *spring,
+                               double mass, double stiffness, double damping, double velocity,
+                               double duration)
+{
+    // enough steps for the fastest rate of the spring, the stiff ones too
+    const int steps = (int)fmax(200000.0, 100.0 * duration * (damping / mass + sqrt(stiffness / mass)));
+    const double h = duration / steps;
+    double x = -1.0;
+    double v = velocity;
+    double error = 0.0;
+    for (int i = 1; i <= steps; ++i) {
+#define ACCELERATION(x, v) ((-stiffness * (x) - damping * (v)) / mass)
+        const double k1x = v, k1v = ACCELERATION(x, v);
+        const double k2x = v + 0.5 * h * k1v, k2v = ACCELERATION(x + 0.5 * h * k1x, v + 0.5 * h * k1v);
+        const double k3x = v + 0.5 * h * k2v, k3v = ACCELERATION(x + 0.5 * h * k2x, v + 0.5 * h * k2v);
+        const double k4x = v + h * k3v, k4v = ACCELERATION(x + h * k3x, v + h * k3v);
+#undef ACCELERATION
+        x += h / 6.0 * (k1x + 2.0 * k2x + 2.0 * k3x + k4x);
+        v += h / 6.0 * (k1v + 2.0 * k2v + 2.0 * k3v + k4v);
+        error = fmax(error, fabs(TimelineAnimationSpringEvaluate(spring, i * h) - (1.0 + x)));
+    }
+    return error;
+}
+
+// 0 if the progress goes out of the tolerance after `settle`, or does not
+// just before it
+static int settlingIsExact(const TimelineAnimationSpring *spring, double settle)
+{
+    if (settle > 0.0 && fabs(TimelineAnimationSpringEvaluate(spring, settle * (1.0 - 1e-9)) - 1.0) <= TOLERANCE) {
+        return 0;
+    }
+    const double horizon = settle + 20.0 / spring->naturalFrequency + 5.0 * settle;
+    for (int i = 0; i <= 1000000; ++i) {
+        const double t = settle + (horizon - settle) * i / 1000000.0;
+        if (fabs(TimelineAnimationSpringEvaluate(spring, t) - 1.0) > TOLERANCE * (1.0 + 1e-9)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static double keyframeError(const TimelineAnimationSpring *spring, double duration, size_t count)
+{
+    double *const progress = malloc(sizeof(double) * count);
+    TimelineAnimationSpringKeyframeProgress(spring, duration, count, progress);
+    double error = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        const double t = duration * (double)i / (double)(count - 1);
+        error = fmax(error, fabs(progress[i] - TimelineAnimationSpringEvaluate(spring, t)));
+    }
+    free(progress);
+    return error;
+}
+
+int main(void)
+{
+    int failures = 0;
+    printf("%6s %7s %7s %6s %9s %9s %10s %10s %10s %10s %10s\n",
+           "mass", "stiff", "damping", "v0", "regime", "ratio", "ode error", "settle s", "envelope s", "kf60 err", "kf6000 err");
+    for (size_t i = 0; i < sizeof(springs) / sizeof(springs[0]); ++i) {
+        TimelineAnimationSpring spring;
+        if (!TimelineAnimationSpringInit(&spring, springs[i].mass, springs[i].stiffness, springs[i].damping, springs[i].velocity)) {
+            printf("spring %zu rejected\n", i);
+            ++failures;
+            continue;
+        }
+        const double settle = TimelineAnimationSpringSettlingTime(&spring, TOLERANCE);
+        const double ode = integrationError(&spring, springs[i].mass, springs[i].stiffness, springs[i].damping, springs[i].velocity,
+                                            fmax(settle, 1.0));
+        const int exact = settlingIsExact(&spring, settle);
+        double envelope = NAN;
+        if (spring.regime == TimelineAnimationSpringUnderdamped) {
+            envelope = log(hypot(spring.a, spring.b) / TOLERANCE) / spring.decay;
+        }
+        const double kf60 = keyframeError(&spring, settle, 60);
+        const double kf6000 = keyframeError(&spring, settle, 6000);
+
+        printf("%6.1f %7.1f %7.1f %6.1f %9s %9.3f %10.1e %10.4f %10.4f %10.1e %10.1e%s\n",
+               springs[i].mass, springs[i].stiffness, springs[i].damping, springs[i].velocity,
+               regimes[spring.regime], spring.dampingRatio, ode, settle, envelope, kf60, kf6000,
+               exact ? "" : "  settling time FAILED");
+        failures += !exact;
+        failures += (ode > 1e-9) || (kf60 > 1e-12) || (kf6000 > 1e-12);
+    }
+
+    TimelineAnimationSpring undamped;
+    TimelineAnimationSpringInit(&undamped, 1.0, 100.0, 0.0, 0.0);
+    if (!isinf(TimelineAnimationSpringSettlingTime(&undamped, TOLERANCE))) {
+        printf("an undamped spring settles\n");
+        ++failures;
+    }
+    TimelineAnimationSpring invalid;
+    if (TimelineAnimationSpringInit(&invalid, 0.0, 100.0, 10.0, 0.0) || TimelineAnimationSpringInit(&invalid, 1.0, 100.0, -1.0, 0.0)) {
+        printf("invalid spring accepted\n");
+        ++failures;
+    }
+
+    // 60 keyframes of the underdamped, critically damped and overdamped springs
+    const size_t timed[] = { 1, 7, 10 };
+    printf("\n%9s %14s %14s %14s   ns per keyframe, %d keyframes\n", "regime", "evaluate", "batch", "keyframes", KEYFRAMES);
+    for (size_t i = 0; i < sizeof(timed) / sizeof(timed[0]); ++i) {
+        TimelineAnimationSpring spring;
+        TimelineAnimationSpringInit(&spring, springs[timed[i]].mass, springs[timed[i]].stiffness, springs[timed[i]].damping, springs[timed[i]].velocity);
+        const double duration = TimelineAnimationSpringSettlingTime(&spring, TOLERANCE);
+        double times[KEYFRAMES], progress[KEYFRAMES];
+        for (size_t k = 0; k < KEYFRAMES; ++k) {
+            times[k] = duration * (double)k / (KEYFRAMES - 1);
+        }
+
+        double best[3] = { INFINITY, INFINITY, INFINITY };
+        for (int run = 0; run < 5; ++run) {
+            double start = now();
+            for (int r = 0; r < ROUNDS; ++r) {
+                for (size_t k = 0; k < KEYFRAMES; ++k) {
+                    progress[k] = TimelineAnimationSpringEvaluate(&spring, times[k]);
+                }
+                sink = progress[r % KEYFRAMES];
+            }
+            best[0] = fmin(best[0], (now() - start) / ((double)ROUNDS * KEYFRAMES));
+
+            start = now();
+            for (int r = 0; r < ROUNDS; ++r) {
+                TimelineAnimationSpringEvaluateBatch(&spring, times, progress, KEYFRAMES);
+                sink = progress[r % KEYFRAMES];
+            }
+            best[1] = fmin(best[1], (now() - start) / ((double)ROUNDS * KEYFRAMES));
+
+            start = now();
+            for (int r = 0; r < ROUNDS; ++r) {
+                TimelineAnimationSpringKeyframeProgress(&spring, duration, KEYFRAMES, progress);
+                sink = progress[r % KEYFRAMES];
+            }
+            best[2] = fmin(best[2], (now() - start) / ((double)ROUNDS * KEYFRAMES));
+        }
+        printf("%9s %14.2f %14.2f %14.2f\n", regimes[spring.regime], best[0], best[1], best[2]);
+    }
+
+    printf("\n%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+/*!
+ *  @file TimelineAnimationTableCheck.c
+ *  @brief TimelineAnimations
+ *
+ *  Checks that the lookup tables of TimelineAnimationSpecialTimingFunctionTable.h
+ *  stay within their maximum error against the exact timing functions.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationTableCheck.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionTable.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationTableCheck && /tmp/TimelineAnimationTableCheck
+ *
+ *  Exits with a non zero status if any table exceeds its bound.
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+#include "TimelineAnimationSpecialTimingFunctionTable.h"
+
+#define CURVE(name) { #name, name }
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+} curves[] = {
+    CURVE(SineEaseIn), CURVE(SineEaseOut), CURVE(SineEaseInOut),
+    CURVE(CircularEaseIn), CURVE(CircularEaseOut), CURVE(CircularEaseInOut),
+    CURVE(ExponentialEaseIn), CURVE(ExponentialEaseOut), CURVE(ExponentialEaseInOut),
+    CURVE(ElasticEaseIn), CURVE(ElasticEaseOut), CURVE(ElasticEaseInOut),
+};
+
+static const size_t resolutions[] = { 64, 256, 1024, 4096 };
+static const double bounds[] = { 1e-3, 1e-5, 1e-7 };
+
+// xorshift64*, so that every run checks the same points
+static uint64_t state = 0x9E3779B97F4A7C15ull;
+static double random_progress(void)
+{
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return (double)((state * 0x2545F4914F6CDD1Dull) >> 11) * 0x1.0p-53;
+}
+
+static double check(const TimelineAnimationTable *table, TimelineAnimationSpecialTimingFunction function)
+{
+    double error = 0.0;
+    // a dense grid that includes the ends and every table entry
+    const size_t grid = TimelineAnimationTableResolution(table) * 64;
+    for (size_t i = 0; i <= grid; ++i) {
+        const double p = (double)i / (double)grid;
+        const double e = fabs(TimelineAnimationTableEvaluate(table, p) - function(p));
+        error = (e > error) ? e : error;
+    }
+    for (size_t i = 0; i < 1000000; ++i) {
+        const double p = random_progress();
+        const double e = fabs(TimelineAnimationTableEvaluate(table, p) - function(p));
+        error = (e > error) ? e : error;
+    }
+    return error;
+}
+
+int main(void)
+{
+    static const char *const interpolations[] = { "linear", "cubic" };
+    int failures = 0;
+
+    printf("%-22s %-7s %6s %8s %12s %12s %6s\n",
+           "curve", "interp", "res", "bound", "measured", "checked", "exact");
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        for (int interpolation = 0; interpolation < 2; ++interpolation) {
+            for (size_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); ++r) {
+                for (size_t b = 0; b < sizeof(bounds) / sizeof(bounds[0]); ++b) {
+                    const TimelineAnimationTable *const table =
+                    TimelineAnimationTableFor(curves[c].function,
+                                              resolutions[r],
+                                              (TimelineAnimationTableInterpolation)interpolation,
+                                              bounds[b]);
+                    if (table == NULL) {
+                        printf("%-22s could not build the table\n", curves[c].name);
+                        ++failures;
+                        continue;
+                    }
+                    if (TimelineAnimationTableFor(curves[c].function,
+                                                  resolutions[r],
+                                                  (TimelineAnimationTableInterpolation)interpolation,
+                                                  bounds[b]) != table) {
+                        printf("%-22s the table is not shared\n", curves[c].name);
+                        ++failures;
+                    }
+                    const double error = check(table, curves[c].function);
+                    const int failed = !(error <= bounds[b]);
+                    failures += failed;
+                    printf("%-22s %-7s %6zu %8.0e %12.3e %12.3e %6zu%s\n",
+                           curves[c].name,
+                           interpolations[interpolation],
+                           resolutions[r],
+                           bounds[b],
+                           TimelineAnimationTableMeasuredError(table),
+                           error,
+                           TimelineAnimationTableExactIntervalCount(table),
+                           failed ? "  FAILED" : "");
+                }
+            }
+        }
+    }
+    printf("%d failure(s)\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,552 @@
+/*!
+ *  @file TimelineAnimationTransformInterpolationCheck.c
+ *  @brief TimelineAnimations
+ *
+ *  Checks TimelineAnimationTransformInterpolation.h against reference
+ *  matrices, built here as the product of a scale, a skew, a rotation as
+ *  CATransform3DMakeRotation() makes it, a translation and a perspective:
+ *
+ *  - decomposing a reference matrix gives back its parts, and composing them
+ *    gives back the matrix, over random parts, half turns and mirrors
+ *  - interpolating parts that differ in one way at a time, a rotation about
+ *    the same axis, a non-uniform scale, a skew, gives the reference matrix
+ *    of the interpolated part
+ *  - the keyframes of TimelineAnimationTransformInterpolate() are those of
+ *    TimelineAnimationTransformDecompositionInterpolate(), also with the
+ *    progress in the last plane, and its ends are the transforms
+ *  - affine transforms that rotate and scale uniformly are interpolated as
+ *    they were before, by angle and scale, and the others keep their shape
+ *
+ *  Then times the keyframes of a 3D transform and of an affine one, against
+ *  a decomposition and composition per keyframe and the previous affine
+ *  interpolation.
+ *
+ *  Exits with 1 if a check fails.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationTransformInterpolationCheck.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationTransformInterpolation.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationKeyframes.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationTransformInterpolationCheck \
+ *          && /tmp/TimelineAnimationTransformInterpolationCheck
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "TimelineAnimationKeyframes.h"
+#include "TimelineAnimationTransformInterpolation.h"
+
+#define N TimelineAnimationTransformComponents
+#define RANDOM_MATRICES 10000
+#define TOLERANCE 1e-9
+
+// keeps the compiler from dropping the loops
+static volatile double sink;
+
+typedef struct {
+    double translation[3];
+    double scale[3];
+    double skew[3];
+    double perspective[4];
+    double axis[3];
+    double angle;
+} Parts;
+
+static int failures = 0;
+
+static void check(const char *name, double error, double tolerance)
+{
+    const int ok = (error <= tolerance);
+    failures += !ok;
+    printf("%-58s %9.2e%s\n", name, error, ok ? "" : " FAILED");
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static double uniform(double low, double high)
+{
+    return low + (high - low) * ((double)rand() / RAND_MAX);
+}
+
+static void identity(double m[N])
+{
+    memset(m, 0, sizeof(double) * N);
+    m[0] = m[5] = m[10] = m[15] = 1.0;
+}
+
+static void multiply(const double a[N], const double b[N], double result[N])
+{
+    double product[N];
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            double sum = 0.0;
+            for (int k = 0; k < 4; ++k) {
+                sum += a[4 * i + k] * b[4 * k + j];
+            }
+            product[4 * i + j] = sum;
+        }
+    }
+    memcpy(result, product, sizeof(product));
+}
+
+// CATransform3DMakeRotation(), for row vectors
+static void rotation(double angle, const double axis[3], double m[N])
+{
+    const double length = sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    const double x = axis[0] / length, y = axis[1] / length, z = axis[2] / length;
+    const double c = cos(angle), s = sin(angle), t = 1.0 - c;
+    identity(m);
+    m[0] = x * x * t + c;
+    m[1] = x * y * t + z * s;
+    m[2] = x * z * t - y * s;
+    m[4] = x * y * t - z * s;
+    m[5] = y * y * t + c;
+    m[6] = y * z * t + x * s;
+    m[8] = x * z * t + y * s;
+    m[9] = y * z * t - x * s;
+    m[10] = z * z * t + c;
+}
+
+// scale * skew * rotation * translation * perspective
+static void reference(const Parts *parts, double m[N])
+{
+    double factor[N];
+    identity(m);
+    m[0] = parts->scale[0];
+    m[5] = parts->scale[1];
+    m[10] = parts->scale[2];
+    identity(factor);
+    factor[4] = parts->skew[0];
+    factor[8] = parts->skew[1];
+    factor[9] = parts->skew[2];
+    multiply(m, factor, m);
+    rotation(parts->angle, parts->axis, factor);
+    multiply(m, factor, m);
+    identity(factor);
+    factor[12] = parts->translation[0];
+    factor[13] = parts->translation[1];
+    factor[14] = parts->translation[2];
+    multiply(m, factor, m);
+    identity(factor);
+    factor[3] = parts->perspective[0];
+    factor[7] = parts->perspective[1];
+    factor[11] = parts->perspective[2];
+    factor[15] = parts->perspective[3];
+    multiply(m, factor, m);
+}
+
+static double matrixError(const double a[N], const double b[N])
+{
+    double error = 0.0;
+    for (int i = 0; i < N; ++i) {
+        error = fmax(error, fabs(a[i] - b[i]));
+    }
+    return error;
+}
+
+static double normalisedError(const double a[N], const double b[N])
+{
+    double normalisedA[N], normalisedB[N];
+    for (int i = 0; i < N; ++i) {
+        normalisedA[i] = a[i] / a[15];
+        normalisedB[i] = b[i] / b[15];
+    }
+    return matrixError(normalisedA, normalisedB);
+}
+
+static void randomParts(Parts *parts)
+{
+    for (int i = 0; i < 3; ++i) {
+        parts->translation[i] = uniform(-500.0, 500.0);
+        parts->scale[i] = uniform(0.1, 4.0);
+        parts->skew[i] = uniform(-1.0, 1.0);
+        parts->axis[i] = uniform(-1.0, 1.0);
+    }
+    parts->perspective[0] = uniform(-1e-3, 1e-3);
+    parts->perspective[1] = uniform(-1e-3, 1e-3);
+    parts->perspective[2] = uniform(-1e-2, 1e-2);
+    parts->perspective[3] = 1.0;
+    parts->angle = uniform(-M_PI, M_PI);
+}
+
+static void checkDecomposition(void)
+{
+    double roundTrip = 0.0, partsError = 0.0, rotationError = 0.0;
+    int decomposed = 1;
+    for (int r = 0; r < RANDOM_MATRICES; ++r) {
+        Parts parts;
+        randomParts(&parts);
+        // perspective with m44 other than 1 as well
+        parts.perspective[3] = uniform(0.5, 2.0);
+        double m[N], composed[N];
+        reference(&parts, m);
+        TimelineAnimationTransformDecomposition decomposition;
+        decomposed &= TimelineAnimationTransformDecompose(m, &decomposition);
+        TimelineAnimationTransformRecompose(&decomposition, composed);
+        roundTrip = fmax(roundTrip, normalisedError(m, composed));
+
+        // the parts, m44 normalised to 1: the 3x3 part and translation are
+        // divided by it, the perspective is not
+        double expected[N], rotated[N];
+        const double m44 = m[15];
+        for (int i = 0; i < 3; ++i) {
+            partsError = fmax(partsError, fabs(decomposition.scale[i] - parts.scale[i] / m44));
+            partsError = fmax(partsError, fabs(decomposition.skew[i] - parts.skew[i]));
+            partsError = fmax(partsError, fabs(decomposition.perspective[i] - parts.perspective[i]));
+            partsError = fmax(partsError, fabs(decomposition.translation[i] - parts.translation[i] / m44) / 500.0);
+        }
+        // the rotation of the quaternion is the one of the axis and angle
+        const double *const q = decomposition.quaternion;
+        const double axis[3] = { q[0], q[1], q[2] };
+        const double sine = sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+        rotation(2.0 * atan2(sine, q[3]), (sine > 0.0) ? axis : (const double[3]){ 0.0, 0.0, 1.0 }, rotated);
+        rotation(parts.angle, parts.axis, expected);
+        rotationError = fmax(rotationError, matrixError(rotated, expected));
+    }
+    check("random matrices decompose", decomposed ? 0.0 : 1.0, 0.0);
+    check("random matrices, composed again", roundTrip, TOLERANCE);
+    check("random matrices, scale, skew and perspective", partsError, TOLERANCE);
+    check("random matrices, rotation", rotationError, TOLERANCE);
+
+    // half turns about every axis, where the quaternion has no w
+    double halfTurns = 0.0;
+    const double axes[][3] = {
+        { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 }, { 1, 1, 0 }, { 1, -1, 0 }, { 0, 1, -1 }, { 1, 1, 1 }, { -1, 2, 3 },
+    };
+    for (size_t a = 0; a < sizeof(axes) / sizeof(axes[0]); ++a) {
+        Parts parts = { { 1, 2, 3 }, { 1, 1, 1 }, { 0, 0, 0 }, { 0, 0, 0, 1 }, { axes[a][0], axes[a][1], axes[a][2] }, M_PI };
+        double m[N], composed[N];
+        reference(&parts, m);
+        TimelineAnimationTransformDecomposition decomposition;
+        TimelineAnimationTransformDecompose(m, &decomposition);
+        TimelineAnimationTransformRecompose(&decomposition, composed);
+        halfTurns = fmax(halfTurns, matrixError(m, composed));
+    }
+    check("half turns, composed again", halfTurns, TOLERANCE);
+
+    // mirrors: an affine one along x, keeping a rotation about z, any other
+    // along all three axes
+    double mirrors = 0.0, mirrorsInPlane = 0.0;
+    for (int r = 0; r < 1000; ++r) {
+        Parts parts;
+        randomParts(&parts);
+        parts.scale[r % 3] = -parts.scale[r % 3];
+        double m[N], composed[N];
+        reference(&parts, m);
+        TimelineAnimationTransformDecomposition decomposition;
+        TimelineAnimationTransformDecompose(m, &decomposition);
+        TimelineAnimationTransformRecompose(&decomposition, composed);
+        mirrors = fmax(mirrors, normalisedError(m, composed));
+
+        Parts affine = { { parts.translation[0], parts.translation[1], 0 }, { parts.scale[0], parts.scale[1], 1 },
+                         { parts.skew[0], 0, 0 }, { 0, 0, 0, 1 }, { 0, 0, 1 }, parts.angle };
+        affine.scale[r % 2] = -fabs(affine.scale[r % 2]);
+        affine.scale[1 - r % 2] = fabs(affine.scale[1 - r % 2]);
+        reference(&affine, m);
+        TimelineAnimationTransformDecompose(m, &decomposition);
+        TimelineAnimationTransformRecompose(&decomposition, composed);
+        mirrorsInPlane = fmax(mirrorsInPlane, matrixError(m, composed));
+        // about z only, scaled -1 along x at most
+        mirrorsInPlane = fmax(mirrorsInPlane, fabs(decomposition.quaternion[0]) + fabs(decomposition.quaternion[1]));
+        mirrorsInPlane = fmax(mirrorsInPlane, fabs(decomposition.scale[2] - 1.0));
+        mirrorsInPlane = fmax(mirrorsInPlane, (decomposition.scale[1] < 0.0) ? 1.0 : 0.0);
+    }
+    check("mirrors, composed again", mirrors, TOLERANCE);
+    check("affine mirrors, composed again about z", mirrorsInPlane, TOLERANCE);
+
+    double singular[N];
+    identity(singular);
+    singular[5] = 0.0;
+    TimelineAnimationTransformDecomposition decomposition;
+    check("a singular matrix does not decompose", TimelineAnimationTransformDecompose(singular, &decomposition), 0.0);
+}
+
+// Interpolates `from` and `to` at `progress`, the keyframe of
+// TimelineAnimationTransformInterpolate() at that progress.
+static void interpolated(const double from[N], const double to[N], double progress, double result[N])
+{
+    double planes[N];
+    TimelineAnimationTransformInterpolate(&progress, 1, from, to, planes);
+    memcpy(result, planes, sizeof(planes));
+}
+
+static void checkInterpolation(void)
+{
+    // one part at a time, the others random but the same
+    double rotationError = 0.0, scaleError = 0.0, skewError = 0.0, endsError = 0.0;
+    for (int r = 0; r < 1000; ++r) {
+        Parts from, to, middle;
+        randomParts(&from);
+        const double v = uniform(0.0, 1.0);
+        double fromMatrix[N], toMatrix[N], expected[N], actual[N];
+
+        to = middle = from;
+        to.angle = from.angle + uniform(-3.0, 3.0);
+        middle.angle = from.angle + v * (to.angle - from.angle);
+        reference(&from, fromMatrix);
+        reference(&to, toMatrix);
+        reference(&middle, expected);
+        interpolated(fromMatrix, toMatrix, v, actual);
+        rotationError = fmax(rotationError, normalisedError(expected, actual));
+
+        interpolated(fromMatrix, toMatrix, 0.0, actual);
+        endsError = fmax(endsError, normalisedError(fromMatrix, actual));
+        interpolated(fromMatrix, toMatrix, 1.0, actual);
+        endsError = fmax(endsError, normalisedError(toMatrix, actual));
+
+        to = middle = from;
+        for (int i = 0; i < 3; ++i) {
+            to.scale[i] = uniform(0.1, 4.0);
+            middle.scale[i] = from.scale[i] + v * (to.scale[i] - from.scale[i]);
+        }
+        reference(&to, toMatrix);
+        reference(&middle, expected);
+        interpolated(fromMatrix, toMatrix, v, actual);
+        scaleError = fmax(scaleError, normalisedError(expected, actual));
+
+        to = middle = from;
+        for (int i = 0; i < 3; ++i) {
+            to.skew[i] = uniform(-1.0, 1.0);
+            middle.skew[i] = from.skew[i] + v * (to.skew[i] - from.skew[i]);
+        }
+        reference(&to, toMatrix);
+        reference(&middle, expected);
+        interpolated(fromMatrix, toMatrix, v, actual);
+        skewError = fmax(skewError, normalisedError(expected, actual));
+    }
+    check("rotation about the same axis, by the interpolated angle", rotationError, TOLERANCE);
+    check("non-uniform scale, interpolated", scaleError, TOLERANCE);
+    check("skew, interpolated", skewError, TOLERANCE);
+    check("the first and last keyframes are the transforms", endsError, TOLERANCE);
+
+    // the short way round: a turn of 350 degrees is one of -10
+    Parts from = { { 0, 0, 0 }, { 1, 1, 1 }, { 0, 0, 0 }, { 0, 0, 0, 1 }, { 0, 1, 0 }, 0.0 };
+    Parts to = from, middle = from;
+    to.angle = 350.0 * M_PI / 180.0;
+    middle.angle = -5.0 * M_PI / 180.0;
+    double fromMatrix[N], toMatrix[N], expected[N], actual[N];
+    reference(&from, fromMatrix);
+    reference(&to, toMatrix);
+    reference(&middle, expected);
+    interpolated(fromMatrix, toMatrix, 0.5, actual);
+    check("the shorter arc", matrixError(expected, actual), TOLERANCE);
+
+    // the keyframes, against one decomposition at a time
+    Parts a, b;
+    randomParts(&a);
+    randomParts(&b);
+    reference(&a, fromMatrix);
+    reference(&b, toMatrix);
+    const size_t count = 241;
+    double *const values = malloc(sizeof(double) * N * count);
+    double *const progress = malloc(sizeof(double) * count);
+    TimelineAnimationKeyframeProgress(ElasticEaseOut, count, progress);
+    TimelineAnimationTransformInterpolate(progress, count, fromMatrix, toMatrix, values);
+    TimelineAnimationTransformDecomposition fromDecomposition, toDecomposition, decomposition;
+    TimelineAnimationTransformDecompose(fromMatrix, &fromDecomposition);
+    TimelineAnimationTransformDecompose(toMatrix, &toDecomposition);
+    double keyframesError = 0.0;
+    for (size_t frame = 0; frame < count; ++frame) {
+        TimelineAnimationTransformDecompositionInterpolate(&fromDecomposition, &toDecomposition, progress[frame], &decomposition);
+        TimelineAnimationTransformRecompose(&decomposition, expected);
+        for (int c = 0; c < N; ++c) {
+            keyframesError = fmax(keyframesError, fabs(values[c * count + frame] - expected[c]));
+        }
+    }
+    check("keyframes, against interpolating one at a time", keyframesError, 1e-12);
+
+    // the progress in the last plane
+    double *const inPlace = malloc(sizeof(double) * N * count);
+    TimelineAnimationTransforms(ElasticEaseOut, fromMatrix, toMatrix, count, inPlace);
+    double inPlaceError = 0.0;
+    for (size_t i = 0; i < N * count; ++i) {
+        inPlaceError = fmax(inPlaceError, fabs(values[i] - inPlace[i]));
+    }
+    check("keyframes, with the progress in the last plane", inPlaceError, 0.0);
+
+    // a matrix that does not decompose, component by component
+    double singular[N];
+    identity(singular);
+    singular[0] = 0.0;
+    TimelineAnimationTransformInterpolate(progress, count, singular, toMatrix, values);
+    double fallbackError = 0.0;
+    for (size_t frame = 0; frame < count; ++frame) {
+        for (int c = 0; c < N; ++c) {
+            const double component = singular[c] + progress[frame] * (toMatrix[c] - singular[c]);
+            fallbackError = fmax(fallbackError, fabs(values[c * count + frame] - component));
+        }
+    }
+    check("a singular matrix, component by component", fallbackError, 1e-12);
+
+    free(inPlace);
+    free(progress);
+    free(values);
+}
+
+// The affine interpolation of TimelineAnimationKeyframes.c until now: scale
+// and angle of the first column.
+static void previousAffine(const double *progress, size_t count, const double from[6], const double to[6], double *values)
+{
+    const double fromScale = hypot(from[0], from[2]);
+    const double toScale = hypot(to[0], to[2]);
+    const double fromRotation = atan2(from[2], from[0]);
+    const double toRotation = atan2(to[2], to[0]);
+    double rotationDiff = toRotation - fromRotation;
+    if (rotationDiff < -M_PI) {
+        rotationDiff += (2 * M_PI);
+    }
+    else if (rotationDiff > M_PI) {
+        rotationDiff -= (2 * M_PI);
+    }
+    for (size_t frame = 0; frame < count; ++frame) {
+        const double v = progress[frame];
+        const double scale = fromScale + v * (toScale - fromScale);
+        const double angle = fromRotation + v * rotationDiff;
+        values[frame] = scale * cos(angle);
+        values[count + frame] = -scale * sin(angle);
+        values[2 * count + frame] = scale * sin(angle);
+        values[3 * count + frame] = scale * cos(angle);
+        values[4 * count + frame] = from[4] + v * (to[4] - from[4]);
+        values[5 * count + frame] = from[5] + v * (to[5] - from[5]);
+    }
+}
+
+static void checkAffine(void)
+{
+    const size_t count = 61;
+    double progress[61], values[6 * 61], previous[6 * 61];
+    TimelineAnimationKeyframeProgress(BackEaseInOut, count, progress);
+
+    double uniformError = 0.0;
+    for (int r = 0; r < 1000; ++r) {
+        const double fromScale = uniform(0.1, 4.0), toScale = uniform(0.1, 4.0);
+        const double fromAngle = uniform(-M_PI, M_PI), toAngle = uniform(-M_PI, M_PI);
+        const double from[6] = { fromScale * cos(fromAngle), fromScale * sin(fromAngle), -fromScale * sin(fromAngle),
+                                 fromScale * cos(fromAngle), uniform(-500, 500), uniform(-500, 500) };
+        const double to[6] = { toScale * cos(toAngle), toScale * sin(toAngle), -toScale * sin(toAngle),
+                               toScale * cos(toAngle), uniform(-500, 500), uniform(-500, 500) };
+        TimelineAnimationKeyframeInterpolateAffineTransform(progress, count, from, to, values);
+        previousAffine(progress, count, from, to, previous);
+        for (size_t i = 0; i < 6 * count; ++i) {
+            uniformError = fmax(uniformError, fabs(values[i] - previous[i]) / ((i >= 4 * count) ? 500.0 : 1.0));
+        }
+    }
+    check("affine, uniform scale and rotation, as before", uniformError, TOLERANCE);
+
+    // a non-uniform scale and a skew keep their shape half way, where the
+    // angle and scale of the first column lose it
+    const double half = 0.5;
+    const double stretched[6] = { 2.0, 0.0, 0.0, 0.5, 0.0, 0.0 };
+    const double unit[6] = { 1.0, 0.0, 0.0, 1.0, 0.0, 0.0 };
+    double middle[6], before[6];
+    TimelineAnimationKeyframeInterpolateAffineTransform(&half, 1, unit, stretched, middle);
+    previousAffine(&half, 1, unit, stretched, before);
+    const double expectedStretch[6] = { 1.5, 0.0, 0.0, 0.75, 0.0, 0.0 };
+    double stretchError = 0.0, stretchErrorBefore = 0.0;
+    for (int c = 0; c < 6; ++c) {
+        stretchError = fmax(stretchError, fabs(middle[c] - expectedStretch[c]));
+        stretchErrorBefore = fmax(stretchErrorBefore, fabs(before[c] - expectedStretch[c]));
+    }
+    check("affine, non-uniform scale half way", stretchError, TOLERANCE);
+    printf("%-58s %9.2e\n", "  until now", stretchErrorBefore);
+
+    const double sheared[6] = { 1.0, 0.0, 1.0, 1.0, 0.0, 0.0 };
+    TimelineAnimationKeyframeInterpolateAffineTransform(&half, 1, unit, sheared, middle);
+    previousAffine(&half, 1, unit, sheared, before);
+    const double expectedShear[6] = { 1.0, 0.0, 0.5, 1.0, 0.0, 0.0 };
+    double shearError = 0.0, shearErrorBefore = 0.0;
+    for (int c = 0; c < 6; ++c) {
+        shearError = fmax(shearError, fabs(middle[c] - expectedShear[c]));
+        shearErrorBefore = fmax(shearErrorBefore, fabs(before[c] - expectedShear[c]));
+    }
+    check("affine, skew half way", shearError, TOLERANCE);
+    printf("%-58s %9.2e\n", "  until now", shearErrorBefore);
+}
+
+// nanoseconds per keyframe
+static double timeKeyframes(int path, size_t count, const double *from, const double *to)
+{
+    double *const progress = malloc(sizeof(double) * count);
+    double *const values = malloc(sizeof(double) * N * count);
+    TimelineAnimationKeyframeProgress(QuadraticEaseOut, count, progress);
+    double best = INFINITY;
+    for (int run = 0; run < 7; ++run) {
+        const int iterations = 200;
+        const double start = now();
+        for (int i = 0; i < iterations; ++i) {
+            switch (path) {
+                case 0:
+                    TimelineAnimationTransformInterpolate(progress, count, from, to, values);
+                    break;
+                case 1: {
+                    TimelineAnimationTransformDecomposition a, b, d;
+                    TimelineAnimationTransformDecompose(from, &a);
+                    TimelineAnimationTransformDecompose(to, &b);
+                    for (size_t frame = 0; frame < count; ++frame) {
+                        double m[N];
+                        TimelineAnimationTransformDecompositionInterpolate(&a, &b, progress[frame], &d);
+                        TimelineAnimationTransformRecompose(&d, m);
+                        for (int c = 0; c < N; ++c) {
+                            values[c * count + frame] = m[c];
+                        }
+                    }
+                    break;
+                }
+                case 2:
+                    TimelineAnimationKeyframeInterpolateAffineTransform(progress, count, from, to, values);
+                    break;
+                case 3:
+                    previousAffine(progress, count, from, to, values);
+                    break;
+            }
+            sink = values[count - 1];
+        }
+        best = fmin(best, (now() - start) / iterations / count);
+    }
+    free(values);
+    free(progress);
+    return best;
+}
+
+int main(void)
+{
+    srand(17);
+    checkDecomposition();
+    checkInterpolation();
+    checkAffine();
+
+    Parts a, b;
+    randomParts(&a);
+    randomParts(&b);
+    double from[N], to[N];
+    reference(&a, from);
+    reference(&b, to);
+    const double affineFrom[6] = { 1.2, 0.3, -0.3, 1.2, 10.0, 20.0 };
+    const double affineTo[6] = { 0.2, -0.9, 0.9, 0.2, -40.0, 60.0 };
+    printf("\nns per keyframe              60 keyframes  240 keyframes\n");
+    const char *const names[] = { "3D, blocks", "3D, one at a time", "affine, blocks", "affine, until now" };
+    for (int path = 0; path < 4; ++path) {
+        const double *const f = (path < 2) ? from : affineFrom;
+        const double *const t = (path < 2) ? to : affineTo;
+        printf("%-28s %13.1f %14.1f\n", names[path], timeKeyframes(path, 60, f, t), timeKeyframes(path, 240, f, t));
+    }
+
+    printf("\n%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
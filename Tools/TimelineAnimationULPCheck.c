@@ -0,0 +1,201 @@
+/*!
+ *  @file TimelineAnimationULPCheck.c
+ *  @brief TimelineAnimations
+ *
+ *  Measures the accuracy of the single precision timing functions of
+ *  TimelineAnimationSpecialTimingFunction.h against the double versions,
+ *  over a grid of 2^22 + 1 progress values. For every curve it reports the
+ *  largest distance in units in the last place from the double result
+ *  rounded to float, over all values and over the values whose magnitude is
+ *  at least 1/64, and the largest absolute error. Close to zero the ULP
+ *  distance mostly measures the cancellation in the formulas, the absolute
+ *  error is the one that shows on screen.
+ *
+ *  It fails, exiting with a non zero status, if the absolute error of a
+ *  curve exceeds the bound documented in TimelineAnimationSpecialTimingFunction.h,
+ *  or if the batch kernels of an instruction set available on the machine
+ *  break the contract of TimelineAnimationSpecialTimingFunctionBatch.h: the
+ *  exact kernels must return exactly the scalar values, in double and in
+ *  float, the approximated ones must stay within their own bounds of the
+ *  double curves, in float and in double, the largest distances being
+ *  reported next to the instruction set.
+ *
+ *  Build and run from the repository root:
+ *
+ *      cc -std=gnu11 -O2 -Wall -ITimelineAnimations/Classes/objc/SpecialEasing \
+ *          Tools/TimelineAnimationULPCheck.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunction.c \
+ *          TimelineAnimations/Classes/objc/SpecialEasing/TimelineAnimationSpecialTimingFunctionBatch.c \
+ *          -lm -lpthread -o /tmp/TimelineAnimationULPCheck && /tmp/TimelineAnimationULPCheck
+ *
+ *  Created by @author AbZorba Games
+ *  @date 17/10/2026.
+ *  @copyright Copyright © 2026 Abzorba Games. All rights reserved.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "TimelineAnimationSpecialTimingFunction.h"
+#include "TimelineAnimationSpecialTimingFunctionBatch.h"
+
+#define GRID ((size_t)1 << 22)
+
+// below this magnitude the ULP distance is reported separately
+#define SIGNIFICANT (1.0 / 64.0)
+
+// the bounds on the absolute error documented in
+// TimelineAnimationSpecialTimingFunction.h
+#define POLYNOMIAL_BOUND 1.1e-7
+#define SINE_BOUND 1.2e-7
+#define EXPONENTIAL_BOUND 1.2e-7
+#define BACK_BOUND 3.0e-7
+#define CIRCULAR_BOUND 8.5e-7
+#define ELASTIC_BOUND 1.1e-6
+#define BOUNCE_BOUND 3.1e-6
+
+// the bounds of the float and double batch kernels that approximate sin and
+// 2^x, documented in TimelineAnimationSpecialTimingFunctionBatch.h; EXACT for
+// the kernels that repeat the scalar arithmetic
+#define EXACT 0.0
+#define SINE_BATCH_BOUNDS 1.3e-7, 2e-9
+#define EXPONENTIAL_BATCH_BOUNDS 1.2e-7, 2e-10
+#define BACK_BATCH_BOUNDS 3.0e-7, 2e-9
+#define ELASTIC_BATCH_BOUNDS 1.2e-6, 1.5e-9
+
+#define CURVE(name, bound, ...) { #name, name, name##F, bound, __VA_ARGS__ }
+
+static const struct {
+    const char *name;
+    TimelineAnimationSpecialTimingFunction function;
+    TimelineAnimationSpecialTimingFunctionF functionF;
+    double bound;
+    double batchBoundF;
+    double batchBound;
+} curves[] = {
+    CURVE(LinearInterpolation, POLYNOMIAL_BOUND, EXACT, EXACT),
+    CURVE(QuadraticEaseIn, POLYNOMIAL_BOUND, EXACT, EXACT), CURVE(QuadraticEaseOut, POLYNOMIAL_BOUND, EXACT, EXACT), CURVE(QuadraticEaseInOut, POLYNOMIAL_BOUND, EXACT, EXACT),
+    CURVE(CubicEaseIn, POLYNOMIAL_BOUND, EXACT, EXACT), CURVE(CubicEaseOut, POLYNOMIAL_BOUND, EXACT, EXACT), CURVE(CubicEaseInOut, POLYNOMIAL_BOUND, EXACT, EXACT),
+    CURVE(QuarticEaseIn, POLYNOMIAL_BOUND, EXACT, EXACT), CURVE(QuarticEaseOut, POLYNOMIAL_BOUND, EXACT, EXACT), CURVE(QuarticEaseInOut, POLYNOMIAL_BOUND, EXACT, EXACT),
+    CURVE(QuinticEaseIn, POLYNOMIAL_BOUND, EXACT, EXACT), CURVE(QuinticEaseOut, POLYNOMIAL_BOUND, EXACT, EXACT), CURVE(QuinticEaseInOut, POLYNOMIAL_BOUND, EXACT, EXACT),
+    CURVE(SineEaseIn, SINE_BOUND, SINE_BATCH_BOUNDS), CURVE(SineEaseOut, SINE_BOUND, SINE_BATCH_BOUNDS), CURVE(SineEaseInOut, SINE_BOUND, SINE_BATCH_BOUNDS),
+    CURVE(CircularEaseIn, CIRCULAR_BOUND, EXACT, EXACT), CURVE(CircularEaseOut, CIRCULAR_BOUND, EXACT, EXACT), CURVE(CircularEaseInOut, CIRCULAR_BOUND, EXACT, EXACT),
+    CURVE(ExponentialEaseIn, EXPONENTIAL_BOUND, EXPONENTIAL_BATCH_BOUNDS), CURVE(ExponentialEaseOut, EXPONENTIAL_BOUND, EXPONENTIAL_BATCH_BOUNDS), CURVE(ExponentialEaseInOut, EXPONENTIAL_BOUND, EXPONENTIAL_BATCH_BOUNDS),
+    CURVE(BackEaseIn, BACK_BOUND, BACK_BATCH_BOUNDS), CURVE(BackEaseOut, BACK_BOUND, BACK_BATCH_BOUNDS), CURVE(BackEaseInOut, BACK_BOUND, BACK_BATCH_BOUNDS),
+    CURVE(ElasticEaseIn, ELASTIC_BOUND, ELASTIC_BATCH_BOUNDS), CURVE(ElasticEaseOut, ELASTIC_BOUND, ELASTIC_BATCH_BOUNDS), CURVE(ElasticEaseInOut, ELASTIC_BOUND, ELASTIC_BATCH_BOUNDS),
+    CURVE(BounceEaseIn, BOUNCE_BOUND, EXACT, EXACT), CURVE(BounceEaseOut, BOUNCE_BOUND, EXACT, EXACT), CURVE(BounceEaseInOut, BOUNCE_BOUND, EXACT, EXACT),
+    CURVE(SlowMotion, POLYNOMIAL_BOUND, EXACT, EXACT),
+};
+
+static const struct {
+    const char *name;
+    TimelineAnimationBatchISA isa;
+} isas[] = {
+    { "portable", TimelineAnimationBatchISAPortable },
+    { "sse2", TimelineAnimationBatchISASSE2 },
+    { "avx2", TimelineAnimationBatchISAAVX2 },
+    { "neon", TimelineAnimationBatchISANEON },
+};
+
+// maps the floats to integers that are consecutive in the same order
+static int64_t ordered(float value)
+{
+    int32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits < 0) ? (int64_t)INT32_MIN - bits : bits;
+}
+
+static int64_t ulps(float a, float b)
+{
+    const int64_t distance = ordered(a) - ordered(b);
+    return (distance < 0) ? -distance : distance;
+}
+
+static int same(float a, float b)
+{
+    return (a == b) || (isnan(a) && isnan(b));
+}
+
+int main(void)
+{
+    float *const in = (float *)malloc(sizeof(float) * (GRID + 1));
+    float *const scalar = (float *)malloc(sizeof(float) * (GRID + 1));
+    float *const batch = (float *)malloc(sizeof(float) * (GRID + 1));
+    double *const inD = (double *)malloc(sizeof(double) * (GRID + 1));
+    double *const scalarD = (double *)malloc(sizeof(double) * (GRID + 1));
+    double *const batchD = (double *)malloc(sizeof(double) * (GRID + 1));
+    if (in == NULL || scalar == NULL || batch == NULL || inD == NULL || scalarD == NULL || batchD == NULL) {
+        return 1;
+    }
+    // exact in float, GRID is a power of two below 2^24
+    for (size_t i = 0; i <= GRID; ++i) {
+        in[i] = (float)i / (float)GRID;
+        inD[i] = (double)in[i];
+    }
+
+    int failures = 0;
+    printf("%-22s %12s %12s %10s %12s %8s   %s\n", "curve", "max ulp", "at", "ulp>=1/64", "max abs", "bound", "batch");
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); ++c) {
+        int64_t maxULP = 0;
+        int64_t maxSignificantULP = 0;
+        float at = 0.0f;
+        double maxError = 0.0;
+        for (size_t i = 0; i <= GRID; ++i) {
+            const double expected = curves[c].function(inD[i]);
+            scalarD[i] = expected;
+            scalar[i] = curves[c].functionF(in[i]);
+            const int64_t distance = ulps(scalar[i], (float)expected);
+            if (distance > maxULP) {
+                maxULP = distance;
+                at = in[i];
+            }
+            if (fabs(expected) >= SIGNIFICANT && distance > maxSignificantULP) {
+                maxSignificantULP = distance;
+            }
+            maxError = fmax(maxError, fabs((double)scalar[i] - expected));
+        }
+
+        const int withinBound = (maxError <= curves[c].bound);
+        failures += !withinBound;
+        printf("%-22s %12lld %12.8f %10lld %12.3e %8s  ",
+               curves[c].name, (long long)maxULP, (double)at, (long long)maxSignificantULP, maxError,
+               withinBound ? "ok" : "EXCEEDED");
+        for (size_t s = 0; s < sizeof(isas) / sizeof(isas[0]); ++s) {
+            if (!TimelineAnimationBatchSetISA(isas[s].isa)) {
+                continue;
+            }
+            // odd length, so that the scalar tail runs too
+            TimelineAnimationSpecialTimingFunctionEvaluateBatchF(curves[c].functionF, in, batch, GRID + 1);
+            TimelineAnimationSpecialTimingFunctionEvaluateBatch(curves[c].function, inD, batchD, GRID + 1);
+            size_t mismatches = 0;
+            double batchError = 0.0;
+            double batchErrorD = 0.0;
+            for (size_t i = 0; i <= GRID; ++i) {
+                mismatches += !same(batch[i], scalar[i]) + !same(batchD[i], scalarD[i]);
+                batchError = fmax(batchError, fabs((double)batch[i] - scalarD[i]));
+                batchErrorD = fmax(batchErrorD, fabs(batchD[i] - scalarD[i]));
+            }
+            if (curves[c].batchBound == EXACT || isas[s].isa == TimelineAnimationBatchISAPortable) {
+                failures += (mismatches != 0);
+                printf(" %s:%s", isas[s].name, mismatches ? "MISMATCH" : "ok");
+            }
+            else {
+                const int withinBatchBound = (batchError <= curves[c].batchBoundF && batchErrorD <= curves[c].batchBound);
+                failures += !withinBatchBound;
+                printf(" %s:%.1e/%.1e%s", isas[s].name, batchError, batchErrorD, withinBatchBound ? "" : " EXCEEDED");
+            }
+        }
+        printf("\n");
+    }
+    printf("%d failure(s)\n", failures);
+
+    free(in);
+    free(scalar);
+    free(batch);
+    free(inD);
+    free(scalarD);
+    free(batchD);
+    return failures ? 1 : 0;
+}